@@ -22,6 +22,7 @@ class MockScheduler : public IScheduler {
  public:
   std::list<Process*> readyQueue;
   int timeSlice = -1;  // -1 = No quantum by default
+  bool preemptByPriority = false;  // true = a READY process with better priority takes the CPU
 
   void addProcess(Process* p) override {
     readyQueue.push_back(p);
@@ -40,6 +41,10 @@ class MockScheduler : public IScheduler {
 
   int getTimeSlice() const override { return timeSlice; }
 
+  bool shouldPreempt(const Process* running, const Process* candidate) const override {
+    return preemptByPriority && candidate->getPriority() < running->getPriority();
+  }
+
   // Métodos de visualización (mockeados para cumplir interfaz)
   std::vector<const Process*> peekReadyQueue() const override {
     std::vector<const Process*> ret;
@@ -57,7 +62,7 @@ class MockScheduler : public IScheduler {
 class MockMemoryManager : public IMemoryManager {
  public:
   // Map <PID, <PageNumber, IsLoaded>>
-  std::map<int, std::map<int, bool>> memoryState;
+  std::map<int, std::map<PageNumber, bool>> memoryState;
 
   // Para tracking de tests
   int requestCount = 0;
@@ -65,7 +70,7 @@ class MockMemoryManager : public IMemoryManager {
   // Flag to simulate infinite/perfect memory
   bool everythingLoaded = false;
 
-  bool isPageLoaded(int pid, int page) const override {
+  bool isPageLoaded(int pid, PageNumber page) const override {
     if (everythingLoaded) return true;
 
     if (memoryState.count(pid) && memoryState.at(pid).count(page)) {
@@ -74,7 +79,7 @@ class MockMemoryManager : public IMemoryManager {
     return false;
   }
 
-  PageRequestResult requestPage(int pid, int page) override {
+  PageRequestResult requestPage(int pid, PageNumber page, bool isWrite = false) override {
     requestCount++;
     if (everythingLoaded) return PageRequestResult::HIT;
     // En simulación real, esto iniciaría reemplazo.
@@ -82,13 +87,13 @@ class MockMemoryManager : public IMemoryManager {
     return PageRequestResult::PAGE_FAULT;
   }
 
-  void completePageLoad(int pid, int pageNumber) override {
+  void completePageLoad(int pid, PageNumber pageNumber) override {
     memoryState[pid][pageNumber] = true;
   }
 
-  void allocateForProcess(int pid, int requiredPages) override {
+  void allocateForProcess(int pid, PageNumber requiredPages) override {
     // Inicializar mapa para evitar accesos inválidos
-    for (int i = 0; i < requiredPages; i++) memoryState[pid][i] = false;
+    for (PageNumber i = 0; i < requiredPages; i++) memoryState[pid][i] = false;
   }
 
   void freeForProcess(int pid) override {
@@ -19,6 +19,16 @@
 #include <vector>
 
 namespace waos::common {
+/**
+ * @brief Número de página virtual (64 bits: un proceso no está limitado a 2^31 páginas).
+ */
+using PageNumber = uint64_t;
+
+/**
+ * @brief Valor centinela de PageNumber: ninguna página (frame libre, evento sin página).
+ */
+constexpr PageNumber NO_PAGE = ~PageNumber(0);
+
 /**
  * @struct MemoryWaitInfo
  * @brief Información sobre procesos esperando carga de página.
@@ -26,10 +36,26 @@ namespace waos::common {
  */
 struct MemoryWaitInfo {
   int pid;                // ID del proceso
-  int pageNumber;         // Página que causó el fallo
+  PageNumber pageNumber;  // Página que causó el fallo
   int ticksRemaining;     // Tiempo restante de penalización
 };
 
+/**
+ * @brief Distribución de una latencia (en ticks) sobre los procesos terminados.
+ *
+ * Los percentiles salen de un histograma logarítmico (LatencyHistogram): son
+ * exactos hasta 63 ticks y con error relativo menor a 1/32 por encima.
+ */
+struct LatencyStats {
+  int count = 0;      ///< Procesos medidos
+  uint64_t min = 0;   ///< Mínimo exacto
+  uint64_t max = 0;   ///< Máximo exacto
+  double mean = 0.0;  ///< Media exacta
+  uint64_t p50 = 0;   ///< Mediana
+  uint64_t p95 = 0;   ///< Percentil 95
+  uint64_t p99 = 0;   ///< Percentil 99
+};
+
 /**
  * @brief Métricas globales del simulador calculadas en cada tick.
  *
@@ -45,6 +71,19 @@ struct SimulatorMetrics {
   int totalPageFaults = 0;         ///< Page faults acumulados de todos los procesos
   int completedProcesses = 0;      ///< Procesos en estado TERMINATED
   int totalProcesses = 0;          ///< Total de procesos cargados en la simulación
+
+  // Tiempo real (solo procesos con DEADLINE/PERIOD)
+  int deadlineJobs = 0;            ///< Trabajos con deadline ya liberados
+  int deadlineMisses = 0;          ///< Terminados tarde o aún pendientes con el deadline vencido
+  double avgLateness = 0.0;        ///< Media de (fin - deadline) de los terminados (<0: holgura)
+  int64_t maxLateness = 0;         ///< Peor (fin - deadline) entre los terminados
+
+  // Distribución de latencias (solo procesos terminados)
+  LatencyStats waitLatency;        ///< Tiempo total en READY
+  LatencyStats responseLatency;    ///< Primera ejecución - llegada
+  LatencyStats turnaroundLatency;  ///< Fin - llegada
+  double throughput = 0.0;         ///< Procesos terminados por tick
+  double fairnessIndex = 0.0;      ///< Índice de Jain del servicio relativo (CPU / retorno); 1.0 = equitativo
 };
 
 /**
@@ -57,8 +96,9 @@ struct FrameInfo {
   int frameId;            ///< ID del frame (0 a N-1)
   bool isOccupied;        ///< true si contiene una página válida
   int ownerPid;           ///< PID del proceso dueño (-1 si libre)
-  int pageNumber;         ///< Número de página virtual cargada (-1 si libre)
+  PageNumber pageNumber;  ///< Número de página virtual cargada (NO_PAGE si libre)
   uint64_t loadedAtTick;  ///< Tick cuando se cargó la página (0 si nunca)
+  int refCount = 0;       ///< Tablas de páginas que mapean el frame (>1 si es compartido)
 };
 
 /**
@@ -68,11 +108,11 @@ struct FrameInfo {
  * Representa una entrada en la tabla de páginas de un proceso específico.
  */
 struct PageTableEntryInfo {
-  int pageNumber;   ///< Número de página virtual (0 a N-1)
-  int frameNumber;  ///< Frame físico asignado (-1 si no presente en memoria)
-  bool present;     ///< true si la página está cargada en memoria física
-  bool referenced;  ///< Bit de referencia (usado por algoritmos LRU)
-  bool modified;    ///< Bit de modificación / dirty bit
+  PageNumber pageNumber;  ///< Número de página virtual (0 a N-1)
+  int frameNumber;        ///< Frame físico asignado (-1 si no presente en memoria)
+  bool present;           ///< true si la página está cargada en memoria física
+  bool referenced;        ///< Bit de referencia (usado por algoritmos LRU)
+  bool modified;          ///< Bit de modificación / dirty bit
 };
 
 /**
@@ -82,12 +122,50 @@ struct PageTableEntryInfo {
  * Contiene métricas acumuladas del rendimiento del sistema de memoria.
  */
 struct MemoryStats {
-  int totalFrames;                      ///< Total de frames en memoria física
-  int usedFrames;                       ///< Frames actualmente ocupados
-  int totalPageFaults;                  ///< Page faults acumulados desde inicio
-  int totalReplacements;                ///< Reemplazos de página realizados
-  double hitRatio;                      ///< Ratio de hits (0.0 - 1.0)
+  int totalFrames = 0;                  ///< Total de frames en memoria física
+  int usedFrames = 0;                   ///< Frames actualmente ocupados
+  int totalPageFaults = 0;              ///< Page faults acumulados desde inicio
+  int totalReplacements = 0;            ///< Reemplazos de página realizados
+  double hitRatio = 0.0;                ///< Ratio de hits (0.0 - 1.0)
   std::map<int, int> faultsPerProcess;  ///< Page faults por PID
+  double currentFaultRate = 0.0;        ///< Page faults por tick en la ventana actual del timeline
+  uint64_t totalPageWalkSteps = 0;      ///< Niveles de tabla de páginas recorridos (todas las traducciones)
+  int pageTableNodes = 0;               ///< Nodos de tablas de páginas asignados (todas las tablas)
+  size_t pageTableBytes = 0;            ///< Memoria ocupada por los metadatos de traducción
+  int sharedFrames = 0;                 ///< Frames mapeados por más de una tabla de páginas
+  int sharedMappingHits = 0;            ///< Accesos resueltos mapeando un frame compartido ya residente
+  int copyOnWriteFaults = 0;            ///< Fallos por escritura en página copy-on-write compartida
+  int compressedPoolFrames = 0;         ///< Frames reservados para el swap comprimido
+  int compressedPages = 0;              ///< Páginas actualmente en el swap comprimido
+  int compressedReloads = 0;            ///< Fallos resueltos descomprimiendo (sin E/S de disco)
+  int compressedWritebacks = 0;         ///< Páginas expulsadas del swap comprimido al disco
+};
+
+/**
+ * @brief Ventana de la serie temporal de fallos de página.
+ *
+ * Retornado por IMemoryManager::getFaultTimeline()
+ * Cada ventana agrega los eventos de memoria ocurridos en [startTick, endTick).
+ */
+struct FaultWindowInfo {
+  uint64_t startTick = 0;  ///< Primer tick cubierto por la ventana
+  uint64_t endTick = 0;    ///< Tick siguiente al último cubierto (exclusivo)
+  int faults = 0;          ///< Page faults en la ventana
+  int hits = 0;            ///< Hits en la ventana
+  int replacements = 0;    ///< Reemplazos en la ventana
+};
+
+/**
+ * @brief Tasa de fallos de un proceso en un rango de ticks.
+ *
+ * Retornado por IMemoryManager::getProcessFaultRate()
+ * Permite detectar fases de thrashing por proceso.
+ */
+struct ProcessFaultRate {
+  int pid = -1;            ///< ID del proceso
+  int faults = 0;          ///< Page faults dentro del rango consultado
+  uint64_t ticks = 0;      ///< Ticks efectivamente cubiertos por el historial
+  double faultRate = 0.0;  ///< faults / ticks (0.0 si no hay historial)
 };
 
 /**
@@ -100,6 +178,33 @@ struct SchedulerMetrics {
   int totalSchedulingDecisions;       ///< Veces que se llamó getNextProcess()
   int totalPreemptions;               ///< Preempciones por quantum o prioridad
   std::map<int, int> selectionCount;  ///< Veces que cada PID fue seleccionado para ejecutar
+
+  // SJF predictivo (promedio exponencial)
+  int predictedBursts = 0;                   ///< Ráfagas de CPU completadas con predicción previa
+  double meanAbsolutePredictionError = 0.0;  ///< Media de |t(n) - τ(n)| en ticks
+  double meanPredictionBias = 0.0;           ///< Media de t(n) - τ(n) (>0: se subestima)
+  std::map<int, double> predictedBurst;      ///< τ(n+1) actual de cada PID
+
+  // MLFQ
+  int demotions = 0;                  ///< Procesos degradados por agotar su quantum
+  int priorityBoosts = 0;             ///< Reinicios periódicos de todos los procesos al nivel 0
+  std::map<int, int> queueLevel;      ///< Nivel actual de cada PID (0 = más prioritario)
+
+  // CFS
+  double minVirtualRuntime = 0.0;          ///< min_vruntime de la cola (ticks ponderados)
+  std::map<int, double> virtualRuntime;    ///< vruntime de cada PID (ticks ponderados por su peso)
+
+  // Reparto proporcional (Lottery / Stride)
+  std::map<int, int> tickets;              ///< Tickets de cada PID
+  std::map<int, double> entitledShare;     ///< Fracción de CPU que le corresponde por tickets
+  std::map<int, double> achievedShare;     ///< Fracción de CPU efectivamente obtenida
+
+  // Prioridades con envejecimiento (aging)
+  uint64_t maxReadyWait = 0;               ///< Mayor espera en READY observada al despachar (ticks)
+  int starvedDispatches = 0;               ///< Despachos cuya espera alcanzó el umbral de inanición
+  int starvingProcesses = 0;               ///< Procesos en READY que ya superan el umbral
+  int agingEpochs = 0;                     ///< Épocas de envejecimiento aplicadas (un nivel cada una)
+  std::map<int, int> effectivePriority;    ///< Prioridad efectiva de cada PID en READY
 };
 
 }  // namespace waos::common
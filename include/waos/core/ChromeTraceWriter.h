@@ -0,0 +1,112 @@
+/**
+ * @brief Streams a simulation as Chrome trace-event JSON, viewable in Perfetto or chrome://tracing.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "waos/core/Process.h"
+#include "waos/core/TimeSeriesRecorder.h"
+
+namespace waos::core {
+
+/**
+ * @class ChromeTraceWriter
+ * @brief Writes trace events as the run proceeds, one JSON object per line.
+ *
+ * Track layout:
+ * - "Kernel" (trace pid 0): a CPU thread with one span per stretch of
+ *   idle, context-switch or busy ticks ("P<pid>" when a process ran), and
+ *   counter tracks for ready, blocked and memory-wait lengths and used frames.
+ * - "Processes" (trace pid 1): one thread per process (tid = PID) with
+ *   READY/RUNNING/BLOCKED/WAITING_MEMORY spans.
+ *
+ * Spans are complete ("X") events written when they close, so memory stays
+ * proportional to the number of processes, not to the run length. Counters
+ * are written only when a value changes. A trace cut short (crash, kill)
+ * lacks the closing bracket, which both viewers accept.
+ *
+ * Not thread-safe; the owning Simulator writes from its tick loop.
+ */
+class ChromeTraceWriter {
+ public:
+  /**
+   * @param out Destination; must outlive the writer.
+   * @param microsPerTick Trace time of one tick (default: a tick shows as 1 ms).
+   */
+  explicit ChromeTraceWriter(std::ostream& out, uint64_t microsPerTick = 1000);
+
+  /**
+   * @throws std::runtime_error If the file cannot be created.
+   */
+  explicit ChromeTraceWriter(const std::string& path, uint64_t microsPerTick = 1000);
+
+  ~ChromeTraceWriter();
+
+  ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+  ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+
+  /**
+   * @brief State of a process from `tick` on. Repeating the current state is a no-op;
+   *        NEW and TERMINATED close the open span without opening one.
+   */
+  void processState(int pid, ProcessState state, uint64_t tick);
+
+  /**
+   * @brief What the CPU did during `tick`. Equal consecutive ticks extend one span.
+   * @param pid Process that executed (BUSY only).
+   */
+  void cpuActivity(CpuActivity activity, int pid, uint64_t tick);
+
+  void counters(uint64_t tick, uint32_t ready, uint32_t blocked, uint32_t memoryWait, uint32_t usedFrames);
+
+  /**
+   * @brief Closes every open span at `tick` and terminates the JSON document.
+   *        Later calls are ignored.
+   */
+  void finish(uint64_t tick);
+
+  bool finished() const { return m_finished; }
+  uint64_t eventCount() const { return m_events; }
+
+ private:
+  struct Span {
+    ProcessState state;
+    uint64_t start;
+  };
+
+  struct CpuSpan {
+    CpuActivity activity = CpuActivity::IDLE;
+    int pid = -1;
+    uint64_t start = 0;
+    uint64_t end = 0;  // Exclusive
+    bool open = false;
+  };
+
+  void writeHeader();
+  void writeEvent(const std::string& json);
+  void writeSpan(const char* name, int tracePid, int tid, uint64_t start, uint64_t end);
+  void closeCpuSpan();
+  uint64_t micros(uint64_t tick) const { return tick * m_microsPerTick; }
+
+  std::ofstream m_file;  // Only for the path constructor
+  std::ostream& m_out;
+  uint64_t m_microsPerTick;
+  bool m_finished = false;
+  uint64_t m_events = 0;
+  uint64_t m_lastTick = 0;  // Latest time seen; the destructor closes spans there
+
+  std::unordered_map<int, Span> m_openSpans;  // By PID
+  std::unordered_set<int> m_namedThreads;     // Processes whose track name was written
+  CpuSpan m_cpu;
+  bool m_hasCounters = false;
+  uint32_t m_lastCounters[4] = {0, 0, 0, 0};
+};
+
+}  // namespace waos::core
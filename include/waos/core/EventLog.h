@@ -0,0 +1,217 @@
+/**
+ * @brief Compact binary log of process state transitions, with a reader and a replay cursor.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "waos/common/DataStructures.h"
+#include "waos/core/Process.h"
+
+namespace waos::core {
+
+/**
+ * @brief Why a record was written.
+ */
+enum class TransitionCause : uint8_t {
+  NONE,             ///< Never written: a zeroed record ends a log that was not closed
+  ARRIVAL,          ///< NEW -> READY
+  DISPATCH,         ///< READY -> RUNNING
+  PREEMPTION,       ///< RUNNING -> READY, a better process became ready
+  QUANTUM_EXPIRED,  ///< RUNNING -> READY, time slice used up
+  YIELD,            ///< RUNNING -> READY, a CPU burst followed by another CPU burst
+  IO_REQUEST,       ///< RUNNING -> BLOCKED
+  IO_COMPLETE,      ///< BLOCKED -> READY
+  PAGE_FAULT,       ///< RUNNING/READY -> WAITING_MEMORY (page set)
+  PAGE_LOADED,      ///< WAITING_MEMORY -> READY (page and frame set)
+  EXIT,             ///< RUNNING -> TERMINATED
+  SWITCH_BEGIN,     ///< Context-switch overhead starts; pid: process switched in, or -1. No state change
+  SWITCH_END,       ///< Context-switch overhead ends; pid as in SWITCH_BEGIN. No state change
+};
+
+/**
+ * @struct EventRecord
+ * @brief One transition. Stored as 32 little-endian bytes:
+ *        tick u64, page u64, pid i32, frame i32, old u8, new u8, cause u8, 5 pad bytes.
+ */
+struct EventRecord {
+  uint64_t tick = 0;
+  int pid = -1;
+  ProcessState oldState = ProcessState::NEW;
+  ProcessState newState = ProcessState::NEW;
+  TransitionCause cause = TransitionCause::NONE;
+  waos::common::PageNumber page = waos::common::NO_PAGE;  // Page involved in a fault or load
+  int frame = -1;                                         // Frame the page was loaded into
+};
+
+/**
+ * @struct EventLogOptions
+ */
+struct EventLogOptions {
+  size_t bufferRecords = 4096;  // Records per write (buffered) or per mapping growth step (mapped)
+  bool memoryMapped = false;    // Map the file and encode in place; falls back to buffered where unavailable
+};
+
+/**
+ * @class EventLogWriter
+ * @brief Appends fixed-size records to a file ("WAOSEV01" header + records).
+ *
+ * Buffered mode encodes into a block and writes it when full. Mapped mode
+ * (POSIX) encodes straight into a shared mapping that grows geometrically;
+ * close() trims the file to its records. Either way a log cut short by a
+ * crash stays readable up to the last record that reached the file.
+ *
+ * Not thread-safe; the owning Simulator appends from its tick loop.
+ */
+class EventLogWriter {
+ public:
+  /**
+   * @throws std::runtime_error If the file cannot be created or mapped.
+   */
+  explicit EventLogWriter(const std::string& path, EventLogOptions options = {});
+  ~EventLogWriter();
+
+  EventLogWriter(const EventLogWriter&) = delete;
+  EventLogWriter& operator=(const EventLogWriter&) = delete;
+
+  /**
+   * @brief Appends one record; ignored after close().
+   * @throws std::runtime_error If the mapping cannot grow (the records already appended stay mapped).
+   */
+  void append(const EventRecord& record);
+
+  /**
+   * @brief Hands pending records to the OS (the log stays open).
+   */
+  void flush();
+
+  /**
+   * @brief Flushes, stamps the record count in the header and closes the file. Later calls are ignored.
+   */
+  void close();
+
+  bool closed() const { return m_closed; }
+  bool memoryMapped() const { return m_mapped != nullptr; }
+  uint64_t recordCount() const { return m_records; }
+
+ private:
+  void writeBuffer();
+  void growMapping(size_t bytes);
+  void unmap();
+
+  std::ofstream m_file;       // Buffered mode
+  std::vector<char> m_buffer;
+  size_t m_buffered = 0;      // Bytes pending in m_buffer
+
+  int m_fd = -1;              // Mapped mode
+  char* m_mapped = nullptr;
+  size_t m_capacity = 0;      // Mapped bytes, header included
+
+  EventLogOptions m_options;
+  uint64_t m_records = 0;
+  bool m_closed = false;
+};
+
+/**
+ * @class EventLogReader
+ * @brief Loads a log written by EventLogWriter, in tick order.
+ */
+class EventLogReader {
+ public:
+  /**
+   * @throws std::runtime_error If the file is missing, not an event log or truncated.
+   */
+  explicit EventLogReader(const std::string& path);
+
+  size_t size() const { return m_records.size(); }
+  const EventRecord& at(size_t index) const { return m_records.at(index); }
+  const std::vector<EventRecord>& records() const { return m_records; }
+
+  /**
+   * @brief False if the writer never reached close() (the log ends at the last intact record).
+   */
+  bool complete() const { return m_complete; }
+
+  uint64_t lastTick() const { return m_records.empty() ? 0 : m_records.back().tick; }
+
+  /**
+   * @brief Index of the first record at or after `tick` (size() if none).
+   */
+  size_t lowerBound(uint64_t tick) const;
+
+ private:
+  std::vector<EventRecord> m_records;
+  bool m_complete = false;
+};
+
+/**
+ * @class EventLogReplay
+ * @brief Rebuilds what the simulator exposed to the GUI before each tick, from a log alone.
+ *
+ * seek(t) applies every record stamped before t, which is the state the
+ * Simulator getters report when clockTicked(t) is emitted. Seeking forward
+ * is incremental; seeking backwards replays from the start.
+ *
+ * Ready and blocked lists keep the order processes entered them; a
+ * scheduler that reorders its queue will show a different ready order.
+ */
+class EventLogReplay {
+ public:
+  /**
+   * @param log Must outlive the replay.
+   */
+  explicit EventLogReplay(const EventLogReader& log);
+
+  void seek(uint64_t tick);
+  uint64_t currentTick() const { return m_tick; }
+
+  /**
+   * @brief True once every record has been applied.
+   */
+  bool atEnd() const { return m_next == m_log.size(); }
+
+  ProcessState stateOf(int pid) const;
+  int runningPid() const { return m_runningPid; }  // -1 if none
+  bool isContextSwitching() const { return m_switching; }
+  const std::vector<int>& readyPids() const { return m_ready; }
+  const std::vector<int>& blockedPids() const { return m_blocked; }
+
+  /**
+   * @brief Page loads in progress; ticksRemaining counts down to the load, queueing included.
+   */
+  std::vector<waos::common::MemoryWaitInfo> memoryWaits() const;
+
+  int arrivedProcesses() const { return static_cast<int>(m_states.size()); }
+  int completedProcesses() const { return m_completed; }
+
+ private:
+  struct PendingLoad {
+    int pid;
+    waos::common::PageNumber page;
+    uint64_t loadTick;  // Tick of the matching PAGE_LOADED (0 if the log ends first)
+  };
+
+  void restart();
+  void apply(size_t index);
+
+  const EventLogReader& m_log;
+  std::vector<uint64_t> m_loadTicks;  // Per record: tick its PAGE_FAULT is resolved at
+
+  size_t m_next = 0;
+  uint64_t m_tick = 0;
+  std::unordered_map<int, ProcessState> m_states;
+  int m_runningPid = -1;
+  bool m_switching = false;
+  std::vector<int> m_ready;
+  std::vector<int> m_blocked;
+  std::vector<PendingLoad> m_loading;
+  int m_completed = 0;
+};
+
+}  // namespace waos::core
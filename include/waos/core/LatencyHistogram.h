@@ -0,0 +1,61 @@
+/**
+ * @brief Log-bucketed latency histogram with constant-time record and percentile queries.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+
+/**
+ * @class LatencyHistogram
+ * @brief HDR-style histogram of tick durations.
+ *
+ * Values below 64 get one bucket each (exact). Above that, every power of two
+ * is split into 32 linear sub-buckets, so a bucket is never wider than 1/32 of
+ * its values. 1920 buckets cover the whole uint64_t range in a fixed array.
+ * record() is O(1); percentiles walk the fixed bucket array, which is
+ * independent of how many values were recorded.
+ *
+ * Percentiles report the highest value of the matching bucket, capped at the
+ * recorded maximum, so they never understate the latency.
+ */
+class LatencyHistogram {
+ public:
+  void record(uint64_t value);
+  void clear();
+
+  uint64_t count() const { return m_count; }
+  uint64_t min() const { return m_count ? m_min : 0; }
+  uint64_t max() const { return m_max; }
+  double mean() const;
+
+  /**
+   * @param percentile In [0, 100]; values outside are clamped.
+   * @return Smallest bucket bound such that at least percentile% of the values are not above it (0 if empty).
+   */
+  uint64_t valueAtPercentile(double percentile) const;
+
+  waos::common::LatencyStats summary() const;
+
+ private:
+  static constexpr int SUB_BITS = 5;                       // 32 sub-buckets per power of two
+  static constexpr int EXACT_LIMIT = 2 << SUB_BITS;        // 64: below this each value has its own bucket
+  static constexpr int BUCKETS = EXACT_LIMIT + (64 - SUB_BITS - 1) * (1 << SUB_BITS);
+
+  static int bucketOf(uint64_t value);
+  static uint64_t highestValueIn(int bucket);
+
+  std::array<uint64_t, BUCKETS> m_counts{};
+  uint64_t m_count = 0;
+  uint64_t m_min = 0;
+  uint64_t m_max = 0;
+  uint64_t m_sum = 0;         // Exact for any realistic run length
+  int m_highestBucket = -1;   // Percentile scans stop here
+};
+
+}  // namespace waos::core
@@ -11,6 +11,7 @@
 #include <queue>
 #include <cstdint>
 #include <optional>
+#include <map>
 #include "waos/core/Process.h"
 
 namespace waos::core {
@@ -26,8 +27,24 @@ namespace waos::core {
     int pid;
     uint64_t arrivalTime;
     int priority;
-    int requiredPages;
+    waos::common::PageNumber requiredPages;
     std::queue<Burst> bursts;
+    std::vector<SharedMapping> sharedMappings;
+    int tickets = 0;  // TICKETS(n); 0 = derived from priority
+
+    // Real-time parameters (0 = none)
+    uint64_t deadline = 0;  // DEADLINE(d): relative to each release; defaults to the period
+    uint64_t period = 0;    // PERIOD(p): a new job is released every p ticks
+    int jobs = 1;           // JOBS(n): releases of a periodic task
+  };
+
+  /**
+   * @struct SharedRegionInfo
+   * @brief A shared memory region declared with a `REGION <name> <pages>` line.
+   */
+  struct SharedRegionInfo {
+    int regionId;
+    waos::common::PageNumber pageCount;
   };
 
   /**
@@ -50,10 +67,36 @@ namespace waos::core {
      * @brief Parses a single line from the process file.
      * @param line The string line to parse.
      * @param lineNumber The line number in the file, for error reporting.
+     * @param regions Shared regions declared so far, by name.
      * @return An std::optional containing ProcessInfo if parsing is successful,
      *         otherwise an empty optional.
      */
-    static std::optional<ProcessInfo> parseLine(const std::string& line, int lineNumber);
+    static std::optional<ProcessInfo> parseLine(const std::string& line, int lineNumber,
+                                                const std::map<std::string, SharedRegionInfo>& regions);
+
+    /**
+     * @brief Parses a `REGION <name> <pages>` declaration into the region table.
+     */
+    static void parseRegion(const std::string& line, int lineNumber,
+                            std::map<std::string, SharedRegionInfo>& regions);
+
+    /**
+     * @brief Parses a trailing `SHM(name@page)` or `COW(name@page)` mapping token.
+     */
+    static std::optional<SharedMapping> parseSharedMapping(const std::string& token, int lineNumber,
+                                                           const std::map<std::string, SharedRegionInfo>& regions);
+
+    /**
+     * @brief Parses a trailing `NAME(n)` token with a positive integer (TICKETS, DEADLINE, PERIOD, JOBS).
+     * @return The value, or an empty optional (with a warning) if it is not a positive integer.
+     */
+    static std::optional<int> parseCountToken(const std::string& token, int lineNumber);
+
+    /**
+     * @brief Parses a non-negative page number or page count (up to 64 bits).
+     * @return The value, or an empty optional if the text is not a whole non-negative number.
+     */
+    static std::optional<waos::common::PageNumber> parsePageNumber(const std::string& text);
   };
 
 }
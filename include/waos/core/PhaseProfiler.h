@@ -0,0 +1,122 @@
+/**
+ * @brief Scoped timers and call counters for the phases of Simulator::step.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+// Compile-time gate: build with WAOS_PROFILE_ENABLED=0 (CMake option WAOS_ENABLE_PROFILING=OFF)
+// to remove every profiling scope from the binary.
+#ifndef WAOS_PROFILE_ENABLED
+#define WAOS_PROFILE_ENABLED 1
+#endif
+
+namespace waos::core {
+
+/**
+ * @brief Timed section. Scopes nest, so totals are inclusive: STEP contains
+ *        every phase, and SCHEDULER_CALL/MEMORY_CALL time is also counted in
+ *        the phase that made the call.
+ */
+enum class ProfilePhase : uint8_t {
+  STEP,            ///< Whole Simulator::step
+  IO,              ///< handleIO
+  PAGE_FAULTS,     ///< handlePageFaults
+  CPU_EXECUTION,   ///< handleCpuExecution
+  ARRIVALS,        ///< handleArrivals
+  SCHEDULING,      ///< handleScheduling
+  METRICS,         ///< updateMetrics
+  SCHEDULER_CALL,  ///< Any IScheduler call made by the simulator
+  MEMORY_CALL,     ///< Any IMemoryManager call made by the simulator
+  COUNT
+};
+
+/**
+ * @struct PhaseStats
+ * @brief Aggregate of every timed call to one phase.
+ */
+struct PhaseStats {
+  uint64_t calls = 0;
+  uint64_t totalNs = 0;
+  uint64_t minNs = 0;
+  uint64_t maxNs = 0;
+
+  double meanNs() const { return calls ? static_cast<double>(totalNs) / static_cast<double>(calls) : 0.0; }
+};
+
+/**
+ * @class PhaseProfiler
+ * @brief Process-wide per-phase totals, min and max, measured with steady_clock.
+ *
+ * Runtime gate: disabled by default; enabled with setEnabled(true) or by
+ * setting the WAOS_PROFILE environment variable to a non-zero value. Use the
+ * WAOS_PROFILE_SCOPE macro so a disabled build costs nothing and a disabled
+ * run costs one relaxed atomic load per scope.
+ *
+ * Counters are relaxed atomics: the simulator thread records while the GUI
+ * may read. When enabled, the totals are written to stderr at process exit.
+ */
+class PhaseProfiler {
+ public:
+  static bool enabled();
+  static void setEnabled(bool enabled);
+
+  static void record(ProfilePhase phase, uint64_t nanoseconds);
+  static PhaseStats stats(ProfilePhase phase);
+  static void reset();
+
+  static const char* phaseName(ProfilePhase phase);
+
+  /**
+   * @brief One line per phase that was called: calls, total, mean, min and max.
+   */
+  static void dump(std::ostream& out);
+
+  /**
+   * @class Scope
+   * @brief Times its own lifetime into a phase, if profiling was enabled when it started.
+   */
+  class Scope {
+   public:
+    explicit Scope(ProfilePhase phase) : m_phase(phase), m_active(enabled()) {
+      if (m_active) m_start = std::chrono::steady_clock::now();
+    }
+    ~Scope() {
+      if (!m_active) return;
+      auto elapsed = std::chrono::steady_clock::now() - m_start;
+      record(m_phase, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    ProfilePhase m_phase;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+  };
+};
+
+}  // namespace waos::core
+
+#define WAOS_PROFILE_CONCAT_INNER(a, b) a##b
+#define WAOS_PROFILE_CONCAT(a, b) WAOS_PROFILE_CONCAT_INNER(a, b)
+
+// WAOS_PROFILE_SCOPE(PHASE) times the rest of the enclosing block;
+// WAOS_PROFILE_CALL(PHASE, expr) times one expression and yields its value.
+#if WAOS_PROFILE_ENABLED
+#define WAOS_PROFILE_SCOPE(phase) \
+  ::waos::core::PhaseProfiler::Scope WAOS_PROFILE_CONCAT(waosProfileScope, __LINE__)(::waos::core::ProfilePhase::phase)
+#define WAOS_PROFILE_CALL(phase, ...) \
+  ([&]() -> decltype(auto) {          \
+    WAOS_PROFILE_SCOPE(phase);        \
+    return __VA_ARGS__;               \
+  }())
+#else
+#define WAOS_PROFILE_SCOPE(phase) \
+  do {                            \
+  } while (0)
+#define WAOS_PROFILE_CALL(phase, ...) (__VA_ARGS__)
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @brief Name-based registry of scheduler and memory-manager factories, with plugin loading.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "waos/memory/IMemoryManager.h"
+#include "waos/scheduler/IScheduler.h"
+
+namespace waos::core {
+
+/**
+ * @struct PolicyParameter
+ * @brief One integer parameter accepted by a policy factory.
+ */
+struct PolicyParameter {
+  std::string name;         // Key in PolicyArguments::values, e.g. "quantum"
+  std::string description;  // Shown in front-ends
+  int defaultValue = 0;
+  int minValue = 0;
+  int maxValue = 1 << 30;
+};
+
+/**
+ * @struct PolicyDescriptor
+ * @brief Registered name and parameter schema of a policy.
+ */
+struct PolicyDescriptor {
+  std::string name;  // Unique per kind, e.g. "Round Robin" or "LRU"
+  std::string description;
+  std::vector<PolicyParameter> parameters;
+};
+
+/**
+ * @struct PolicyArguments
+ * @brief Inputs handed to a factory.
+ *
+ * The registry resolves `values` against the descriptor before calling the
+ * factory: every declared parameter is present (default if not supplied) and
+ * in range. Undeclared keys are passed through untouched.
+ */
+struct PolicyArguments {
+  const uint64_t* clockRef = nullptr;  // Simulation clock (Simulator::getClockRef())
+  std::map<std::string, int> values;
+
+  /**
+   * @brief Value of a parameter, or fallback if absent.
+   */
+  int get(const std::string& name, int fallback = 0) const;
+};
+
+using SchedulerFactory = std::function<std::unique_ptr<waos::scheduler::IScheduler>(const PolicyArguments&)>;
+using MemoryManagerFactory = std::function<std::unique_ptr<waos::memory::IMemoryManager>(const PolicyArguments&)>;
+
+class PolicyRegistry;
+
+/**
+ * @brief Entry point a plugin library exports with C linkage:
+ *        `extern "C" void waosRegisterPlugin(waos::core::PolicyRegistry& registry)`.
+ */
+using PluginEntryPoint = void (*)(PolicyRegistry&);
+constexpr const char* PLUGIN_ENTRY_SYMBOL = "waosRegisterPlugin";
+
+/**
+ * @class PolicyRegistry
+ * @brief Maps policy names to factories, so front-ends need no per-policy code.
+ *
+ * Built-in policies register through waos::scheduler::registerBuiltinSchedulers()
+ * and waos::memory::registerBuiltinMemoryManagers(); extra policies come from
+ * shared libraries loaded with loadPlugin()/loadPluginDirectory(). Plugins must
+ * be built against the same headers and compiler as the simulator, and stay
+ * loaded until the process exits (their factories live in the library).
+ *
+ * Registration and creation are thread-safe. Registering an existing name
+ * replaces it, so a plugin can override a built-in policy.
+ */
+class PolicyRegistry {
+ public:
+  /**
+   * @brief Process-wide registry used by the GUI and by plugins.
+   */
+  static PolicyRegistry& instance();
+
+  void registerScheduler(PolicyDescriptor descriptor, SchedulerFactory factory);
+  void registerMemoryManager(PolicyDescriptor descriptor, MemoryManagerFactory factory);
+
+  /**
+   * @throws std::invalid_argument If the name is unknown or a parameter is out of range.
+   */
+  std::unique_ptr<waos::scheduler::IScheduler> createScheduler(const std::string& name,
+                                                               const PolicyArguments& args) const;
+  std::unique_ptr<waos::memory::IMemoryManager> createMemoryManager(const std::string& name,
+                                                                    const PolicyArguments& args) const;
+
+  bool hasScheduler(const std::string& name) const;
+  bool hasMemoryManager(const std::string& name) const;
+
+  // Registered descriptors, in registration order
+  std::vector<PolicyDescriptor> schedulers() const;
+  std::vector<PolicyDescriptor> memoryManagers() const;
+
+  /**
+   * @brief Loads one shared library and calls its waosRegisterPlugin entry point.
+   * @return false if the library or the entry point cannot be loaded (see lastPluginError()).
+   */
+  bool loadPlugin(const std::string& path);
+
+  /**
+   * @brief Loads every shared library (.so, .dylib, .dll) in a directory, in name order.
+   * @return Number of plugins loaded. A missing directory loads nothing.
+   */
+  int loadPluginDirectory(const std::string& directory);
+
+  std::string lastPluginError() const;
+
+ private:
+  template <typename Factory>
+  struct Entry {
+    PolicyDescriptor descriptor;
+    Factory factory;
+  };
+
+  template <typename Factory>
+  using Table = std::vector<Entry<Factory>>;  // Few entries: linear lookup keeps registration order
+
+  template <typename Factory>
+  static const Entry<Factory>* find(const Table<Factory>& table, const std::string& name);
+
+  static PolicyArguments resolve(const PolicyDescriptor& descriptor, const PolicyArguments& args);
+
+  mutable std::mutex m_mutex;
+  Table<SchedulerFactory> m_schedulers;
+  Table<MemoryManagerFactory> m_memoryManagers;
+  std::vector<void*> m_pluginHandles;  // Never closed: factories point into the libraries
+  std::string m_lastPluginError;
+};
+
+}  // namespace waos::core
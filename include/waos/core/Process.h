@@ -15,6 +15,8 @@
 #include <atomic>
 #include <string>
 
+#include "waos/common/DataStructures.h"
+
 namespace waos::core {
 
   /**
@@ -48,12 +50,24 @@ namespace waos::core {
     int duration;
   };
 
+  /**
+   * @struct SharedMapping
+   * @brief Maps a shared memory region into a range of the process's virtual pages.
+   */
+  struct SharedMapping {
+    int regionId;                        // Region identifier (assigned by the Parser)
+    waos::common::PageNumber firstPage;  // First virtual page of the mapping in this process
+    waos::common::PageNumber pageCount;  // Number of pages mapped
+    bool copyOnWrite;                    // true: private on first write (fork-like), false: shared read/write
+  };
+
   /**
    * @struct ProcessStats
    * @brief A container for collecting performance metrics for a single process.
    */
   struct ProcessStats {
-    uint64_t startTime = 0;
+    uint64_t startTime = 0;      // First dispatch (valid once hasStarted)
+    bool hasStarted = false;
     uint64_t finishTime = 0;     
     uint64_t totalWaitTime = 0;
     uint64_t totalCpuTime = 0;
@@ -73,6 +87,11 @@ namespace waos::core {
    */
   class Process {
   public:
+    /**
+     * @brief Share of generated references that write their page (drives dirty bits and copy-on-write).
+     */
+    static constexpr double WRITE_RATIO = 0.3;
+
     /**
      * @brief Constructs a new Process instance.
      * @param pid The unique process identifier.
@@ -81,7 +100,8 @@ namespace waos::core {
      * @param cpuBursts A queue of CPU burst durations.
      * @param requiredPages The number of memory pages this process requires.
      */
-    Process(int pid, uint64_t arrivalTime, int priority, std::queue<Burst> bursts, int requiredPages);
+    Process(int pid, uint64_t arrivalTime, int priority, std::queue<Burst> bursts,
+            waos::common::PageNumber requiredPages);
     ~Process(); // Destructor to join thread
 
     /**
@@ -111,7 +131,7 @@ namespace waos::core {
     int getPid() const;
     uint64_t getArrivalTime() const;
     int getPriority() const; // Lower value = Higher priority
-    int getRequiredPages() const;
+    waos::common::PageNumber getRequiredPages() const;
 
     ProcessStats getStats() const;
     ProcessState getState() const;
@@ -123,6 +143,7 @@ namespace waos::core {
      * @brief Removes the current finished burst and moves to the next.
      */
     void advanceToNextBurst();
+    int getCpuTicksInBurst() const; // CPU ticks executed in the current burst so far
     bool hasMoreBursts() const;
 
     /**
@@ -137,13 +158,46 @@ namespace waos::core {
      * @brief Gets the page number the process needs to access in the current CPU tick.
      * @return The virtual page number (0 to requiredPages - 1).
      */
-    int getCurrentPageRequirement() const;
+    waos::common::PageNumber getCurrentPageRequirement() const;
 
     /**
      * @brief Gets the complete page reference string for this process.
      * @return Const reference to the vector of page references.
      */
-    const std::vector<int>& getPageReferenceString() const;
+    const std::vector<waos::common::PageNumber>& getPageReferenceString() const;
+
+    /**
+     * @brief Whether the memory access of the current CPU tick is a write.
+     * Generated deterministically alongside the page reference string.
+     */
+    bool isCurrentAccessWrite() const;
+
+    // Shared memory regions mapped into this process
+    void setSharedMappings(std::vector<SharedMapping> mappings);
+    const std::vector<SharedMapping>& getSharedMappings() const;
+
+    /**
+     * @brief Sets the proportional-share tickets (workload TICKETS(n) column).
+     * @param tickets Positive ticket count, or 0 to derive it from the priority.
+     */
+    void setTickets(int tickets);
+
+    /**
+     * @brief Tickets for lottery/stride scheduling.
+     * Explicit tickets if set; otherwise 100 / (priority + 1), at least 1
+     * (priority 0 -> 100, 1 -> 50, 9 -> 10).
+     */
+    int getTickets() const;
+
+    // Real-time parameters (0 = none). A periodic task is released as one Process per job.
+    void setDeadline(uint64_t relativeDeadline);
+    uint64_t getRelativeDeadline() const;
+    bool hasDeadline() const;
+    uint64_t getAbsoluteDeadline() const;  // Arrival + relative deadline; UINT64_MAX without deadline
+    void setPeriod(uint64_t period);
+    uint64_t getPeriod() const;
+    void setTaskId(int taskId);
+    int getTaskId() const;  // PID of the task's first job (own PID if not periodic)
 
     // Quantum Management
     int getQuantumUsed() const;
@@ -163,15 +217,22 @@ namespace waos::core {
     uint64_t m_arrivalTime;
     int m_priority;
     std::queue<Burst> m_bursts;
-    int m_requiredPages;
+    waos::common::PageNumber m_requiredPages;
 
     int m_quantumUsed;
+    int m_cpuTicksInBurst;
     ProcessStats m_stats;
     std::atomic<ProcessState> m_state; // Atomic for thread safety
 
     // Memory Simulation Internal Data
-    std::vector<int> m_pageReferenceString;
+    std::vector<waos::common::PageNumber> m_pageReferenceString;
+    std::vector<bool> m_writeReferenceString;  // Parallel to m_pageReferenceString
     size_t m_instructionPointer;
+    std::vector<SharedMapping> m_sharedMappings;
+    int m_tickets = 0;  // 0: derived from priority
+    uint64_t m_relativeDeadline = 0;
+    uint64_t m_period = 0;
+    int m_taskId = -1;  // -1: same as m_pid
 
     // Threading Infrastructure
     std::thread m_thread;
@@ -7,15 +7,24 @@
 #pragma once
 
 #include <QObject>
+#include <functional>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <queue>
+#include <unordered_set>
 #include <vector>
 
 #include "waos/common/DataStructures.h"
+#include "waos/core/ChromeTraceWriter.h"
 #include "waos/core/Clock.h"
+#include "waos/core/EventLog.h"
+#include "waos/core/LatencyHistogram.h"
+#include "waos/core/Parser.h"
 #include "waos/core/Process.h"
 #include "waos/core/SystemMonitor.h"
+#include "waos/core/TimeSeriesRecorder.h"
 #include "waos/memory/IMemoryManager.h"
 #include "waos/scheduler/IScheduler.h"
 
@@ -55,6 +64,28 @@ class Simulator : public QObject {
    */
   void setMemoryManager(std::unique_ptr<waos::memory::IMemoryManager> memoryManager);
 
+  /**
+   * @brief Records queue lengths, CPU activity and memory pressure every tick.
+   * @param recorder Ownership of the recorder; nullptr stops recording. Cleared on reset().
+   */
+  void setTimeSeriesRecorder(std::unique_ptr<TimeSeriesRecorder> recorder);
+  const TimeSeriesRecorder* getTimeSeriesRecorder() const;
+
+  /**
+   * @brief Streams process states, CPU activity and queue counters as trace events.
+   * @param writer Ownership of the writer; nullptr stops exporting. The trace is
+   *        finished when every process terminates, on reset() or when the writer is destroyed.
+   */
+  void setTraceWriter(std::unique_ptr<ChromeTraceWriter> writer);
+  const ChromeTraceWriter* getTraceWriter() const;
+
+  /**
+   * @brief Appends every state transition and context switch to a binary log for offline replay.
+   * @param log Ownership of the writer; nullptr stops logging. Flushed on stop(), closed on reset().
+   */
+  void setEventLog(std::unique_ptr<EventLogWriter> log);
+  const EventLogWriter* getEventLog() const;
+
   // Simulation
   void start();
   void stop();
@@ -73,6 +104,19 @@ class Simulator : public QObject {
   std::vector<waos::common::MemoryWaitInfo> getMemoryWaitQueue() const;
   std::vector<const Process*> getReadyProcesses() const;
 
+  /**
+   * @brief Visits the ready queue in order without copying it.
+   * The visitor runs under the scheduler's lock and must not call back into the simulator.
+   */
+  void forEachReadyProcess(const waos::scheduler::IScheduler::ReadyVisitor& visit) const;
+
+  /**
+   * @brief Ready-queue change counter, monotonic across scheduler swaps.
+   * Observers re-read the queue only when it differs from the last value seen;
+   * 0 means the scheduler does not track changes (always re-read).
+   */
+  uint64_t getReadyQueueVersion() const;
+
   waos::common::SimulatorMetrics getSimulatorMetrics() const;
   std::string getSchedulerAlgorithmName() const;
   std::string getMemoryAlgorithmName() const;
@@ -85,6 +129,8 @@ class Simulator : public QObject {
   std::vector<waos::common::FrameInfo> getFrameStatus() const;
   std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int processId) const;
   waos::common::MemoryStats getMemoryStats() const;
+  std::vector<waos::common::FaultWindowInfo> getFaultTimeline(uint64_t fromTick, uint64_t toTick) const;
+  waos::common::ProcessFaultRate getProcessFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const;
 
   // Getters for validation in tests
   uint64_t getCurrentTime() const;
@@ -132,6 +178,7 @@ class Simulator : public QObject {
  private:
   Clock m_clock;
   std::unique_ptr<waos::scheduler::IScheduler> m_scheduler;
+  uint64_t m_readyVersionOffset = 0;  // Versions consumed by previous schedulers
   std::unique_ptr<waos::memory::IMemoryManager> m_memoryManager;
 
   SystemMonitor m_systemMonitor;
@@ -142,6 +189,14 @@ class Simulator : public QObject {
   // Separate container for processes that haven't arrived yet (Waiting to arrive)
   std::vector<Process*> m_incomingProcesses;
 
+  // Periodic tasks: each job is a new Process, released when the previous job arrives
+  struct PeriodicTask {
+    ProcessInfo info;
+    int remainingJobs;  // Jobs not yet created
+  };
+  std::map<int, PeriodicTask> m_periodicTasks;  // By task id (PID of the first job)
+  int m_nextJobPid = 0;
+
   // Queue for processes blocked by I/O (The simulator manages I/O waits)
   std::vector<Process*> m_blockedQueue;
 
@@ -149,7 +204,7 @@ class Simulator : public QObject {
   struct InternalMemoryWait {
     Process* process;
     int ticksRemaining;
-    int pageNumber;
+    waos::common::PageNumber pageNumber;
   };
   std::list<InternalMemoryWait> m_memoryWaitQueue;
 
@@ -166,10 +221,41 @@ class Simulator : public QObject {
   int m_totalContextSwitches;
   waos::common::SimulatorMetrics m_metrics;
 
+  // Totals over terminated processes: updated once per termination, averaged on read
+  struct CompletionTotals {
+    int completed = 0;
+    uint64_t waitSum = 0;
+    uint64_t turnaroundSum = 0;
+    int deadlineJobs = 0;  // Released jobs with a deadline
+    int finishedDeadlineJobs = 0;
+    int lateFinished = 0;  // Finished after their deadline
+    int64_t latenessSum = 0;
+    int64_t maxLateness = 0;
+    int serviceShares = 0;  // CPU time / turnaround per process, for Jain's fairness index
+    double serviceShareSum = 0.0;
+    double serviceShareSquares = 0.0;
+  };
+  CompletionTotals m_completion;
+
+  // Latency distributions of terminated processes (percentiles on read)
+  LatencyHistogram m_waitHistogram;
+  LatencyHistogram m_responseHistogram;
+  LatencyHistogram m_turnaroundHistogram;
+
+  // Released, unfinished deadline jobs by deadline; each is examined once when it passes
+  using PendingDeadline = std::pair<uint64_t, const Process*>;
+  std::priority_queue<PendingDeadline, std::vector<PendingDeadline>, std::greater<PendingDeadline>> m_pendingDeadlines;
+  std::unordered_set<const Process*> m_overdueJobs;  // Unfinished and past their deadline
+
+  std::unique_ptr<TimeSeriesRecorder> m_timeSeries;  // Optional; sampled at the end of step()
+  std::unique_ptr<ChromeTraceWriter> m_traceWriter;  // Optional; states from changeState(), the rest after step()
+  std::unique_ptr<EventLogWriter> m_eventLog;        // Optional; appended on every transition
+
   bool m_isRunning;
   mutable std::recursive_mutex m_simulationMutex;  // Recursive to allow signal-slot re-entry
 
   int m_pageFaultPenalty;
+  int m_copyOnWritePenalty;  // Ticks to copy a shared page on write (in-memory)
   int m_contextSwitchDuration;
   bool m_needsContextSwitchOverhead;  // Flag to determine if CS overhead is needed
 
@@ -177,17 +263,35 @@ class Simulator : public QObject {
   void step();
 
   // Helpers to simulation
+  Process* createProcess(const ProcessInfo& info, int pid, uint64_t arrivalTime);
+  void releaseNextJob(const Process* job);  // Queues the next job of a periodic task, if any
   void handleArrivals();
   void handleIO();
   void handlePageFaults();
   void handleCpuExecution();
+  int faultPenalty(waos::memory::PageRequestResult result) const;
+  void checkPreemption(Process* readied);  // Asks the scheduler after a READY transition
   void handleScheduling();
 
-  // Helper to initiate context switch
-  void triggerContextSwitch(Process* current, Process* next);
+  // Helper to initiate context switch; cause explains why current leaves the CPU
+  void triggerContextSwitch(Process* current, Process* next, TransitionCause cause);
+
+  // Sets the state, notifies the GUI and appends to the event log (page and frame: PAGE_FAULT / PAGE_LOADED)
+  void changeState(Process* p, ProcessState state, TransitionCause cause,
+                   waos::common::PageNumber page = waos::common::NO_PAGE, int frame = -1);
+  void logSwitch(TransitionCause cause, const Process* next);  // SWITCH_BEGIN / SWITCH_END
+
+  // Throws std::invalid_argument if the memory manager cannot address requiredPages
+  void checkAddressSpace(int pid, waos::common::PageNumber requiredPages) const;
 
-  // Internal helper to refresh metric struct
+  // Internal helper to refresh metric struct: O(1) amortised per tick
   void updateMetrics();
+  void recordRelease(const Process* p);     // Deadline bookkeeping when a job arrives
+  void recordCompletion(const Process* p);  // Folds a terminated process into the totals
+  void clearCompletionTotals();
+  TickSample sampleTick(uint64_t now, bool switching, uint64_t activeBefore, int faultsBefore,
+                        int switchesBefore) const;
+  void writeTraceEvents(const TickSample& sample, int ranPid);  // ranPid: process executed this tick, or -1
 
   // Returns true if I/O burst finished in this step
   bool processIoStep(Process* p);
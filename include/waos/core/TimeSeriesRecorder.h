@@ -0,0 +1,183 @@
+/**
+ * @brief Columnar per-tick time series of queue lengths, CPU activity and memory pressure.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+namespace waos::core {
+
+/**
+ * @brief What the CPU did during one tick.
+ */
+enum class CpuActivity : uint8_t {
+  IDLE,
+  BUSY,            ///< A user process executed
+  CONTEXT_SWITCH,  ///< Kernel switch overhead
+};
+
+/**
+ * @struct TickSample
+ * @brief State of the simulator at the end of one tick.
+ */
+struct TickSample {
+  uint64_t tick = 0;
+  uint32_t ready = 0;        // Ready-queue length
+  uint32_t blocked = 0;      // Processes waiting for I/O
+  uint32_t memoryWait = 0;   // Processes waiting for a page load
+  uint32_t usedFrames = 0;   // Frames holding a page
+  CpuActivity cpu = CpuActivity::IDLE;
+  uint32_t pageFaults = 0;       // Faults raised during this tick
+  uint32_t contextSwitches = 0;  // Switches started during this tick
+};
+
+/**
+ * @brief Columns of the recorded series, in export order.
+ *
+ * Each row covers SPAN ticks starting at TICK. Gauges (READY..USED_FRAMES) are
+ * reduced over the span with the configured GaugeReduction; CPU_* columns count
+ * ticks of each activity and PAGE_FAULTS/SWITCHES are totals over the span.
+ */
+enum class SeriesColumn : uint8_t {
+  TICK,
+  SPAN,
+  READY,
+  BLOCKED,
+  MEMORY_WAIT,
+  USED_FRAMES,
+  CPU_BUSY,
+  CPU_IDLE,
+  CPU_SWITCH,
+  PAGE_FAULTS,
+  SWITCHES,
+  COUNT
+};
+
+/**
+ * @brief How gauge columns are reduced when a row covers several ticks.
+ */
+enum class GaugeReduction : uint8_t {
+  MEAN,  ///< Rounded average over the span
+  MAX,   ///< Peak over the span (keeps short spikes visible)
+  LAST,  ///< Value at the end of the span
+};
+
+/**
+ * @struct TimeSeriesConfig
+ * @brief Downsampling policy and storage layout of a TimeSeriesRecorder.
+ */
+struct TimeSeriesConfig {
+  uint64_t interval = 1;                          // Ticks per row (1 = every tick)
+  GaugeReduction reduction = GaugeReduction::MEAN;
+  size_t maxRows = 0;                             // 0 = unbounded; else adjacent rows merge and interval doubles when full
+  size_t chunkRows = 4096;                        // Rows per preallocated column chunk
+};
+
+/**
+ * @class TimeSeriesRecorder
+ * @brief Append-only columnar store of TickSample rows with downsampling.
+ *
+ * Every column lives in fixed-size chunks reserved up front, so recording a
+ * tick never moves earlier data and costs O(1); growing allocates one chunk
+ * per column every chunkRows rows. With maxRows set, memory is bounded: when
+ * the store is full, pairs of rows merge (gauges with the same reduction,
+ * counters added) and the interval doubles, so a million-tick run keeps a
+ * uniform resolution over the whole run.
+ *
+ * Exports: CSV with a header line, and a binary columnar file (see writeBinary).
+ * Not thread-safe; the owning Simulator records from its tick loop.
+ */
+class TimeSeriesRecorder {
+ public:
+  static constexpr size_t COLUMN_COUNT = static_cast<size_t>(SeriesColumn::COUNT);
+  using Row = std::array<uint64_t, COLUMN_COUNT>;  // Indexed by SeriesColumn
+
+  /**
+   * @throws std::invalid_argument If interval or chunkRows is 0, or maxRows is 1.
+   */
+  explicit TimeSeriesRecorder(TimeSeriesConfig config = TimeSeriesConfig());
+
+  void record(const TickSample& sample);
+
+  /**
+   * @brief Closes the partially filled window as a (shorter) row.
+   */
+  void flush();
+
+  void clear();
+
+  size_t rowCount() const;
+  uint64_t interval() const;  // Current ticks per row (grows when maxRows merges rows)
+  uint64_t value(size_t row, SeriesColumn column) const;
+  Row row(size_t index) const;
+  const TimeSeriesConfig& config() const;
+
+  static const char* columnName(SeriesColumn column);
+
+  /**
+   * @brief One header line, then one line per row.
+   */
+  void writeCsv(std::ostream& out) const;
+
+  /**
+   * @brief Binary columnar export, all integers little-endian:
+   *
+   *     "WAOSTS01"  u32 columnCount  u64 rowCount  u64 interval
+   *     per column: u8 byteWidth  u8 nameLength  name
+   *     per column: rowCount values of byteWidth bytes (TICK is 8 bytes, the rest 4)
+   */
+  void writeBinary(std::ostream& out) const;
+
+  /**
+   * @brief Reads a file written by writeBinary().
+   * @throws std::runtime_error On a malformed or truncated stream.
+   */
+  static std::vector<Row> readBinary(std::istream& in);
+
+ private:
+  static constexpr size_t GAUGES = 4;  // READY, BLOCKED, MEMORY_WAIT, USED_FRAMES
+
+  template <typename T>
+  class ChunkedColumn {
+   public:
+    void push(T value, size_t chunkRows);
+    T at(size_t index) const;
+    void set(size_t index, T value);
+    void truncate(size_t size);
+    void clear();
+    size_t size() const { return m_size; }
+
+   private:
+    std::vector<std::unique_ptr<T[]>> m_chunks;
+    size_t m_chunkRows = 0;
+    size_t m_size = 0;
+  };
+
+  struct Window {
+    uint64_t start = 0;
+    uint64_t ticks = 0;
+    std::array<uint64_t, GAUGES> sum{};
+    std::array<uint32_t, GAUGES> max{};
+    std::array<uint32_t, GAUGES> last{};
+    std::array<uint32_t, 3> cpu{};  // Indexed by CpuActivity
+    uint64_t pageFaults = 0;
+    uint64_t switches = 0;
+  };
+
+  void appendRow(const Row& row);
+  void halve();  // Merges row pairs and doubles the interval
+  uint32_t reduce(uint64_t sum, uint32_t max, uint32_t last, uint64_t ticks) const;
+
+  TimeSeriesConfig m_config;
+  uint64_t m_interval;
+  Window m_window;
+  ChunkedColumn<uint64_t> m_ticks;
+  std::array<ChunkedColumn<uint32_t>, COLUMN_COUNT - 1> m_columns;  // SPAN onwards
+};
+
+}  // namespace waos::core
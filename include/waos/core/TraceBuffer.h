@@ -0,0 +1,111 @@
+/**
+ * @brief Low-overhead structured tracing for scheduler and memory hot paths.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Compile-time gate: build with WAOS_TRACE_ENABLED=0 (CMake option WAOS_ENABLE_TRACE=OFF)
+// to remove every trace point from the binary.
+#ifndef WAOS_TRACE_ENABLED
+#define WAOS_TRACE_ENABLED 1
+#endif
+
+namespace waos::core {
+
+/**
+ * @brief Kind of traced event. The meaning of arg0/arg1 depends on the event.
+ */
+enum class TraceEvent : uint16_t {
+  ENQUEUE,       ///< Process added to a ready structure. arg0: ordering key (-1 if none)
+  DISPATCH,      ///< Process selected to run. arg0: ordering key (-1 if none)
+  DEMOTE,        ///< Process moved to a lower queue level. arg0: new level
+  BOOST,         ///< Priority boost of every process. arg0: tick
+  LOTTERY_DRAW,  ///< Lottery winner. arg0: winning ticket, arg1: ready tickets
+  PAGE_LOADED,   ///< Page fault resolved. arg0: page, arg1: frame
+  PAGE_EVICTED,  ///< Page evicted from a frame. arg0: page, arg1: frame
+};
+
+/**
+ * @struct TraceRecord
+ * @brief Fixed-size binary trace record. `tag` must point to a string literal.
+ */
+struct TraceRecord {
+  uint64_t sequence;  // Global order across threads
+  const char* tag;    // Component, e.g. "FCFS" or "LRU"
+  TraceEvent event;
+  int32_t pid;
+  int64_t arg0;
+  int64_t arg1;
+};
+
+/**
+ * @class TraceBuffer
+ * @brief Per-thread ring buffers of TraceRecord, drained off the hot path.
+ *
+ * record() copies a fixed-size record into the calling thread's ring: no
+ * allocation, formatting, locking or I/O. When a ring is full the oldest
+ * records are overwritten and counted as dropped. drain() collects every
+ * ring in global sequence order; format()/drainTo() turn records into text.
+ * Each slot is guarded by its own sequence counter, so a drain running while
+ * the producer laps it discards the slot instead of reading a torn record.
+ *
+ * Runtime gate: disabled by default; enabled with setEnabled(true) or by
+ * setting the WAOS_TRACE environment variable to a non-zero value. Records
+ * still buffered at exit are written to stderr. Use the WAOS_TRACE macro at
+ * trace points so a disabled build costs nothing and a disabled run costs one
+ * relaxed atomic load.
+ */
+class TraceBuffer {
+ public:
+  static constexpr size_t RING_CAPACITY = 4096;  // Records per thread (power of two)
+
+  static bool enabled();
+  static void setEnabled(bool enabled);
+
+  static void record(const char* tag, TraceEvent event, int pid, int64_t arg0 = -1, int64_t arg1 = -1);
+
+  /**
+   * @brief Removes and returns every buffered record, ordered by sequence.
+   */
+  static std::vector<TraceRecord> drain();
+
+  /**
+   * @brief Drains and writes one formatted line per record.
+   * @return Number of records written.
+   */
+  static size_t drainTo(std::ostream& out);
+
+  static std::string format(const TraceRecord& record);
+  static const char* eventName(TraceEvent event);
+
+  /**
+   * @brief Records overwritten before being drained, since the last clear().
+   */
+  static uint64_t droppedRecords();
+
+  /**
+   * @brief Discards buffered records and resets the dropped counter.
+   */
+  static void clear();
+};
+
+}  // namespace waos::core
+
+// Usage: WAOS_TRACE(tag, event, pid[, arg0[, arg1]]). The pid is part of the variadic
+// pack so the shortest form needs no GNU ##__VA_ARGS__ extension.
+#if WAOS_TRACE_ENABLED
+#define WAOS_TRACE(tag, event, ...)                                                   \
+  do {                                                                                \
+    if (::waos::core::TraceBuffer::enabled())                                         \
+      ::waos::core::TraceBuffer::record(tag, ::waos::core::TraceEvent::event, __VA_ARGS__); \
+  } while (0)
+#else
+#define WAOS_TRACE(tag, event, ...) \
+  do {                              \
+  } while (0)
+#endif
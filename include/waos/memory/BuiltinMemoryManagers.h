@@ -0,0 +1,22 @@
+/**
+ * @brief Registration of the bundled page-replacement policies in the policy registry.
+ */
+
+#pragma once
+
+#include "waos/core/PolicyRegistry.h"
+
+namespace waos::memory {
+
+/**
+ * @brief Registers "FIFO", "LRU" and "Optimal".
+ *
+ * All three accept the same parameters: "frames", "compressedPoolPercent"
+ * (CompressedSwapConfig::poolFraction in percent), "invertedPageTable"
+ * (PageTableMode) and the radix geometry "pageTableLevels", "bitsPerLevel"
+ * and "walkCostPerLevel". A geometry wider than 48 bits is rejected by the
+ * factory with std::invalid_argument.
+ */
+void registerBuiltinMemoryManagers(waos::core::PolicyRegistry& registry);
+
+}  // namespace waos::memory
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "PageKey.h"
+
+namespace waos::memory {
+
+/**
+ * @struct CompressedSwapConfig
+ * @brief Sizing of the optional compressed-RAM swap tier (zswap-like).
+ */
+struct CompressedSwapConfig {
+  double poolFraction = 0.0;      // Share of physical frames given to the pool (0 = disabled)
+  double compressionRatio = 3.0;  // Mean uncompressed/compressed page size
+  int reloadPenalty = 2;          // Ticks to decompress a page back into a frame
+};
+
+/**
+ * @class CompressedSwapPool
+ * @brief Compressed in-memory store for evicted pages, in front of the disk.
+ *
+ * The pool owns a fixed number of frames' worth of bytes. Each stored page
+ * takes its compressed size, drawn deterministically per (pid, page) around
+ * PAGE_BYTES / compressionRatio. When a new page does not fit, the least
+ * recently stored pages are written back to disk. Pages that compress worse
+ * than REJECT_BYTES are sent to disk directly, as zswap does.
+ *
+ * Not thread-safe: the owning memory manager must hold its own mutex.
+ */
+class CompressedSwapPool {
+ public:
+  static constexpr int PAGE_BYTES = 4096;
+  static constexpr int REJECT_BYTES = PAGE_BYTES * 3 / 4;
+
+  explicit CompressedSwapPool(int poolFrames = 0, double compressionRatio = 3.0);
+
+  /**
+   * @brief Frames taken from physical memory for a pool of `poolFraction`.
+   * @throws std::invalid_argument if the fraction is outside [0, 1).
+   */
+  static int framesFor(int totalFrames, double poolFraction);
+
+  bool enabled() const;
+
+  /**
+   * @brief Compresses an evicted page into the pool.
+   * @return false if the page was rejected and goes to disk.
+   */
+  bool store(int processId, uint64_t pageNumber);
+
+  /**
+   * @brief Removes a page from the pool to load it back into a frame.
+   * @return true if the page was in the pool (cheap reload).
+   */
+  bool take(int processId, uint64_t pageNumber);
+
+  bool contains(int processId, uint64_t pageNumber) const;
+  void dropProcess(int processId);
+  void clear();
+
+  int compressedSize(int processId, uint64_t pageNumber) const;
+  int poolFrames() const;
+  int storedPages() const;
+  size_t usedBytes() const;
+  size_t capacityBytes() const;
+  uint64_t writebacks() const;  // Pages pushed out to disk to make room
+  uint64_t rejected() const;    // Pages that did not compress well enough
+
+ private:
+  struct Slot {
+    std::list<PageKey>::iterator lruPosition;
+    int bytes;
+  };
+
+  int m_poolFrames;
+  double m_compressionRatio;
+  size_t m_usedBytes = 0;
+  uint64_t m_writebacks = 0;
+  uint64_t m_rejected = 0;
+
+  std::list<PageKey> m_lru;  // Front = most recently stored
+  std::unordered_map<PageKey, Slot, PageKeyHash> m_slots;
+
+  void erase(std::unordered_map<PageKey, Slot, PageKeyHash>::iterator it);
+};
+
+}  // namespace waos::memory
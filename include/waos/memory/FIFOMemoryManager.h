@@ -1,14 +1,9 @@
 #pragma once
 
 #include <cstdint>
-#include <mutex>
 #include <queue>
-#include <unordered_map>
-#include <vector>
 
-#include "Frame.h"
-#include "IMemoryManager.h"
-#include "PageTable.h"
+#include "PagedMemoryManager.h"
 
 namespace waos::memory {
 
@@ -20,73 +15,37 @@ namespace waos::memory {
  * It maintains a queue of loaded pages and replaces the oldest one when
  * a page fault occurs and there are no free frames.
  */
-class FIFOMemoryManager : public IMemoryManager {
+class FIFOMemoryManager : public PagedMemoryManager {
  public:
   /**
    * @brief Constructs a FIFO Memory Manager.
    * @param totalFrames Total number of physical memory frames available.
    * @param clockRef Pointer to the simulation clock for timestamps.
+   * @param geometry Shape of the page tables (radix or inverted mode).
+   * @param swap Optional compressed swap tier; its frames are taken from totalFrames.
    */
-  explicit FIFOMemoryManager(int totalFrames, const uint64_t* clockRef);
+  explicit FIFOMemoryManager(int totalFrames, const uint64_t* clockRef,
+                             PageTableGeometry geometry = PageTableGeometry(),
+                             CompressedSwapConfig swap = CompressedSwapConfig());
 
   ~FIFOMemoryManager() override = default;
 
-  // IMemoryManager interface implementation
-  bool isPageLoaded(int processId, int pageNumber) const override;
-  PageRequestResult requestPage(int processId, int pageNumber) override;
-  void allocateForProcess(int processId, int requiredPages) override;
-  void freeForProcess(int processId) override;
-  void completePageLoad(int processId, int pageNumber) override;
-
-  // Métodos de Observación para GUI
-  std::vector<waos::common::FrameInfo> getFrameStatus() const override;
-  std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int processId) const override;
-  waos::common::MemoryStats getMemoryStats() const override;
   std::string getAlgorithmName() const override;
-  void reset() override;
-
- private:
-  mutable std::mutex m_mutex;
-
-  // Physical memory simulation
-  std::vector<Frame> m_frames;
-  const uint64_t* m_clockRef;  // Pointer to simulation clock
-
-  // Per-process page tables
-  std::unordered_map<int, PageTable> m_pageTables;
-
-  // FIFO-specific: Queue to track load order
-  std::queue<std::pair<int, int>> m_loadQueue;  // <processId, pageNumber>
-
-  // Statistics
-  waos::common::MemoryStats m_stats;
-  uint64_t m_totalHits = 0;  // Counter for page hits
-
-  /**
-   * @brief Finds a free frame in physical memory.
-   * @return Frame index if found, -1 otherwise.
-   */
-  int findFreeFrame() const;
-
-  /**
-   * @brief Loads a page into a specific frame.
-   * @param processId Process owner.
-   * @param pageNumber Virtual page number.
-   * @param frameIndex Physical frame to use.
-   */
-  void loadPageIntoFrame(int processId, int pageNumber, int frameIndex);
 
+ protected:
   /**
    * @brief Selects a victim frame using FIFO policy.
    * @return Frame index to be replaced.
    */
-  int selectVictimFrame();
+  int selectVictimFrame() override;
 
-  /**
-   * @brief Evicts a page from a frame.
-   * @param frameIndex Frame to evict.
-   */
-  void evictFrame(int frameIndex);
+  void onPageLoaded(int frameIndex) override;
+  void onProcessFreed(int processId) override;
+  void onReset() override;
+
+ private:
+  // FIFO-specific: Queue to track load order
+  std::queue<int> m_loadQueue;  // Frame indices in load order
 };
 
 }  // namespace waos::memory
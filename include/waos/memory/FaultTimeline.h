@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "waos/common/DataStructures.h"
+
+namespace waos::memory {
+
+/**
+ * @class FaultTimeline
+ * @brief Fixed-memory time-series of memory events (faults, hits, replacements).
+ *
+ * Time is split into windows of `windowTicks` ticks. The last `windowCount`
+ * windows are kept in a ring buffer, so memory usage never grows with the
+ * length of the simulation. Per-process fault counts live in a flat array
+ * indexed by (process slot, window), where a slot is assigned to a PID when
+ * the process is allocated and recycled when it is freed.
+ *
+ * This class is not thread-safe: the owning memory manager must hold its own
+ * mutex while calling into it.
+ */
+class FaultTimeline {
+ public:
+  static constexpr int kDefaultWindowTicks = 10;
+  static constexpr int kDefaultWindowCount = 512;
+  static constexpr int kDefaultProcessSlots = 64;
+
+  /**
+   * @brief Constructs an empty timeline.
+   * @param windowTicks Ticks aggregated into a single window.
+   * @param windowCount Number of windows retained (ring buffer capacity).
+   * @param processSlots Maximum number of live processes tracked per window.
+   */
+  explicit FaultTimeline(int windowTicks = kDefaultWindowTicks,
+                         int windowCount = kDefaultWindowCount,
+                         int processSlots = kDefaultProcessSlots);
+
+  /**
+   * @brief Assigns a process slot to a PID (no-op if already registered).
+   * Processes that do not get a slot are still counted in the global series.
+   */
+  void registerProcess(int processId);
+
+  /**
+   * @brief Releases the slot of a PID, folding its total into the retired totals.
+   */
+  void releaseProcess(int processId);
+
+  void recordHit(int processId, uint64_t tick);
+  void recordFault(int processId, uint64_t tick, bool replacement);
+
+  /**
+   * @brief Returns the windows overlapping [fromTick, toTick].
+   * Windows older than the retained history are omitted.
+   */
+  std::vector<waos::common::FaultWindowInfo> query(uint64_t fromTick, uint64_t toTick) const;
+
+  /**
+   * @brief Computes the fault rate of a process over [fromTick, toTick].
+   */
+  waos::common::ProcessFaultRate processFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const;
+
+  /**
+   * @brief Cumulative faults per PID since the last reset (live and retired).
+   */
+  std::map<int, int> faultsPerProcess() const;
+
+  /**
+   * @brief Faults per tick in the window containing `tick`.
+   */
+  double faultRateAt(uint64_t tick) const;
+
+  int getWindowTicks() const;
+  void reset();
+
+ private:
+  int m_windowTicks;
+  int m_windowCount;
+  int m_processSlots;
+
+  // Global series (one entry per ring position)
+  std::vector<uint64_t> m_windowIds;  // Absolute window index stored at each ring position
+  std::vector<int> m_faults;
+  std::vector<int> m_hits;
+  std::vector<int> m_replacements;
+  uint64_t m_latestWindow = 0;
+  bool m_hasData = false;
+
+  // Per-process series: m_slotFaults[slot * m_windowCount + ringPos]
+  std::vector<int> m_slotFaults;
+  std::vector<int> m_slotTotals;
+  std::vector<int> m_slotOwner;  // PID owning each slot (-1 if free)
+  std::vector<int> m_freeSlots;
+  std::unordered_map<int, int> m_slotByPid;
+
+  // Totals of processes that no longer own a slot (or never got one)
+  std::map<int, int> m_retiredTotals;
+
+  /**
+   * @brief Returns the ring position for `tick`, recycling a stale window if needed.
+   */
+  int touchWindow(uint64_t tick);
+
+  int slotOf(int processId) const;
+  uint64_t oldestWindow() const;
+  bool isRetained(uint64_t windowId) const;
+};
+
+}  // namespace waos::memory
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "waos/common/DataStructures.h"
+
 namespace waos::memory {
 
   /**
@@ -13,10 +15,11 @@ namespace waos::memory {
    */
   struct Frame {
     int pid = -1;                 // Process ID that owns this frame (-1 if free)
-    int pageNumber = -1;          // Page number mapped to this frame (-1 if free)
+    uint64_t pageNumber = waos::common::NO_PAGE;  // Page number mapped to this frame (NO_PAGE if free)
     bool occupied = false;        // True if the frame is currently in use
     uint64_t loadTime = 0;        // Timestamp when the page was loaded (for FIFO)
     uint64_t lastAccessTime = 0;  // Timestamp of last access (for LRU)
+    int refCount = 0;             // Page tables mapping this frame (>1 if shared)
 
     /**
      * @brief Checks if the frame is currently free
@@ -30,10 +33,11 @@ namespace waos::memory {
      */
     void reset() {
       pid = -1;
-      pageNumber = -1;
+      pageNumber = waos::common::NO_PAGE;
       occupied = false;
       loadTime = 0;
       lastAccessTime = 0;
+      refCount = 0;
     }
   };
 
@@ -16,7 +16,9 @@ namespace waos::memory {
 enum class PageRequestResult {
   HIT,
   PAGE_FAULT,
-  REPLACEMENT
+  REPLACEMENT,
+  COPY_ON_WRITE,     // Write to a shared copy-on-write page: private copy made in memory
+  COMPRESSED_RELOAD  // Page decompressed from the compressed swap pool, no disk I/O
 };
 
 /**
@@ -39,13 +41,14 @@ class IMemoryManager {
    * @param pageNumber The virtual page number.
    * @return true if loaded, false otherwise.
    */
-  virtual bool isPageLoaded(int processId, int pageNumber) const = 0;
+  virtual bool isPageLoaded(int processId, waos::common::PageNumber pageNumber) const = 0;
 
   /**
    * @brief Handles a formal page request. Triggers load/replacement if needed.
+   * @param isWrite true if the access writes the page (sets the dirty bit, splits COW pages).
    * @return Result of the operation (HIT or FAULT).
    */
-  virtual PageRequestResult requestPage(int processId, int pageNumber) = 0;
+  virtual PageRequestResult requestPage(int processId, waos::common::PageNumber pageNumber, bool isWrite = false) = 0;
 
   /**
    * @brief Allocate memory structures for a new process.
@@ -54,7 +57,7 @@ class IMemoryManager {
    * Creates the page table and reserves necessary structures for
    * the process based on its required pages
    */
-  virtual void allocateForProcess(int processId, int requiredPages) = 0;
+  virtual void allocateForProcess(int processId, waos::common::PageNumber requiredPages) = 0;
 
   /**
    * @brief Deallocate memory structures for a terminated process
@@ -67,7 +70,27 @@ class IMemoryManager {
    * @brief Marks a page as successfully loaded into a frame.
    * Should be called by the Simulator after the I/O penalty time expires.
    */
-  virtual void completePageLoad(int processId, int pageNumber) = 0;
+  virtual void completePageLoad(int processId, waos::common::PageNumber pageNumber) = 0;
+
+  /**
+   * @brief Optional: Maps a shared region into a process's virtual pages.
+   * Should be called after allocateForProcess(). Processes mapping the same
+   * region share frames; copy-on-write mappings get a private copy on first write.
+   * @param processId Process identifier.
+   * @param regionId Region identifier (from the workload file).
+   * @param firstPage First virtual page of the mapping in this process.
+   * @param pageCount Number of pages mapped.
+   * @param copyOnWrite true for fork-like private-on-write semantics.
+   */
+  virtual void mapSharedRegion(int processId, int regionId, waos::common::PageNumber firstPage,
+                               waos::common::PageNumber pageCount, bool copyOnWrite) {
+    // Default implementation does nothing (pages stay private)
+    (void)processId;
+    (void)regionId;
+    (void)firstPage;
+    (void)pageCount;
+    (void)copyOnWrite;
+  }
 
   /**
    * @brief Optional: Register future page references for optimal algorithms.
@@ -75,7 +98,7 @@ class IMemoryManager {
    * @param processId Process identifier.
    * @param referenceString Complete sequence of future page references.
    */
-  virtual void registerFutureReferences(int processId, const std::vector<int>& referenceString) {
+  virtual void registerFutureReferences(int processId, const std::vector<waos::common::PageNumber>& referenceString) {
     // Default implementation does nothing (for FIFO, LRU)
     (void)processId;
     (void)referenceString;
@@ -102,11 +125,76 @@ class IMemoryManager {
    */
   virtual std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int processId) const = 0;
 
+  /**
+   * @brief Frame holding one page, or -1 if it is not resident.
+   * The default scans getPageTableForProcess(); managers with a direct lookup should override it.
+   */
+  virtual int getFrameForPage(int processId, waos::common::PageNumber pageNumber) const {
+    for (const auto& entry : getPageTableForProcess(processId)) {
+      if (entry.pageNumber == pageNumber && entry.present) return entry.frameNumber;
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Optional: Largest page count allocateForProcess() accepts (address space size).
+   * The Simulator rejects workloads that need more before the run starts.
+   */
+  virtual waos::common::PageNumber getMaxPages() const {
+    return UINT64_MAX;
+  }
+
+  /**
+   * @brief Optional: Ticks of page-walk overhead charged by the last requestPage().
+   * The Simulator adds this to the page fault penalty.
+   */
+  virtual int getLastWalkCost() const {
+    return 0;
+  }
+
+  /**
+   * @brief Optional: Ticks to reload a page from the compressed swap pool.
+   * The Simulator uses this instead of the disk penalty on COMPRESSED_RELOAD.
+   */
+  virtual int getCompressedReloadPenalty() const {
+    return 0;
+  }
+
   /**
    * @brief Obtiene estadísticas acumuladas de memoria (Hits, Faults, etc).
    */
   virtual waos::common::MemoryStats getMemoryStats() const = 0;
 
+  /**
+   * @brief Optional: Frames currently holding a page, without building MemoryStats.
+   * Sampled every tick by the time-series recorder; override with an O(1) read.
+   */
+  virtual int getUsedFrameCount() const {
+    return getMemoryStats().usedFrames;
+  }
+
+  /**
+   * @brief Optional: Serie temporal de faults/hits/reemplazos en [fromTick, toTick].
+   * Solo se retienen las ventanas más recientes (memoria fija).
+   */
+  virtual std::vector<waos::common::FaultWindowInfo> getFaultTimeline(uint64_t fromTick, uint64_t toTick) const {
+    (void)fromTick;
+    (void)toTick;
+    return {};
+  }
+
+  /**
+   * @brief Optional: Tasa de fallos de un proceso en [fromTick, toTick].
+   * Útil para detectar fases de thrashing.
+   */
+  virtual waos::common::ProcessFaultRate getProcessFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const {
+    (void)fromTick;
+    (void)toTick;
+    waos::common::ProcessFaultRate rate;
+    rate.pid = processId;
+    return rate;
+  }
+
   /**
    * @brief Obtiene el nombre del algoritmo (ej: "LRU", "FIFO").
    */
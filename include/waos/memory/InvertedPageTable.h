@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PageKey.h"
+#include "PageTableEntry.h"
+
+namespace waos::memory {
+
+/**
+ * @class InvertedPageTable
+ * @brief Hashed page table with one entry per resident page, shared by all processes.
+ *
+ * Entries are found by (pid, page) through open addressing with linear
+ * probing. Keys live in their own contiguous array so a probe sequence reads
+ * consecutive cache lines; entries are only touched on a match. Deletion uses
+ * backward shifting, so there are no tombstones and probe chains stay short.
+ *
+ * The table starts with room for `expectedEntries` at a load factor of 1/2
+ * and only grows if more pages than that are resident at once (shared frames
+ * map several pages to one frame).
+ */
+class InvertedPageTable {
+ public:
+  explicit InvertedPageTable(int expectedEntries = 0);
+
+  /**
+   * @brief Looks up a resident page.
+   * @param probes Optional out-param: slots inspected during the lookup.
+   * @return Pointer to the entry, or nullptr if (pid, page) is not resident.
+   *         Invalidated by the next insert() or erase().
+   */
+  PageTableEntry* find(int processId, uint64_t pageNumber, int* probes = nullptr);
+  const PageTableEntry* find(int processId, uint64_t pageNumber, int* probes = nullptr) const;
+
+  /**
+   * @brief Returns the entry for (pid, page), inserting an empty one if needed.
+   */
+  PageTableEntry& insert(int processId, uint64_t pageNumber);
+
+  bool erase(int processId, uint64_t pageNumber);
+
+  /**
+   * @brief Visits every entry as fn(int pid, uint64_t page, const PageTableEntry& entry).
+   */
+  template <typename Fn>
+  void forEach(Fn&& fn) const {
+    for (size_t i = 0; i < m_keys.size(); ++i) {
+      if (m_keys[i] != EMPTY_KEY) fn(m_keys[i].owner, m_keys[i].page, m_entries[i]);
+    }
+  }
+
+  size_t size() const;
+  size_t slotCount() const;
+  size_t memoryBytes() const;
+  void clear();
+
+ private:
+  static constexpr PageKey EMPTY_KEY{-1, ~uint64_t(0)};
+
+  std::vector<PageKey> m_keys;            // Probed on every lookup
+  std::vector<PageTableEntry> m_entries;  // Parallel to m_keys
+  size_t m_mask = 0;
+  size_t m_size = 0;
+
+  size_t slotOf(const PageKey& key, int* probes) const;
+  size_t home(const PageKey& key) const;
+  void grow();
+};
+
+}  // namespace waos::memory
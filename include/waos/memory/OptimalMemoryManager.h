@@ -1,13 +1,10 @@
 #pragma once
 
 #include <cstdint>
-#include <mutex>
 #include <unordered_map>
 #include <vector>
 
-#include "Frame.h"
-#include "IMemoryManager.h"
-#include "PageTable.h"
+#include "PagedMemoryManager.h"
 
 namespace waos::memory {
 
@@ -17,8 +14,8 @@ namespace waos::memory {
  */
 struct ProcessFutureReferences {
   int processId;
-  std::vector<int> futurePages;  // Complete sequence of future page accesses
-  size_t currentIndex;           // Current position in the sequence
+  std::vector<waos::common::PageNumber> futurePages;  // Complete sequence of future page accesses
+  size_t currentIndex;                                // Current position in the sequence
 };
 
 /**
@@ -35,24 +32,21 @@ struct ProcessFutureReferences {
  * - On replacement, scans future references to find optimal victim
  * - Page used farthest in the future (or never again) is replaced
  */
-class OptimalMemoryManager : public IMemoryManager {
+class OptimalMemoryManager : public PagedMemoryManager {
  public:
   /**
    * @brief Constructs an Optimal Memory Manager.
    * @param totalFrames Total number of physical memory frames available.
    * @param clockRef Pointer to the simulation clock for timestamps.
+   * @param geometry Shape of the page tables (radix or inverted mode).
+   * @param swap Optional compressed swap tier; its frames are taken from totalFrames.
    */
-  explicit OptimalMemoryManager(int totalFrames, const uint64_t* clockRef);
+  explicit OptimalMemoryManager(int totalFrames, const uint64_t* clockRef,
+                                PageTableGeometry geometry = PageTableGeometry(),
+                                CompressedSwapConfig swap = CompressedSwapConfig());
 
   ~OptimalMemoryManager() override = default;
 
-  // IMemoryManager interface implementation
-  bool isPageLoaded(int processId, int pageNumber) const override;
-  PageRequestResult requestPage(int processId, int pageNumber) override;
-  void allocateForProcess(int processId, int requiredPages) override;
-  void freeForProcess(int processId) override;
-  void completePageLoad(int processId, int pageNumber) override;
-
   /**
    * @brief Registers the complete page reference sequence for a process.
    *
@@ -62,7 +56,7 @@ class OptimalMemoryManager : public IMemoryManager {
    * @param processId Process identifier.
    * @param referenceString Complete sequence of page accesses.
    */
-  void registerFutureReferences(int processId, const std::vector<int>& referenceString) override;
+  void registerFutureReferences(int processId, const std::vector<waos::common::PageNumber>& referenceString) override;
 
   /**
    * @brief Advances the instruction pointer for a process.
@@ -71,42 +65,9 @@ class OptimalMemoryManager : public IMemoryManager {
    */
   void advanceInstructionPointer(int processId) override;
 
-  std::vector<waos::common::FrameInfo> getFrameStatus() const override;
-  std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int processId) const override;
-  waos::common::MemoryStats getMemoryStats() const override;
   std::string getAlgorithmName() const override;
-  void reset() override;
-
- private:
-  mutable std::mutex m_mutex;
-
-  // Physical memory simulation
-  std::vector<Frame> m_frames;  // Array of physical frames
-  const uint64_t* m_clockRef;   // Pointer to simulation clock
-
-  // Per-process page tables
-  std::unordered_map<int, PageTable> m_pageTables;
-
-  // Future references for optimal decision-making
-  std::unordered_map<int, ProcessFutureReferences> m_futureRefs;
-
-  waos::common::MemoryStats m_stats;
-  uint64_t m_totalHits = 0;
-
-  /**
-   * @brief Finds a free frame in physical memory.
-   * @return Frame index if found, -1 otherwise.
-   */
-  int findFreeFrame() const;
-
-  /**
-   * @brief Loads a page into a specific frame.
-   * @param processId Process owner.
-   * @param pageNumber Virtual page number.
-   * @param frameIndex Physical frame to use.
-   */
-  void loadPageIntoFrame(int processId, int pageNumber, int frameIndex);
 
+ protected:
   /**
    * @brief Selects a victim frame using Optimal policy.
    *
@@ -115,13 +76,14 @@ class OptimalMemoryManager : public IMemoryManager {
    *
    * @return Frame index to be replaced.
    */
-  int selectVictimFrame();
+  int selectVictimFrame() override;
 
-  /**
-   * @brief Evicts a page from a frame.
-   * @param frameIndex Frame to evict.
-   */
-  void evictFrame(int frameIndex);
+  void onProcessFreed(int processId) override;
+  void onReset() override;
+
+ private:
+  // Future references for optimal decision-making
+  std::unordered_map<int, ProcessFutureReferences> m_futureRefs;
 
   /**
    * @brief Calculates when a page will be used next.
@@ -129,7 +91,7 @@ class OptimalMemoryManager : public IMemoryManager {
    * @param pageNumber Virtual page number.
    * @return Ticks until next use, or INT_MAX if never used again.
    */
-  int getNextUseDistance(int processId, int pageNumber) const;
+  int getNextUseDistance(int processId, waos::common::PageNumber pageNumber) const;
 };
 
 }  // namespace waos::memory
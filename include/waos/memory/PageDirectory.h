@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "InvertedPageTable.h"
+#include "PageTable.h"
+
+namespace waos::memory {
+
+/**
+ * @class PageDirectory
+ * @brief All page translations of a memory manager, in radix or inverted mode.
+ *
+ * In RADIX mode every process owns a RadixPageTable and evicted pages keep
+ * their (non-present) entry. In INVERTED mode a single InvertedPageTable holds
+ * only resident pages, so translation metadata is bounded by the frame count
+ * instead of growing with the live processes' address spaces.
+ *
+ * Entry pointers and references are only valid until the next load() or
+ * evict(): inverted entries move when the hash table shifts or grows.
+ */
+class PageDirectory {
+ public:
+  PageDirectory(PageTableGeometry geometry, int totalFrames);
+
+  /**
+   * @throws std::invalid_argument if requiredPages exceeds the radix address space.
+   */
+  void addProcess(int processId, uint64_t requiredPages);
+  void removeProcess(int processId);
+  bool hasProcess(int processId) const;
+
+  /**
+   * @brief Looks up a translation without allocating.
+   * @param levelsWalked Optional out-param: radix levels read, or hash slots probed.
+   */
+  PageTableEntry* find(int processId, uint64_t pageNumber, int* levelsWalked = nullptr);
+  const PageTableEntry* find(int processId, uint64_t pageNumber, int* levelsWalked = nullptr) const;
+
+  /**
+   * @brief Marks (pid, page) present in `frameIndex` and returns its entry.
+   */
+  PageTableEntry& load(int processId, uint64_t pageNumber, int frameIndex, uint64_t currentTime);
+
+  /**
+   * @brief Marks (pid, page) as not present.
+   */
+  void evict(int processId, uint64_t pageNumber);
+
+  /**
+   * @brief Visits the entries of a process as fn(uint64_t pageNumber, const PageTableEntry& entry).
+   * Radix mode visits in ascending page order; inverted mode only visits resident pages.
+   */
+  template <typename Fn>
+  void forEach(int processId, Fn&& fn) const {
+    if (m_geometry.mode == PageTableMode::INVERTED) {
+      m_inverted.forEach([&fn, processId](int pid, uint64_t pageNumber, const PageTableEntry& entry) {
+        if (pid == processId) fn(pageNumber, entry);
+      });
+      return;
+    }
+    auto it = m_tables.find(processId);
+    if (it != m_tables.end()) it->second.forEach(fn);
+  }
+
+  size_t nodeCount() const;    // Radix nodes, or 1 for the inverted table
+  size_t memoryBytes() const;  // Bytes of translation metadata
+  uint64_t maxPages() const;   // Largest requiredPages addProcess() accepts
+  const PageTableGeometry& geometry() const;
+  void clear();
+
+ private:
+  PageTableGeometry m_geometry;
+  std::unordered_map<int, PageTable> m_tables;  // RADIX mode
+  InvertedPageTable m_inverted;                 // INVERTED mode
+  std::unordered_set<int> m_processes;          // INVERTED mode
+};
+
+}  // namespace waos::memory
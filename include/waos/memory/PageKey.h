@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace waos::memory {
+
+/**
+ * @struct PageKey
+ * @brief (owner, page) pair used to index pages in hash tables.
+ *
+ * The owner is a PID, or a region id for pages of a shared region.
+ */
+struct PageKey {
+  int owner = -1;
+  uint64_t page = 0;
+
+  bool operator==(const PageKey& other) const {
+    return owner == other.owner && page == other.page;
+  }
+  bool operator!=(const PageKey& other) const {
+    return !(*this == other);
+  }
+
+  /**
+   * @brief Folds both fields into 64 bits (owner in the high half, exact while pages fit in 32 bits).
+   */
+  uint64_t folded() const {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(owner)) << 32) ^ page;
+  }
+};
+
+struct PageKeyHash {
+  size_t operator()(const PageKey& key) const {
+    return std::hash<uint64_t>()(key.folded());
+  }
+};
+
+}  // namespace waos::memory
@@ -1,7 +1,6 @@
 #pragma once
 
-#include "PageTableEntry.h"
-#include <unordered_map>
+#include "RadixPageTable.h"
 
 namespace waos::memory {
 
@@ -9,8 +8,9 @@ namespace waos::memory {
    * @brief Page Table type definition
    *
    * Maps logical page numbers to their corresponding page table entries
+   * through a multi-level radix tree whose nodes are allocated on first touch.
    * Each process has its own page table
    */
-  using PageTable = std::unordered_map<int, PageTableEntry>;
+  using PageTable = RadixPageTable;
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "CompressedSwapPool.h"
+#include "FaultTimeline.h"
+#include "Frame.h"
+#include "IMemoryManager.h"
+#include "PageDirectory.h"
+#include "SharedMemoryTable.h"
+
+namespace waos::memory {
+
+/**
+ * @class PagedMemoryManager
+ * @brief Demand paging shared by the built-in replacement algorithms.
+ *
+ * Owns the frames, page tables, shared-region bookkeeping, compressed swap
+ * pool and statistics, and implements the whole request path: page walk
+ * accounting, shared-mapping hits, copy-on-write splits, compressed reloads
+ * and eviction. Subclasses only choose the victim frame and may react to
+ * loads, accesses and process teardown through the protected hooks.
+ *
+ * Every hook is called with m_mutex held.
+ */
+class PagedMemoryManager : public IMemoryManager {
+ public:
+  ~PagedMemoryManager() override = default;
+
+  // IMemoryManager interface implementation
+  bool isPageLoaded(int processId, waos::common::PageNumber pageNumber) const override;
+  PageRequestResult requestPage(int processId, waos::common::PageNumber pageNumber, bool isWrite = false) override;
+  void allocateForProcess(int processId, waos::common::PageNumber requiredPages) override;
+  void freeForProcess(int processId) override;
+  void completePageLoad(int processId, waos::common::PageNumber pageNumber) override;
+  void mapSharedRegion(int processId, int regionId, waos::common::PageNumber firstPage,
+                       waos::common::PageNumber pageCount, bool copyOnWrite) override;
+
+  // Métodos de Observación para GUI
+  std::vector<waos::common::FrameInfo> getFrameStatus() const override;
+  std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int processId) const override;
+  int getFrameForPage(int processId, waos::common::PageNumber pageNumber) const override;
+  waos::common::MemoryStats getMemoryStats() const override;
+  int getUsedFrameCount() const override;
+  std::vector<waos::common::FaultWindowInfo> getFaultTimeline(uint64_t fromTick, uint64_t toTick) const override;
+  waos::common::ProcessFaultRate getProcessFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const override;
+  waos::common::PageNumber getMaxPages() const override;
+  int getLastWalkCost() const override;
+  int getCompressedReloadPenalty() const override;
+  void reset() override;
+
+ protected:
+  /**
+   * @param totalFrames Total number of physical memory frames available.
+   * @param clockRef Pointer to the simulation clock for timestamps.
+   * @param geometry Shape of the page tables (radix or inverted mode).
+   * @param swap Compressed swap tier; its frames are taken from totalFrames.
+   * @param traceTag Component name in trace records; must be a string literal.
+   */
+  PagedMemoryManager(int totalFrames, const uint64_t* clockRef, PageTableGeometry geometry,
+                     CompressedSwapConfig swap, const char* traceTag);
+
+  /**
+   * @brief Selects the frame to evict when memory is full.
+   * @return Index of an occupied frame.
+   */
+  virtual int selectVictimFrame() = 0;
+
+  /**
+   * @brief A page was placed in `frameIndex` (fault, COW copy or compressed reload).
+   */
+  virtual void onPageLoaded(int frameIndex) { (void)frameIndex; }
+
+  /**
+   * @brief A resident page was accessed without faulting.
+   */
+  virtual void onPageAccessed(int processId, waos::common::PageNumber pageNumber) {
+    (void)processId;
+    (void)pageNumber;
+  }
+
+  /**
+   * @brief The frames of a terminated process have just been released.
+   */
+  virtual void onProcessFreed(int processId) { (void)processId; }
+
+  /**
+   * @brief Frames, tables and statistics have just been cleared.
+   */
+  virtual void onReset() {}
+
+  mutable std::mutex m_mutex;
+
+  // Physical memory simulation
+  std::vector<Frame> m_frames;  // Array of physical frames
+  const uint64_t* m_clockRef;   // Pointer to simulation clock
+
+  // Page translations (per-process radix tables or one inverted table)
+  PageDirectory m_pageTables;
+
+  // Frames mapped by several page tables (shared regions, copy-on-write)
+  SharedMemoryTable m_shared;
+
+ private:
+  waos::common::MemoryStats m_stats;
+  uint64_t m_totalHits = 0;  // Counter for page hits
+  FaultTimeline m_timeline;  // Windowed fault/hit history
+
+  // Page walk accounting
+  PageTableGeometry m_geometry;
+  uint64_t m_totalWalkSteps = 0;  // Table levels read across all requests
+  int m_lastWalkCost = 0;         // Walk ticks charged by the last requestPage()
+
+  // Compressed swap tier between eviction and disk
+  CompressedSwapConfig m_swapConfig;
+  CompressedSwapPool m_swap;
+
+  const char* m_traceTag;
+
+  /**
+   * @brief Counts a request served without I/O.
+   */
+  void recordHit(int processId, waos::common::PageNumber pageNumber);
+
+  /**
+   * @brief Finds a free frame in physical memory.
+   * @return Frame index if found, -1 otherwise.
+   */
+  int findFreeFrame() const;
+
+  /**
+   * @brief Loads a page into a specific frame.
+   * @param processId Process owner.
+   * @param pageNumber Virtual page number.
+   * @param frameIndex Physical frame to use.
+   */
+  void loadPageIntoFrame(int processId, waos::common::PageNumber pageNumber, int frameIndex);
+
+  /**
+   * @brief Returns a free frame, evicting a victim if memory is full.
+   * @param replaced Out-param: true if a page had to be evicted.
+   */
+  int acquireFrame(bool& replaced);
+
+  /**
+   * @brief Gives a writing process its own copy of a shared copy-on-write page.
+   */
+  PageRequestResult splitCopyOnWrite(int processId, waos::common::PageNumber pageNumber, PageTableEntry& entry);
+
+  /**
+   * @brief Evicts a page from a frame.
+   * @param frameIndex Frame to evict.
+   */
+  void evictFrame(int frameIndex);
+};
+
+}  // namespace waos::memory
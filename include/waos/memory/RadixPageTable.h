@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "PageTableEntry.h"
+
+namespace waos::memory {
+
+/**
+ * @brief How virtual pages are translated to frames.
+ */
+enum class PageTableMode {
+  RADIX,    // One lazily allocated radix table per process
+  INVERTED  // One hashed table for all processes, sized to physical memory
+};
+
+/**
+ * @struct PageTableGeometry
+ * @brief Shape of a multi-level page table.
+ *
+ * The default (4 levels x 9 bits) mirrors x86-64 paging: 36 bits of virtual
+ * page number, i.e. a 48-bit address space with 4 KiB pages.
+ */
+struct PageTableGeometry {
+  int levels = 4;            // Number of table levels walked per translation
+  int bitsPerLevel = 9;      // log2(fan-out) of every node
+  int walkCostPerLevel = 0;  // Extra ticks charged to a page fault per level walked (or probe, if inverted)
+  PageTableMode mode = PageTableMode::RADIX;
+};
+
+/**
+ * @class RadixPageTable
+ * @brief Multi-level (radix) page table with lazily allocated nodes.
+ *
+ * Interior nodes and leaf arrays are only created when a page below them is
+ * first touched, so a sparse process pays for the pages it actually uses and
+ * not for the size of its virtual address space.
+ */
+class RadixPageTable {
+ public:
+  explicit RadixPageTable(PageTableGeometry geometry = PageTableGeometry());
+
+  RadixPageTable(RadixPageTable&&) noexcept = default;
+  RadixPageTable& operator=(RadixPageTable&&) noexcept = default;
+
+  /**
+   * @brief Looks up an entry without allocating.
+   * @param pageNumber Virtual page number.
+   * @param levelsWalked Optional out-param: table levels read during the walk.
+   * @return Pointer to the entry, or nullptr if the page was never touched.
+   */
+  PageTableEntry* find(uint64_t pageNumber, int* levelsWalked = nullptr);
+  const PageTableEntry* find(uint64_t pageNumber, int* levelsWalked = nullptr) const;
+
+  /**
+   * @brief Returns the entry for a page, allocating the walk path if needed.
+   * @throws std::out_of_range if the page is outside the address space.
+   */
+  PageTableEntry& operator[](uint64_t pageNumber);
+
+  /**
+   * @brief Visits every materialized entry in ascending page order.
+   * @param fn Callable as fn(uint64_t pageNumber, const PageTableEntry& entry).
+   */
+  template <typename Fn>
+  void forEach(Fn&& fn) const {
+    if (m_root) visit(*m_root, 0, 0, fn);
+  }
+
+  size_t size() const;       // Materialized entries
+  size_t nodeCount() const;  // Allocated nodes (interior + leaf)
+  size_t memoryBytes() const; // Bytes held by allocated nodes
+  uint64_t capacity() const; // Pages addressable with this geometry
+  const PageTableGeometry& geometry() const;
+  void clear();
+
+ private:
+  struct Node {
+    std::vector<std::unique_ptr<Node>> children;  // Interior levels only
+    std::vector<PageTableEntry> entries;          // Leaf level only
+    std::vector<bool> used;                       // Leaf level only
+  };
+
+  PageTableGeometry m_geometry;
+  std::unique_ptr<Node> m_root;
+  size_t m_size = 0;
+  size_t m_nodeCount = 0;
+  size_t m_leafCount = 0;
+
+  std::unique_ptr<Node> makeNode(int level);
+  size_t indexAt(uint64_t pageNumber, int level) const;
+
+  template <typename Fn>
+  void visit(const Node& node, int level, uint64_t prefix, Fn& fn) const {
+    const size_t fanOut = size_t(1) << m_geometry.bitsPerLevel;
+    if (level == m_geometry.levels - 1) {
+      for (size_t i = 0; i < fanOut; ++i) {
+        if (node.used[i]) fn((prefix << m_geometry.bitsPerLevel) | i, node.entries[i]);
+      }
+      return;
+    }
+    for (size_t i = 0; i < fanOut; ++i) {
+      if (node.children[i]) visit(*node.children[i], level + 1, (prefix << m_geometry.bitsPerLevel) | i, fn);
+    }
+  }
+};
+
+}  // namespace waos::memory
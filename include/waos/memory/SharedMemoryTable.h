@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Frame.h"
+#include "PageKey.h"
+
+namespace waos::memory {
+
+/**
+ * @struct SharedRegionMapping
+ * @brief A shared region mapped into a range of a process's virtual pages.
+ */
+struct SharedRegionMapping {
+  int regionId;
+  uint64_t firstPage;
+  uint64_t pageCount;
+  bool copyOnWrite;
+};
+
+/**
+ * @class SharedMemoryTable
+ * @brief Bookkeeping for frames mapped by several page tables.
+ *
+ * Tracks which virtual pages of each process belong to a shared region, which
+ * region pages are resident (and in which frame), and the reverse map from a
+ * shared frame to every (pid, page) mapping it. Frame::refCount mirrors the
+ * number of mappers. Pages written through a copy-on-write mapping become
+ * private and are no longer considered shared.
+ *
+ * Not thread-safe: the owning memory manager must hold its own mutex.
+ */
+class SharedMemoryTable {
+ public:
+  using Mapper = std::pair<int, uint64_t>;  // <processId, pageNumber>
+
+  void mapRegion(int processId, const SharedRegionMapping& mapping);
+
+  /**
+   * @brief Finds the shared region page behind (pid, page).
+   * @param key Out-param: region page key, valid when true is returned.
+   * @param copyOnWrite Out-param: whether the mapping is copy-on-write.
+   * @return false if the page is private (unmapped or already privatized).
+   */
+  bool lookup(int processId, uint64_t pageNumber, PageKey& key, bool& copyOnWrite) const;
+
+  /**
+   * @brief Frame holding the region page `key`, or -1 if not resident.
+   */
+  int residentFrame(const PageKey& key) const;
+
+  /**
+   * @brief Records that (pid, page) maps `frameIndex`, which holds region page `key`.
+   */
+  void attach(const PageKey& key, int frameIndex, int processId, uint64_t pageNumber, std::vector<Frame>& frames);
+
+  /**
+   * @brief Removes (pid, page) from the mappers of a shared frame.
+   * Transfers Frame::pid/pageNumber to a remaining mapper if the owner left.
+   * @return Remaining mappers (0 means the frame is no longer referenced).
+   */
+  int detach(int frameIndex, int processId, uint64_t pageNumber, std::vector<Frame>& frames);
+
+  /**
+   * @brief Marks (pid, page) as private after a copy-on-write split.
+   */
+  void privatize(int processId, uint64_t pageNumber);
+
+  /**
+   * @brief Every (pid, page) currently mapping a frame (empty for private frames).
+   */
+  const std::vector<Mapper>& mappers(int frameIndex) const;
+
+  /**
+   * @brief Forgets a frame (after eviction or when its last mapper is gone).
+   */
+  void dropFrame(int frameIndex);
+
+  /**
+   * @brief Drops all mappings and private-page markers of a process.
+   */
+  void unmapProcess(int processId);
+
+  int sharedFrameCount() const;
+  void clear();
+
+ private:
+  std::unordered_map<int, std::vector<SharedRegionMapping>> m_mappings;  // By PID
+  std::unordered_set<PageKey, PageKeyHash> m_privatized;                // (pid, page) keys
+  std::unordered_map<PageKey, int, PageKeyHash> m_residentByKey;        // Region page -> frame
+  std::unordered_map<int, PageKey> m_keyByFrame;                        // Frame -> region page
+  std::unordered_map<int, std::vector<Mapper>> m_mappersByFrame;
+};
+
+}  // namespace waos::memory
@@ -0,0 +1,21 @@
+/**
+ * @brief Registration of the bundled schedulers in the policy registry.
+ */
+
+#pragma once
+
+#include "waos/core/PolicyRegistry.h"
+
+namespace waos::scheduler {
+
+/**
+ * @brief Registers every scheduler shipped with the simulator.
+ *
+ * Names match the GUI selector ("FCFS", "Round Robin", "SJF", "SRTF",
+ * "SJF Predictivo", "MLFQ", "CFS", "Lottery", "Stride", "EDF", "RM",
+ * "Priority", "Priority + Aging"). Called explicitly rather than from static
+ * initialisers, which a static library link would drop.
+ */
+void registerBuiltinSchedulers(waos::core::PolicyRegistry& registry);
+
+}  // namespace waos::scheduler
@@ -0,0 +1,114 @@
+/**
+ * @file CFSScheduler.h
+ * @brief Completely Fair Scheduler (virtual runtime ordering).
+ *
+ * Modelled on the Linux CFS: every process accrues virtual runtime at a rate
+ * inversely proportional to its weight, and the one with the least vruntime runs.
+ */
+
+#pragma once
+
+#include "IScheduler.h"
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class CFSScheduler
+ * @brief Fair scheduler over a red-black tree (std::set) keyed by vruntime.
+ *
+ * - The nice value is Process::getPriority() clamped to [-20, 19] and mapped to
+ *   the Linux weight table (nice 0 = 1024, ~1.25x per step).
+ * - CPU time is charged when a process is requeued:
+ *   vruntime += ticks * 1024 / weight.
+ * - The time slice is targetLatency * weight / (total runnable weight), never
+ *   below minGranularity, so it shrinks as the run queue grows.
+ * - New and waking processes are placed at no less than
+ *   min_vruntime - targetLatency / 2, which bounds the credit of sleepers.
+ * - A waking process preempts the running one when its vruntime is lower by
+ *   more than minGranularity.
+ *
+ * Insert, pick and remove are O(log n); per-PID tree iterators allow direct removal.
+ */
+class CFSScheduler : public IScheduler {
+public:
+    /**
+     * @param targetLatency Period (ticks) in which every runnable process should run once.
+     * @param minGranularity Lower bound of a time slice (ticks).
+     * @throws std::invalid_argument If either value is not positive or minGranularity > targetLatency.
+     */
+    explicit CFSScheduler(int targetLatency = 20, int minGranularity = 2);
+    ~CFSScheduler() override = default;
+
+    void addProcess(waos::core::Process* p) override;
+    waos::core::Process* getNextProcess() override;
+    bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
+    int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+    void onProcessTerminated(int pid) override;
+    int getTimeSliceFor(const waos::core::Process* p) const override;
+    bool shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const override;
+
+    // Métodos de Observación
+    std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
+    std::string getAlgorithmName() const override;
+    waos::common::SchedulerMetrics getSchedulerMetrics() const override;
+
+    /**
+     * @brief Virtual runtime of a process in ticks (0 if never seen).
+     */
+    double getVirtualRuntime(int pid) const;
+    double getMinVirtualRuntime() const;
+
+    static int niceFromPriority(int priority);
+    static uint32_t weightFromNice(int nice);
+
+private:
+    // vruntime is kept in fixed point (VRUNTIME_SCALE units per tick)
+    static constexpr uint64_t VRUNTIME_SCALE = 1000;
+    static constexpr uint64_t NICE_0_WEIGHT = 1024;
+
+    struct Entity {
+        uint64_t vruntime = 0;
+        uint64_t chargedCpu = 0;  // Process CPU time already folded into vruntime
+        uint32_t weight = NICE_0_WEIGHT;
+    };
+
+    struct Node {
+        uint64_t vruntime;
+        uint64_t sequence;  // FIFO tie-break
+        waos::core::Process* process;
+        bool operator<(const Node& other) const;
+    };
+
+    uint64_t currentVruntime(const waos::core::Process* p) const;  // Includes uncharged CPU time
+    void publish(int pid);                                         // Mirrors an entity into m_metrics
+
+    int m_targetLatency;
+    int m_minGranularity;
+
+    mutable std::mutex m_mutex;
+    std::set<Node> m_timeline;
+    std::unordered_map<int, std::set<Node>::iterator> m_queued;
+    std::unordered_map<int, Entity> m_entities;
+    uint64_t m_minVruntime = 0;
+    uint64_t m_readyWeight = 0;
+    uint64_t m_sequence = 0;
+    waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
+};
+
+}
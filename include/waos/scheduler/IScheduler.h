@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <string>
@@ -47,6 +49,29 @@ namespace waos::scheduler {
      */
     virtual waos::core::Process* getNextProcess() = 0;
 
+    /**
+     * @brief Removes a ready process without dispatching it (kill, suspension, migration).
+     *
+     * The scheduler never owns the process, so nothing is freed. Default: unsupported.
+     * @return true if the process was queued and has been removed.
+     */
+    virtual bool removeProcess(int pid) {
+      (void)pid;
+      return false;
+    }
+
+    /**
+     * @brief Repositions a ready process after its scheduling attributes changed.
+     *
+     * Re-reads whatever the policy orders by (priority, tickets, burst, deadline)
+     * so aging or re-prioritisation never requires a queue rebuild. Default: unsupported.
+     * @return true if the process is queued (whether or not its position changed).
+     */
+    virtual bool updateKey(int pid) {
+      (void)pid;
+      return false;
+    }
+
     /**
      * @brief Returns true when scheduler has one or more ready processes.
      *
@@ -54,18 +79,107 @@ namespace waos::scheduler {
      */
     virtual bool hasReadyProcesses() const = 0;
 
+    /**
+     * @brief Number of ready processes. Sampled every tick by the time-series
+     *        recorder, so schedulers override it with an O(1) read.
+     */
+    virtual size_t getReadyCount() const {
+      return peekReadyQueue().size();
+    }
+
     /**
      * @brief Defines the maximum CPU ticks a process can run before preemption.
      * @return Positive integer for Quantum, or -1 for infinite (no timer preemption).
      */
     virtual int getTimeSlice() const = 0;
 
+    /**
+     * @brief Time slice for a specific process.
+     *
+     * The Simulator uses this overload when checking quantum expiry, so
+     * schedulers with per-process quanta (e.g. MLFQ levels) can override it.
+     * Default: the scheduler-wide getTimeSlice().
+     */
+    virtual int getTimeSliceFor(const waos::core::Process* p) const {
+      (void)p;
+      return getTimeSlice();
+    }
+
+    /**
+     * @brief Notifies that the running process used its whole time slice.
+     *
+     * Called by the Simulator right before the process is requeued with
+     * addProcess(). Default: ignored.
+     */
+    virtual void onQuantumExpired(waos::core::Process* p) {
+      (void)p;
+    }
+
+    /**
+     * @brief Decides whether a process that just became READY takes the CPU from the running one.
+     *
+     * Called by the Simulator after addProcess() on arrival, I/O completion and
+     * page-fault resolution. Default: never preempt.
+     *
+     * @param running Process currently holding (or being switched onto) the CPU.
+     * @param candidate Process that just became ready.
+     */
+    virtual bool shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const {
+      (void)running;
+      (void)candidate;
+      return false;
+    }
+
+    /**
+     * @brief Notifies that a process finished a CPU burst.
+     *
+     * Called by the Simulator before advancing to the next burst, with the
+     * CPU ticks the burst actually took. Default: ignored.
+     */
+    virtual void onBurstCompleted(waos::core::Process* p, int cpuTicks) {
+      (void)p;
+      (void)cpuTicks;
+    }
+
+    /**
+     * @brief Notifies that a process terminated and will never be queued again.
+     *
+     * Called by the Simulator after the process released its memory, so policies
+     * can drop any per-process state they keep. Default: ignored.
+     */
+    virtual void onProcessTerminated(int pid) {
+      (void)pid;
+    }
+
     /**
      * @brief Observa la cola de procesos listos SIN removerlos.
      * Crucial para que la GUI muestre la cola "Ready" sin afectar la simulación.
      */
     virtual std::vector<const waos::core::Process*> peekReadyQueue() const = 0;
 
+    using ReadyVisitor = std::function<void(const waos::core::Process*)>;
+
+    /**
+     * @brief Visits the ready processes in peekReadyQueue() order without copying them.
+     *
+     * The visitor runs while the scheduler holds its lock, so it must not call
+     * back into the scheduler. Default: iterates a peekReadyQueue() copy.
+     */
+    virtual void forEachReady(const ReadyVisitor& visit) const {
+      for (const waos::core::Process* p : peekReadyQueue()) visit(p);
+    }
+
+    /**
+     * @brief Change counter of the ready queue.
+     *
+     * Incremented whenever the ready set or its order changes, so observers can
+     * cache the last value and skip unchanged queues. 0 means the scheduler does
+     * not track changes and the queue must always be re-read (default).
+     */
+    virtual uint64_t getReadyQueueVersion() const {
+      return 0;
+    }
+
     /**
      * @brief Obtiene el nombre del algoritmo (ej: "Round Robin", "FCFS").
      */
@@ -0,0 +1,99 @@
+/**
+ * @file IndexedProcessHeap.h
+ * @brief 4-ary min-heap of processes with a PID -> position index.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class IndexedProcessHeap
+ * @brief Min-heap ordered by a 64-bit integer key cached at insertion time.
+ *
+ * Keys are stored next to the process pointer, so sifting compares plain
+ * integers and never calls back into Process (nor takes its mutex); a key
+ * only changes through updateKey(), so a queued process can never corrupt
+ * the ordering. Equal keys are served in insertion order.
+ *
+ * The tree is 4-ary: half the depth of a binary heap, and the four
+ * children of a node are adjacent in memory, so sift-down scans one
+ * contiguous block per level. The PID index allows O(1) lookup and
+ * O(log n) removal or key update of an arbitrary process.
+ * Not thread-safe: owners hold their own mutex.
+ */
+class IndexedProcessHeap {
+public:
+    using Key = int64_t;  // Wide enough for accumulated pass/virtual-time keys
+
+    void push(waos::core::Process* p, Key key);
+
+    /**
+     * @brief Removes and returns the process with the smallest key.
+     * @return nullptr if the heap is empty.
+     */
+    waos::core::Process* pop();
+
+    waos::core::Process* top() const;
+    Key topKey() const;  // Undefined if empty
+
+    /**
+     * @brief Changes the key of a queued process (decrease or increase) in O(log n).
+     * The process keeps its FIFO position among equal keys.
+     * @return false if the process is not queued.
+     */
+    bool updateKey(int pid, Key key);
+
+    /**
+     * @brief Cached key of a queued process. Undefined if not queued.
+     */
+    Key keyOf(int pid) const;
+
+    bool remove(int pid);
+    waos::core::Process* find(int pid) const;  // nullptr if not queued
+    bool contains(int pid) const;
+    bool empty() const;
+    size_t size() const;
+
+    /**
+     * @brief Processes in pop order, without modifying the heap.
+     *
+     * The ordered view is cached and rebuilt (O(n log n)) only after a
+     * mutation, so repeated observation of an unchanged heap is O(1).
+     * The reference is invalidated by the next mutation.
+     */
+    const std::vector<const waos::core::Process*>& sorted() const;
+
+private:
+    static constexpr size_t ARITY = 4;
+
+    struct Node {
+        Key key;
+        uint64_t sequence;  // Insertion order, breaks key ties (FIFO)
+        waos::core::Process* process;
+    };
+
+    std::vector<Node> m_nodes;
+    std::unordered_map<int, size_t> m_positions;  // PID -> index in m_nodes
+    uint64_t m_nextSequence = 0;
+
+    mutable std::vector<const waos::core::Process*> m_sortedCache;
+    mutable bool m_sortedValid = false;
+
+    static bool less(const Node& a, const Node& b);
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+    void place(size_t index, const Node& node);
+    void removeAt(size_t index);
+};
+
+}
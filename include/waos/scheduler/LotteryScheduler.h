@@ -0,0 +1,81 @@
+/**
+ * @file LotteryScheduler.h
+ * @brief Randomized proportional-share scheduler (lottery scheduling).
+ */
+
+#pragma once
+
+#include "IScheduler.h"
+#include "ShareLedger.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class LotteryScheduler
+ * @brief Draws a winning ticket among the ready processes every quantum.
+ *
+ * Ready processes occupy slots of a Fenwick (binary indexed) tree over their
+ * ticket counts, so adding, removing and drawing a winner are all O(log n).
+ * Freed slots are reused; the tree doubles when full. The generator is seeded,
+ * so a given seed reproduces the same schedule.
+ */
+class LotteryScheduler : public IScheduler {
+public:
+    /**
+     * @param quantum Ticks between draws.
+     * @param seed Seed of the ticket draw.
+     */
+    explicit LotteryScheduler(int quantum = 2, uint64_t seed = 42);
+    ~LotteryScheduler() override = default;
+
+    void addProcess(waos::core::Process* p) override;
+    waos::core::Process* getNextProcess() override;
+    bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
+    int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+
+    // Métodos de Observación
+    std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
+    std::string getAlgorithmName() const override;
+    waos::common::SchedulerMetrics getSchedulerMetrics() const override;
+
+    int64_t getTotalReadyTickets() const;
+
+private:
+    // Fenwick tree helpers (1-based internally, slots are 0-based)
+    void fenwickAdd(size_t slot, int64_t delta);
+    size_t fenwickFind(int64_t ticket) const;  // Slot holding the ticket-th ticket (0-based)
+    void grow();
+    void releaseSlot(size_t slot);  // Withdraws the slot's tickets and frees it
+
+    int m_quantum;
+    mutable std::mutex m_mutex;
+    std::mt19937_64 m_rng;
+
+    std::vector<int64_t> m_tree;                     // Fenwick sums, size capacity + 1
+    std::vector<waos::core::Process*> m_slots;       // Slot -> process (nullptr if free)
+    std::vector<int64_t> m_slotTickets;
+    std::vector<size_t> m_freeSlots;
+    std::unordered_map<int, size_t> m_slotByPid;
+    int64_t m_totalTickets = 0;
+
+    ShareLedger m_ledger;
+    waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
+};
+
+}
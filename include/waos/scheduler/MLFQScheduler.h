@@ -0,0 +1,93 @@
+/**
+ * @file MLFQScheduler.h
+ * @brief Multilevel feedback queue scheduler.
+ *
+ * Adapts each process's priority to its observed behaviour: CPU-bound processes
+ * sink to lower levels with longer quanta, I/O-bound ones stay on top.
+ */
+
+#pragma once
+
+#include "IScheduler.h"
+#include <cstdint>
+#include <list>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class MLFQScheduler
+ * @brief Round Robin within each level, strict priority between levels.
+ *
+ * Rules:
+ * - New processes enter level 0 (highest priority).
+ * - A process that uses its whole quantum is demoted one level.
+ * - A process that gives up the CPU before (I/O, page fault) keeps its level.
+ * - Every boostInterval ticks all processes return to level 0, so CPU-bound
+ *   processes cannot starve behind a stream of interactive ones.
+ * - A process becoming ready at a higher level preempts a lower-level one.
+ * - Levels are forgotten when a process terminates or is removed from the queue.
+ */
+class MLFQScheduler : public IScheduler {
+public:
+    /**
+     * @param clockRef Simulation clock used for the periodic boost (may be null if boostInterval is 0).
+     * @param quanta Time slice of each level, from highest to lowest priority.
+     * @param boostInterval Ticks between priority boosts; 0 disables boosting.
+     * @throws std::invalid_argument On empty or non-positive quanta, or a boost without clock.
+     */
+    explicit MLFQScheduler(const uint64_t* clockRef, std::vector<int> quanta = {2, 4, 8},
+                           uint64_t boostInterval = 50);
+    ~MLFQScheduler() override = default;
+
+    void addProcess(waos::core::Process* p) override;
+    waos::core::Process* getNextProcess() override;
+    bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
+    int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+    int getTimeSliceFor(const waos::core::Process* p) const override;
+    void onQuantumExpired(waos::core::Process* p) override;
+    void onProcessTerminated(int pid) override;
+    bool shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const override;
+
+    // Métodos de Observación
+    std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
+    std::string getAlgorithmName() const override;
+    waos::common::SchedulerMetrics getSchedulerMetrics() const override;
+
+    /**
+     * @brief Current level of a process (0 if it was never seen).
+     */
+    int getLevel(int pid) const;
+    int getLevelCount() const;
+
+private:
+    int levelOf(int pid) const;  // Caller holds m_mutex
+    void forgetLevel(int pid);   // Caller holds m_mutex
+    void boostIfDue();           // Caller holds m_mutex
+
+    const uint64_t* m_clockRef;
+    std::vector<int> m_quanta;
+    uint64_t m_boostInterval;
+    uint64_t m_lastBoost = 0;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::list<waos::core::Process*>> m_levels;  // Ready queue per level
+    std::unordered_map<int, std::list<waos::core::Process*>::iterator> m_handles;  // PID -> queue node
+    std::unordered_map<int, int> m_levelByPid;
+    waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
+};
+
+}
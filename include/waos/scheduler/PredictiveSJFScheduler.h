@@ -0,0 +1,86 @@
+/**
+ * @file PredictiveSJFScheduler.h
+ * @brief SJF scheduler driven by exponential-average burst predictions.
+ *
+ * Unlike SJFScheduler, which reads the exact length of the next burst from the
+ * process, this scheduler only learns burst lengths after they complete.
+ */
+
+#pragma once
+
+#include "IScheduler.h"
+#include "IndexedProcessHeap.h"
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class PredictiveSJFScheduler
+ * @brief Non-preemptive SJF ordered by the predicted next CPU burst.
+ *
+ * Each process keeps τ, updated whenever one of its bursts finishes:
+ *
+ *     τ(n+1) = α·t(n) + (1 − α)·τ(n)
+ *
+ * where t(n) is the burst the process actually ran. Processes never seen
+ * before start at the configured initial τ. The prediction error |t(n) − τ(n)|
+ * and its bias are accumulated and reported in the scheduler metrics.
+ */
+class PredictiveSJFScheduler : public IScheduler {
+public:
+    /**
+     * @param alpha Weight of the most recent burst, in [0, 1].
+     * @param initialTau Prediction used for a process's first burst (ticks, >= 0).
+     * @throws std::invalid_argument If either parameter is out of range.
+     */
+    explicit PredictiveSJFScheduler(double alpha = 0.5, double initialTau = 5.0);
+    ~PredictiveSJFScheduler() override = default;
+
+    void addProcess(waos::core::Process* p) override;
+    waos::core::Process* getNextProcess() override;
+    bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
+    int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+    void onBurstCompleted(waos::core::Process* p, int cpuTicks) override;
+
+    // Métodos de Observación
+    std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
+    std::string getAlgorithmName() const override;
+    waos::common::SchedulerMetrics getSchedulerMetrics() const override;
+
+    /**
+     * @brief Current prediction τ for a process (initial τ if it never ran a burst).
+     */
+    double getPrediction(int pid) const;
+
+    double getAlpha() const;
+    double getInitialTau() const;
+
+private:
+    double predictionFor(int pid) const;  // Caller holds m_mutex
+    static IndexedProcessHeap::Key toHeapKey(double tau);
+
+    double m_alpha;
+    double m_initialTau;
+    mutable std::mutex m_mutex;
+    IndexedProcessHeap m_readyHeap;  // Keyed by predicted burst in milliticks
+    std::unordered_map<int, double> m_predictions;  // τ by PID
+
+    double m_absoluteErrorSum = 0.0;
+    double m_signedErrorSum = 0.0;
+    waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
+};
+
+}
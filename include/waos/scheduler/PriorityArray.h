@@ -0,0 +1,144 @@
+/**
+ * @file PriorityArray.h
+ * @brief Bitmap-indexed array of FIFO run lists, one per priority level.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class PriorityArray
+ * @brief O(1) priority run queue in the style of the Linux O(1) scheduler.
+ *
+ * Priorities in [0, LEVELS) index a fixed array of circular doubly linked
+ * FIFO lists, and a bitmap marks the non-empty levels, so push, pop, remove
+ * and empty() are constant time (the highest level is found with
+ * find-first-set). Links live in a pooled vector reused through a free list;
+ * its first LEVELS entries are the list sentinels, so a link can be unlinked
+ * without knowing its level and whole levels can be spliced in O(1).
+ * A PID index maps each queued process to its link.
+ *
+ * Priorities outside the range fall back to an ordered map; negative values
+ * still rank ahead of level 0 and larger values behind the last level.
+ * Removing one of those is linear in the size of its overflow list.
+ * Lower value = higher priority; equal priorities are served FIFO.
+ * Not thread-safe: owners hold their own mutex.
+ */
+class PriorityArray {
+public:
+    static constexpr int LEVELS = 128;
+
+    PriorityArray();
+
+    /**
+     * @brief Appends a process to the tail of its level (re-queues it if already present).
+     */
+    void push(waos::core::Process* p, int priority);
+
+    /**
+     * @brief Removes and returns the first process of the highest non-empty level.
+     * @return nullptr if empty.
+     */
+    waos::core::Process* pop();
+
+    /**
+     * @brief Unlinks a queued process in O(1).
+     * @return false if the process is not queued.
+     */
+    bool remove(int pid);
+
+    /**
+     * @brief Moves a queued process to the tail of another level.
+     * @return false if the process is not queued.
+     */
+    bool setPriority(int pid, int priority);
+
+    /**
+     * @brief Raises every non-negative priority by `steps` levels (clamped at 0).
+     *
+     * Each non-empty level is spliced onto the tail of its target in O(1), so
+     * the cost depends on the number of occupied levels, not on the number of
+     * queued processes. Entries above the array move down through the overflow
+     * map. Negative priorities are left as they are.
+     */
+    void promote(int steps);
+
+    waos::core::Process* find(int pid) const;  // nullptr if not queued
+    bool contains(int pid) const;
+    bool empty() const;
+    size_t size() const;
+
+    /**
+     * @brief Processes in pop order, without modifying the array. O(n).
+     */
+    std::vector<const waos::core::Process*> ordered() const;
+
+    /**
+     * @brief Visits processes in pop order without copying them. O(n).
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const;
+
+    void clear();
+
+private:
+    static constexpr size_t WORDS = LEVELS / 64;
+
+    struct Link {
+        waos::core::Process* process;  // nullptr for sentinels
+        int32_t prev;
+        int32_t next;
+    };
+
+    static int countTrailingZeros(uint64_t word);
+    int firstLevel() const;  // -1 if the array part is empty
+    int32_t allocLink(waos::core::Process* p);
+    void linkBefore(int32_t link, int32_t position);
+    void unlink(int32_t link);  // Clears the level bit when the list becomes empty
+    void splice(int from, int to);  // Appends level `from` to level `to`
+    void setBit(int level);
+    void clearBit(int level);
+
+    std::array<uint64_t, WORDS> m_bitmap{};
+    std::vector<Link> m_links;  // [0, LEVELS): sentinels
+    std::vector<int32_t> m_freeLinks;
+    std::unordered_map<int, int32_t> m_linkByPid;
+
+    std::map<int, std::deque<waos::core::Process*>> m_overflow;  // Out-of-range priorities
+    std::unordered_map<int, int> m_overflowPriority;               // PID -> overflow key
+    size_t m_size = 0;
+};
+
+template <typename Visitor>
+void PriorityArray::forEach(Visitor&& visit) const {
+    auto overflow = m_overflow.begin();
+    for (; overflow != m_overflow.end() && overflow->first < 0; ++overflow) {
+        for (const waos::core::Process* p : overflow->second) visit(p);
+    }
+    for (size_t word = 0; word < WORDS; ++word) {
+        for (uint64_t bits = m_bitmap[word]; bits; bits &= bits - 1) {
+            int32_t sentinel = static_cast<int32_t>(word * 64) + countTrailingZeros(bits);
+            for (int32_t link = m_links[sentinel].next; link != sentinel; link = m_links[link].next) {
+                visit(static_cast<const waos::core::Process*>(m_links[link].process));
+            }
+        }
+    }
+    for (; overflow != m_overflow.end(); ++overflow) {
+        for (const waos::core::Process* p : overflow->second) visit(p);
+    }
+}
+
+}
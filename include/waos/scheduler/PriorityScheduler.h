@@ -1,18 +1,16 @@
 /**
  * @file PriorityScheduler.h
- * @brief Priority-based scheduler skeleton.
- *
- * For now, all processes are assigned a default priority of 0
- * (until Process is extended with an explicit priority).
+ * @brief Priority-based scheduler over an O(1) bitmap-indexed priority array.
  */
 
 #pragma once
 
-#include <deque>
-#include <map>
+#include <cstdint>
 #include <mutex>
+#include <unordered_map>
 
 #include "IScheduler.h"
+#include "PriorityArray.h"
 #include "waos/common/DataStructures.h"
 
 namespace waos::core {
@@ -23,29 +21,76 @@ namespace waos::scheduler {
 
 /**
  * @class PriorityScheduler
- * @brief Priority scheduler stub (multiple queues per priority level).
+ * @brief Strict priority scheduler with one FIFO per priority level.
+ *
+ * Lower integer value denotes higher priority (0 = highest). Enqueue, selection,
+ * removal, re-prioritisation and hasReadyProcesses() are O(1) for priorities
+ * in [0, PriorityArray::LEVELS). Scheduling is preemptive: a process that
+ * becomes READY (arrival, I/O completion or page-fault resolution) with a
+ * strictly better effective priority than the running one takes the CPU.
  *
- * Lower integer value denotes higher priority (0 = highest).
+ * Optional aging bounds starvation: a ready process gains one level for every
+ * agingInterval boundary it spends in READY (effective priority =
+ * priority - epochs waited, never below 0). Aging is lazy: when the clock has
+ * crossed k epochs, the next enqueue or selection promotes every level by k
+ * with one splice per occupied level, so it costs nothing per tick and does
+ * not depend on the number of ready processes. Epochs are aligned to the
+ * clock, so the first level may be gained less than agingInterval ticks after
+ * entering READY.
  */
 class PriorityScheduler : public IScheduler {
  public:
-  PriorityScheduler();
+  /**
+   * @param clockRef Simulation clock for aging and wait statistics (may be null if agingInterval is 0).
+   * @param agingInterval Ticks in READY per level gained; 0 disables aging.
+   * @param starvationThreshold READY wait (ticks) counted as starvation; 0 disables the count.
+   * @throws std::invalid_argument If aging is enabled without a clock.
+   */
+  explicit PriorityScheduler(const uint64_t* clockRef = nullptr, uint64_t agingInterval = 0,
+                             uint64_t starvationThreshold = 0);
   ~PriorityScheduler() override = default;
 
   void addProcess(waos::core::Process* p) override;
   waos::core::Process* getNextProcess() override;
   bool hasReadyProcesses() const override;
+  size_t getReadyCount() const override;
   int getTimeSlice() const override;
+  bool removeProcess(int pid) override;
+  bool updateKey(int pid) override;
+  bool shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const override;
 
   // Métodos de Observación
   std::vector<const waos::core::Process*> peekReadyQueue() const override;
+  void forEachReady(const ReadyVisitor& visit) const override;
+  uint64_t getReadyQueueVersion() const override;
   std::string getAlgorithmName() const override;
   waos::common::SchedulerMetrics getSchedulerMetrics() const override;
 
+  /**
+   * @brief Effective (aged) priority of a ready process (0 if it is not queued).
+   */
+  int getEffectivePriority(int pid) const;
+
  private:
+  struct Entry {
+    int basePriority;  // Process priority when enqueued (or last updateKey)
+    uint64_t epoch;    // Aging epoch when it became ready
+  };
+
+  uint64_t currentEpoch() const;                // Caller holds m_mutex
+  int effectivePriority(const Entry& e) const;  // Caller holds m_mutex
+  void applyAging();                            // Caller holds m_mutex
+
+  const uint64_t* m_clockRef;
+  uint64_t m_agingInterval;
+  uint64_t m_starvationThreshold;
+  uint64_t m_agingEpoch = 0;  // Epoch up to which levels have been promoted
+
   mutable std::mutex m_mutex;
-  std::map<int, std::deque<waos::core::Process*>> m_queues;  // < priority to queue
+  PriorityArray m_queues;  // Priority -> FIFO, with a bitmap of non-empty levels
+  std::unordered_map<int, Entry> m_entries;
   waos::common::SchedulerMetrics m_metrics;
+  uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
 };
 
 }  // namespace waos::scheduler
@@ -8,7 +8,8 @@
 #pragma once
 
 #include "IScheduler.h"
-#include <queue>
+#include <list>
+#include <unordered_map>
 #include <mutex>
 #include "waos/common/DataStructures.h"
 
@@ -33,17 +34,24 @@ public:
     void addProcess(waos::core::Process* p) override;
     waos::core::Process* getNextProcess() override;
     bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
     int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
 
     std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
     std::string getAlgorithmName() const override;
     waos::common::SchedulerMetrics getSchedulerMetrics() const override;
 
 private:
     int m_quantum;
     mutable std::mutex m_mutex;
-    std::queue<waos::core::Process*> m_queue;
+    std::list<waos::core::Process*> m_queue;  // Iterable FIFO
+    std::unordered_map<int, std::list<waos::core::Process*>::iterator> m_handles;  // PID -> queue node
     waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
 };
 
 }
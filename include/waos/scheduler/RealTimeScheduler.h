@@ -0,0 +1,104 @@
+/**
+ * @file RealTimeScheduler.h
+ * @brief Preemptive real-time schedulers: Earliest Deadline First and Rate Monotonic.
+ */
+
+#pragma once
+
+#include "IScheduler.h"
+#include "IndexedProcessHeap.h"
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+enum class RealTimePolicy {
+    EDF,            // Dynamic priority: earliest absolute deadline first
+    RATE_MONOTONIC  // Static priority: shortest period first
+};
+
+/**
+ * @struct RealTimeTask
+ * @brief A periodic task for offline schedulability analysis.
+ */
+struct RealTimeTask {
+    int id;
+    uint64_t cost;      // CPU demand of one job (C)
+    uint64_t period;    // T
+    uint64_t deadline;  // Relative deadline (D <= T); 0 means D = T
+};
+
+/**
+ * @struct SchedulabilityReport
+ * @brief Result of RealTimeScheduler::analyze().
+ */
+struct SchedulabilityReport {
+    double utilization = 0.0;             // Sum of C/T
+    double bound = 0.0;                   // EDF: 1.0; RM: Liu-Layland n(2^(1/n) - 1)
+    bool schedulable = false;
+    std::vector<uint64_t> responseTimes;  // RM only, worst-case response per task (input order)
+};
+
+/**
+ * @class RealTimeScheduler
+ * @brief Deadline-aware scheduler over an indexed min-heap.
+ *
+ * EDF keys each job by its absolute deadline; Rate Monotonic by its task period
+ * (falling back to the relative deadline, i.e. deadline monotonic, for aperiodic
+ * jobs). Processes without real-time parameters are served FIFO after every
+ * real-time job. Both policies are preemptive: a job released with a higher
+ * priority than the running one takes the CPU through shouldPreempt().
+ * Insertion and selection are O(log n).
+ */
+class RealTimeScheduler : public IScheduler {
+public:
+    explicit RealTimeScheduler(RealTimePolicy policy = RealTimePolicy::EDF);
+    ~RealTimeScheduler() override = default;
+
+    void addProcess(waos::core::Process* p) override;
+    waos::core::Process* getNextProcess() override;
+    bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
+    int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+    bool shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const override;
+
+    // Métodos de Observación
+    std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
+    std::string getAlgorithmName() const override;
+    waos::common::SchedulerMetrics getSchedulerMetrics() const override;
+
+    RealTimePolicy getPolicy() const;
+
+    /**
+     * @brief Offline schedulability test for a periodic task set on one CPU.
+     *
+     * EDF: density test sum(C / min(D, T)) <= 1 (exact when D = T).
+     * RM: exact response-time analysis, R = C + sum over higher-priority tasks
+     * of ceil(R / Tj) * Cj, schedulable if every R <= D.
+     * Context-switch and page-fault overheads are not included.
+     *
+     * @throws std::invalid_argument If a task has a zero period or cost.
+     */
+    static SchedulabilityReport analyze(RealTimePolicy policy, const std::vector<RealTimeTask>& tasks);
+
+private:
+    IndexedProcessHeap::Key keyFor(const waos::core::Process* p) const;
+
+    RealTimePolicy m_policy;
+    mutable std::mutex m_mutex;
+    IndexedProcessHeap m_readyHeap;
+    waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
+};
+
+}
@@ -1,15 +1,15 @@
 /**
  * @file SJFScheduler.h
- * @brief Shortest Job First scheduler using priority queue.
+ * @brief Shortest Job First scheduler, optionally preemptive (SRTF).
  *
- * Implements SJF algorithm using std::priority_queue for O(log n) insertions.
+ * Implements SJF over an indexed 4-ary min-heap for O(log n) insertions.
  */
 
 #pragma once
 
 #include "IScheduler.h"
+#include "IndexedProcessHeap.h"
 #include <vector>
-#include <queue>
 #include <mutex>
 #include "waos/common/DataStructures.h"
 
@@ -21,40 +21,46 @@ namespace waos::scheduler {
 
 /**
  * @class SJFScheduler
- * @brief Shortest Job First scheduler using priority queue.
+ * @brief Shortest Job First scheduler using an indexed 4-ary min-heap.
  *
- * Uses std::priority_queue with custom comparator to maintain processes
- * ordered by current CPU burst duration. Provides O(log n) insertion
- * and O(log n) extraction complexity.
+ * Processes are ordered by their current CPU burst, read once at enqueue time.
+ * In preemptive mode (Shortest Remaining Time First) a process that becomes
+ * ready with a shorter remaining burst than the running one preempts it; the
+ * check compares against the heap top in O(1) and the preempted process is
+ * re-inserted in O(log n).
  */
 class SJFScheduler : public IScheduler {
 public:
-    SJFScheduler();
+    /**
+     * @param preemptive true for SRTF, false for classic non-preemptive SJF.
+     */
+    explicit SJFScheduler(bool preemptive = false);
     ~SJFScheduler() override = default;
 
     void addProcess(waos::core::Process* p) override;
     waos::core::Process* getNextProcess() override;
     bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
     int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+    bool shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const override;
 
     // Métodos de Observación
     std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
     std::string getAlgorithmName() const override;
     waos::common::SchedulerMetrics getSchedulerMetrics() const override;
 
-private:
-    /**
-     * @brief Comparator for priority queue (min-heap by burst duration)
-     */
-    struct ProcessComparator {
-        bool operator()(waos::core::Process* a, waos::core::Process* b) const;
-    };
+    bool isPreemptive() const;
 
+private:
+    bool m_preemptive;
     mutable std::mutex m_mutex;
-    std::priority_queue<waos::core::Process*, 
-                        std::vector<waos::core::Process*>,
-                        ProcessComparator> m_priorityQueue;
+    IndexedProcessHeap m_readyHeap;  // Keyed by remaining CPU burst
     waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
 };
 
 }
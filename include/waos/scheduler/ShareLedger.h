@@ -0,0 +1,54 @@
+/**
+ * @file ShareLedger.h
+ * @brief Entitled vs. achieved CPU share bookkeeping for proportional-share schedulers.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class ShareLedger
+ * @brief Tracks tickets and consumed CPU of every process a scheduler has seen.
+ *
+ * Entitled share is tickets / total tickets; achieved share is CPU ticks /
+ * total CPU ticks, both over all processes recorded so far. CPU time is read
+ * from Process stats when the process passes through the scheduler, so the
+ * running process's current slice shows up on its next enqueue.
+ * Not thread-safe: owners hold their own mutex.
+ */
+class ShareLedger {
+public:
+    /**
+     * @brief Refreshes a process's tickets and cumulative CPU time.
+     * @return CPU ticks consumed since the previous record of this process.
+     */
+    uint64_t record(const waos::core::Process* p);
+
+    /**
+     * @brief Writes tickets, entitledShare and achievedShare into the metrics.
+     */
+    void fill(waos::common::SchedulerMetrics& metrics) const;
+
+    void clear();
+
+private:
+    struct Account {
+        int tickets = 0;
+        uint64_t cpuTicks = 0;
+    };
+
+    std::map<int, Account> m_accounts;
+    uint64_t m_totalTickets = 0;
+    uint64_t m_totalCpu = 0;
+};
+
+}
@@ -0,0 +1,75 @@
+/**
+ * @file StrideScheduler.h
+ * @brief Deterministic proportional-share scheduler (stride scheduling).
+ */
+
+#pragma once
+
+#include "IScheduler.h"
+#include "IndexedProcessHeap.h"
+#include "ShareLedger.h"
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include "waos/common/DataStructures.h"
+
+namespace waos::core {
+    class Process;
+}
+
+namespace waos::scheduler {
+
+/**
+ * @class StrideScheduler
+ * @brief Runs the ready process with the smallest pass value.
+ *
+ * Each process has stride = STRIDE1 / tickets and advances its pass by
+ * stride for every CPU tick it consumes. Over any interval a process receives
+ * CPU in proportion to its tickets (Process::getTickets()), with an error of
+ * at most one quantum. A process (re)joining the queue starts no earlier than
+ * the global pass, so blocking does not bank credit. When the tickets of a
+ * queued process change, updateKey() rescales its remaining pass to the new
+ * stride.
+ */
+class StrideScheduler : public IScheduler {
+public:
+    static constexpr int64_t STRIDE1 = int64_t(1) << 20;
+
+    /**
+     * @param quantum Ticks a process runs before its pass is re-evaluated.
+     */
+    explicit StrideScheduler(int quantum = 2);
+    ~StrideScheduler() override = default;
+
+    void addProcess(waos::core::Process* p) override;
+    waos::core::Process* getNextProcess() override;
+    bool hasReadyProcesses() const override;
+    size_t getReadyCount() const override;
+    int getTimeSlice() const override;
+    bool removeProcess(int pid) override;
+    bool updateKey(int pid) override;
+    void onProcessTerminated(int pid) override;
+
+    // Métodos de Observación
+    std::vector<const waos::core::Process*> peekReadyQueue() const override;
+    void forEachReady(const ReadyVisitor& visit) const override;
+    uint64_t getReadyQueueVersion() const override;
+    std::string getAlgorithmName() const override;
+    waos::common::SchedulerMetrics getSchedulerMetrics() const override;
+
+    int64_t getPass(int pid) const;
+
+private:
+    int m_quantum;
+    mutable std::mutex m_mutex;
+    IndexedProcessHeap m_readyHeap;  // Keyed by pass
+    std::unordered_map<int, int64_t> m_pass;
+    std::unordered_map<int, int64_t> m_strides;  // Stride at the last enqueue
+    int64_t m_globalPass = 0;        // Pass of the last process dispatched
+    ShareLedger m_ledger;
+    waos::common::SchedulerMetrics m_metrics;
+    uint64_t m_readyVersion = 1;  // Bumped on every ready-queue change
+};
+
+}
@@ -0,0 +1,148 @@
+#include "waos/core/ChromeTraceWriter.h"
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+
+namespace waos::core {
+
+namespace {
+
+constexpr int KERNEL_PID = 0;
+constexpr int PROCESSES_PID = 1;
+constexpr int CPU_TID = 0;
+
+constexpr const char* COUNTER_NAMES[4] = {"ready", "blocked", "memory_wait", "used_frames"};
+
+const char* stateName(ProcessState state) {
+  switch (state) {
+    case ProcessState::READY:
+      return "READY";
+    case ProcessState::RUNNING:
+      return "RUNNING";
+    case ProcessState::BLOCKED:
+      return "BLOCKED";
+    case ProcessState::WAITING_MEMORY:
+      return "WAITING_MEMORY";
+    default:
+      return nullptr;  // NEW and TERMINATED have no span
+  }
+}
+
+std::string metadata(const char* kind, int pid, int tid, const std::string& argName, const std::string& value) {
+  return "{\"name\":\"" + std::string(kind) + "\",\"ph\":\"M\",\"pid\":" + std::to_string(pid) +
+         ",\"tid\":" + std::to_string(tid) + ",\"args\":{\"" + argName + "\":" + value + "}}";
+}
+
+}  // namespace
+
+ChromeTraceWriter::ChromeTraceWriter(std::ostream& out, uint64_t microsPerTick)
+    : m_out(out), m_microsPerTick(microsPerTick ? microsPerTick : 1) {
+  writeHeader();
+}
+
+ChromeTraceWriter::ChromeTraceWriter(const std::string& path, uint64_t microsPerTick)
+    : m_file(path, std::ios::out | std::ios::trunc), m_out(m_file), m_microsPerTick(microsPerTick ? microsPerTick : 1) {
+  if (!m_file) throw std::runtime_error("Cannot create trace file: " + path);
+  writeHeader();
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() {
+  finish(m_lastTick);
+}
+
+void ChromeTraceWriter::writeHeader() {
+  m_out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  m_out << metadata("process_name", KERNEL_PID, 0, "name", "\"Kernel\"") << ",\n";
+  m_out << metadata("process_name", PROCESSES_PID, 0, "name", "\"Processes\"") << ",\n";
+  m_out << metadata("thread_name", KERNEL_PID, CPU_TID, "name", "\"CPU\"");
+}
+
+void ChromeTraceWriter::writeEvent(const std::string& json) {
+  m_out << ",\n" << json;
+  m_events++;
+}
+
+void ChromeTraceWriter::writeSpan(const char* name, int tracePid, int tid, uint64_t start, uint64_t end) {
+  if (end <= start) return;  // A state left within the tick it was entered
+  writeEvent("{\"name\":\"" + std::string(name) + "\",\"ph\":\"X\",\"ts\":" + std::to_string(micros(start)) +
+             ",\"dur\":" + std::to_string(micros(end - start)) + ",\"pid\":" + std::to_string(tracePid) +
+             ",\"tid\":" + std::to_string(tid) + "}");
+}
+
+void ChromeTraceWriter::processState(int pid, ProcessState state, uint64_t tick) {
+  if (m_finished) return;
+  m_lastTick = std::max(m_lastTick, tick);
+  if (m_namedThreads.insert(pid).second) {
+    m_out << ",\n" << metadata("thread_name", PROCESSES_PID, pid, "name", "\"P" + std::to_string(pid) + "\"");
+    m_out << ",\n" << metadata("thread_sort_index", PROCESSES_PID, pid, "sort_index", std::to_string(pid));
+  }
+
+  auto it = m_openSpans.find(pid);
+  if (it != m_openSpans.end()) {
+    if (it->second.state == state) return;
+    writeSpan(stateName(it->second.state), PROCESSES_PID, pid, it->second.start, tick);
+    m_openSpans.erase(it);
+  }
+  if (stateName(state)) m_openSpans.emplace(pid, Span{state, tick});
+}
+
+void ChromeTraceWriter::cpuActivity(CpuActivity activity, int pid, uint64_t tick) {
+  if (m_finished) return;
+  m_lastTick = std::max(m_lastTick, tick + 1);
+  if (activity != CpuActivity::BUSY) pid = -1;
+
+  // Extend the open span while the CPU keeps doing the same thing on consecutive ticks
+  if (m_cpu.open && m_cpu.activity == activity && m_cpu.pid == pid && m_cpu.end == tick) {
+    m_cpu.end = tick + 1;
+    return;
+  }
+  closeCpuSpan();
+  m_cpu = {activity, pid, tick, tick + 1, true};
+}
+
+void ChromeTraceWriter::closeCpuSpan() {
+  if (!m_cpu.open) return;
+  m_cpu.open = false;
+  switch (m_cpu.activity) {
+    case CpuActivity::IDLE:
+      writeSpan("idle", KERNEL_PID, CPU_TID, m_cpu.start, m_cpu.end);
+      break;
+    case CpuActivity::CONTEXT_SWITCH:
+      writeSpan("context switch", KERNEL_PID, CPU_TID, m_cpu.start, m_cpu.end);
+      break;
+    case CpuActivity::BUSY:
+      writeSpan(("P" + std::to_string(m_cpu.pid)).c_str(), KERNEL_PID, CPU_TID, m_cpu.start, m_cpu.end);
+      break;
+  }
+}
+
+void ChromeTraceWriter::counters(uint64_t tick, uint32_t ready, uint32_t blocked, uint32_t memoryWait,
+                                 uint32_t usedFrames) {
+  if (m_finished) return;
+  m_lastTick = std::max(m_lastTick, tick);
+  const uint32_t values[4] = {ready, blocked, memoryWait, usedFrames};
+  for (int i = 0; i < 4; ++i) {
+    if (m_hasCounters && values[i] == m_lastCounters[i]) continue;
+    m_lastCounters[i] = values[i];
+    writeEvent("{\"name\":\"" + std::string(COUNTER_NAMES[i]) + "\",\"ph\":\"C\",\"ts\":" +
+               std::to_string(micros(tick)) + ",\"pid\":" + std::to_string(KERNEL_PID) + ",\"args\":{\"value\":" +
+               std::to_string(values[i]) + "}}");
+  }
+  m_hasCounters = true;
+}
+
+void ChromeTraceWriter::finish(uint64_t tick) {
+  if (m_finished) return;
+  tick = std::max(tick, m_lastTick);
+  closeCpuSpan();
+  for (const auto& pair : m_openSpans) {
+    writeSpan(stateName(pair.second.state), PROCESSES_PID, pair.first, pair.second.start, tick);
+  }
+  m_openSpans.clear();
+  m_out << "\n]}\n";
+  m_out.flush();
+  m_finished = true;
+}
+
+}  // namespace waos::core
@@ -0,0 +1,322 @@
+#include "waos/core/EventLog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace waos::core {
+
+namespace {
+
+constexpr char MAGIC[8] = {'W', 'A', 'O', 'S', 'E', 'V', '0', '1'};
+constexpr size_t HEADER_SIZE = 32;  // Magic, record size u32, flags u32, record count u64, reserved u64
+constexpr size_t RECORD_SIZE = 32;
+constexpr uint32_t FLAG_CLOSED = 1;
+
+void putLittleEndian(char* out, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) out[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+}
+
+uint64_t getLittleEndian(const char* in, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < bytes; ++i) value |= uint64_t(static_cast<unsigned char>(in[i])) << (8 * i);
+  return value;
+}
+
+void encodeHeader(char* out, uint32_t flags, uint64_t records) {
+  std::memcpy(out, MAGIC, sizeof(MAGIC));
+  putLittleEndian(out + 8, RECORD_SIZE, 4);
+  putLittleEndian(out + 12, flags, 4);
+  putLittleEndian(out + 16, records, 8);
+  putLittleEndian(out + 24, 0, 8);
+}
+
+void encode(char* out, const EventRecord& record) {
+  putLittleEndian(out, record.tick, 8);
+  putLittleEndian(out + 8, record.page, 8);
+  putLittleEndian(out + 16, static_cast<uint32_t>(record.pid), 4);
+  putLittleEndian(out + 20, static_cast<uint32_t>(record.frame), 4);
+  out[24] = static_cast<char>(record.oldState);
+  out[25] = static_cast<char>(record.newState);
+  out[26] = static_cast<char>(record.cause);
+  std::memset(out + 27, 0, RECORD_SIZE - 27);
+}
+
+EventRecord decode(const char* in) {
+  EventRecord record;
+  record.tick = getLittleEndian(in, 8);
+  record.page = getLittleEndian(in + 8, 8);
+  record.pid = static_cast<int32_t>(getLittleEndian(in + 16, 4));
+  record.frame = static_cast<int32_t>(getLittleEndian(in + 20, 4));
+  record.oldState = static_cast<ProcessState>(static_cast<unsigned char>(in[24]));
+  record.newState = static_cast<ProcessState>(static_cast<unsigned char>(in[25]));
+  record.cause = static_cast<TransitionCause>(static_cast<unsigned char>(in[26]));
+  return record;
+}
+
+template <typename T>
+void removeValue(std::vector<T>& values, const T& value) {
+  auto it = std::find(values.begin(), values.end(), value);
+  if (it != values.end()) values.erase(it);
+}
+
+}  // namespace
+
+// --- EventLogWriter ---
+
+EventLogWriter::EventLogWriter(const std::string& path, EventLogOptions options) : m_options(options) {
+  m_options.bufferRecords = std::max<size_t>(m_options.bufferRecords, 1);
+  char header[HEADER_SIZE];
+  encodeHeader(header, 0, 0);
+
+#ifndef _WIN32
+  if (m_options.memoryMapped) {
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_fd < 0) throw std::runtime_error("Cannot create event log: " + path);
+    try {
+      growMapping(HEADER_SIZE + m_options.bufferRecords * RECORD_SIZE);
+    } catch (const std::runtime_error&) {
+      ::close(m_fd);
+      throw;
+    }
+    std::memcpy(m_mapped, header, HEADER_SIZE);
+    return;
+  }
+#endif
+
+  m_file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!m_file) throw std::runtime_error("Cannot create event log: " + path);
+  m_file.write(header, HEADER_SIZE);
+  m_buffer.resize(m_options.bufferRecords * RECORD_SIZE);
+}
+
+EventLogWriter::~EventLogWriter() {
+  try {
+    close();
+  } catch (const std::exception&) {
+    // Destructors must not throw; the records already written stay readable
+  }
+}
+
+void EventLogWriter::append(const EventRecord& record) {
+  if (m_closed) return;
+
+  if (m_mapped) {
+    size_t offset = HEADER_SIZE + m_records * RECORD_SIZE;
+    if (offset + RECORD_SIZE > m_capacity) growMapping(m_capacity * 2);
+    encode(m_mapped + offset, record);
+  } else {
+    if (m_buffered == m_buffer.size()) writeBuffer();
+    encode(m_buffer.data() + m_buffered, record);
+    m_buffered += RECORD_SIZE;
+  }
+  m_records++;
+}
+
+void EventLogWriter::writeBuffer() {
+  m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffered));
+  m_buffered = 0;
+}
+
+void EventLogWriter::flush() {
+  if (m_closed) return;
+#ifndef _WIN32
+  if (m_mapped) {
+    ::msync(m_mapped, m_capacity, MS_ASYNC);
+    return;
+  }
+#endif
+  writeBuffer();
+  m_file.flush();
+}
+
+void EventLogWriter::close() {
+  if (m_closed) return;
+  m_closed = true;
+
+  char header[HEADER_SIZE];
+  encodeHeader(header, FLAG_CLOSED, m_records);
+
+  if (m_mapped) {
+    std::memcpy(m_mapped, header, HEADER_SIZE);
+    unmap();
+#ifndef _WIN32
+    // Drop the unused tail of the last growth step
+    bool trimmed = ::ftruncate(m_fd, static_cast<off_t>(HEADER_SIZE + m_records * RECORD_SIZE)) == 0;
+    ::close(m_fd);
+    m_fd = -1;
+    if (!trimmed) throw std::runtime_error("Cannot trim event log");
+#endif
+    return;
+  }
+
+  writeBuffer();
+  m_file.seekp(0);
+  m_file.write(header, HEADER_SIZE);
+  m_file.close();
+}
+
+void EventLogWriter::growMapping(size_t bytes) {
+#ifndef _WIN32
+  // The old mapping stays in place until the new one exists, so a failed growth loses nothing
+  if (::ftruncate(m_fd, static_cast<off_t>(bytes)) != 0) throw std::runtime_error("Cannot grow event log");
+  void* mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (mapping == MAP_FAILED) throw std::runtime_error("Cannot map event log");
+  unmap();
+  m_mapped = static_cast<char*>(mapping);
+  m_capacity = bytes;
+#else
+  (void)bytes;
+#endif
+}
+
+void EventLogWriter::unmap() {
+#ifndef _WIN32
+  if (m_mapped) ::munmap(m_mapped, m_capacity);
+#endif
+  m_mapped = nullptr;
+}
+
+// --- EventLogReader ---
+
+EventLogReader::EventLogReader(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) throw std::runtime_error("Cannot open event log: " + path);
+  std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+  if (data.size() < HEADER_SIZE || !std::equal(MAGIC, MAGIC + sizeof(MAGIC), data.begin())) {
+    throw std::runtime_error("Not a WaOS event log: " + path);
+  }
+  if (getLittleEndian(data.data() + 8, 4) != RECORD_SIZE) throw std::runtime_error("Unsupported event record size");
+
+  m_complete = (getLittleEndian(data.data() + 12, 4) & FLAG_CLOSED) != 0;
+  size_t available = (data.size() - HEADER_SIZE) / RECORD_SIZE;
+  size_t count = available;
+  if (m_complete) {
+    count = getLittleEndian(data.data() + 16, 8);
+    if (count > available) throw std::runtime_error("Truncated event log: " + path);
+  }
+
+  m_records.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    EventRecord record = decode(data.data() + HEADER_SIZE + i * RECORD_SIZE);
+    if (record.cause == TransitionCause::NONE) break;  // Unwritten tail of an unclosed mapped log
+    m_records.push_back(record);
+  }
+}
+
+size_t EventLogReader::lowerBound(uint64_t tick) const {
+  auto it = std::lower_bound(m_records.begin(), m_records.end(), tick,
+                             [](const EventRecord& record, uint64_t t) { return record.tick < t; });
+  return static_cast<size_t>(it - m_records.begin());
+}
+
+// --- EventLogReplay ---
+
+EventLogReplay::EventLogReplay(const EventLogReader& log) : m_log(log), m_loadTicks(log.size(), 0) {
+  // One pass pairs each fault with the load that resolves it, so waits can count down
+  std::unordered_map<int, size_t> openFault;  // By PID
+  for (size_t i = 0; i < log.size(); ++i) {
+    const EventRecord& record = log.at(i);
+    if (record.cause == TransitionCause::PAGE_FAULT) {
+      openFault[record.pid] = i;
+    } else if (record.cause == TransitionCause::PAGE_LOADED) {
+      auto it = openFault.find(record.pid);
+      if (it == openFault.end()) continue;
+      m_loadTicks[it->second] = record.tick;
+      openFault.erase(it);
+    }
+  }
+}
+
+void EventLogReplay::restart() {
+  m_next = 0;
+  m_tick = 0;
+  m_states.clear();
+  m_runningPid = -1;
+  m_switching = false;
+  m_ready.clear();
+  m_blocked.clear();
+  m_loading.clear();
+  m_completed = 0;
+}
+
+void EventLogReplay::seek(uint64_t tick) {
+  if (tick < m_tick) restart();
+  m_tick = tick;
+  while (m_next < m_log.size() && m_log.at(m_next).tick < tick) apply(m_next++);
+}
+
+void EventLogReplay::apply(size_t index) {
+  const EventRecord& record = m_log.at(index);
+  if (record.cause == TransitionCause::SWITCH_BEGIN || record.cause == TransitionCause::SWITCH_END) {
+    m_switching = (record.cause == TransitionCause::SWITCH_BEGIN);
+    return;
+  }
+
+  // Leave the list of the old state, then join the list of the new one
+  switch (record.oldState) {
+    case ProcessState::READY:
+      removeValue(m_ready, record.pid);
+      break;
+    case ProcessState::RUNNING:
+      if (m_runningPid == record.pid) m_runningPid = -1;
+      break;
+    case ProcessState::BLOCKED:
+      removeValue(m_blocked, record.pid);
+      break;
+    case ProcessState::WAITING_MEMORY:
+      m_loading.erase(std::remove_if(m_loading.begin(), m_loading.end(),
+                                     [&](const PendingLoad& load) { return load.pid == record.pid; }),
+                      m_loading.end());
+      break;
+    default:
+      break;
+  }
+
+  switch (record.newState) {
+    case ProcessState::READY:
+      m_ready.push_back(record.pid);
+      break;
+    case ProcessState::RUNNING:
+      m_runningPid = record.pid;
+      break;
+    case ProcessState::BLOCKED:
+      m_blocked.push_back(record.pid);
+      break;
+    case ProcessState::WAITING_MEMORY:
+      m_loading.push_back({record.pid, record.page, m_loadTicks[index]});
+      break;
+    case ProcessState::TERMINATED:
+      m_completed++;
+      break;
+    default:
+      break;
+  }
+  m_states[record.pid] = record.newState;
+}
+
+ProcessState EventLogReplay::stateOf(int pid) const {
+  auto it = m_states.find(pid);
+  return it == m_states.end() ? ProcessState::NEW : it->second;
+}
+
+std::vector<waos::common::MemoryWaitInfo> EventLogReplay::memoryWaits() const {
+  std::vector<waos::common::MemoryWaitInfo> result;
+  result.reserve(m_loading.size());
+  for (const auto& load : m_loading) {
+    // The load completes during step loadTick, so before step t there are loadTick - t + 1 ticks left
+    int remaining = load.loadTick >= m_tick ? static_cast<int>(load.loadTick - m_tick + 1) : 0;
+    result.push_back({load.pid, load.page, remaining});
+  }
+  return result;
+}
+
+}  // namespace waos::core
@@ -0,0 +1,91 @@
+#include "waos/core/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace waos::core {
+
+namespace {
+
+int highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - __builtin_clzll(value);
+#else
+  int bit = 0;
+  while (value >>= 1) bit++;
+  return bit;
+#endif
+}
+
+}  // namespace
+
+int LatencyHistogram::bucketOf(uint64_t value) {
+  if (value < EXACT_LIMIT) return static_cast<int>(value);
+  int exponent = highestBit(value);  // >= SUB_BITS + 1
+
+  // The SUB_BITS bits right below the leading one pick the sub-bucket
+  int subBucket = static_cast<int>(value >> (exponent - SUB_BITS)) - (1 << SUB_BITS);
+  return EXACT_LIMIT + (exponent - SUB_BITS - 1) * (1 << SUB_BITS) + subBucket;
+}
+
+uint64_t LatencyHistogram::highestValueIn(int bucket) {
+  if (bucket < EXACT_LIMIT) return static_cast<uint64_t>(bucket);
+  int offset = bucket - EXACT_LIMIT;
+  int shift = offset / (1 << SUB_BITS) + 1;
+  uint64_t mantissa = (uint64_t(1) << SUB_BITS) + static_cast<uint64_t>(offset % (1 << SUB_BITS));
+  return (mantissa << shift) + ((uint64_t(1) << shift) - 1);
+}
+
+void LatencyHistogram::record(uint64_t value) {
+  int bucket = bucketOf(value);
+  m_counts[bucket]++;
+  m_highestBucket = std::max(m_highestBucket, bucket);
+  m_min = (m_count == 0) ? value : std::min(m_min, value);
+  m_max = std::max(m_max, value);
+  m_sum += value;
+  m_count++;
+}
+
+void LatencyHistogram::clear() {
+  // Only buckets up to the highest used one can be non-zero
+  std::fill(m_counts.begin(), m_counts.begin() + (m_highestBucket + 1), 0);
+  m_count = 0;
+  m_min = 0;
+  m_max = 0;
+  m_sum = 0;
+  m_highestBucket = -1;
+}
+
+double LatencyHistogram::mean() const {
+  return m_count ? static_cast<double>(m_sum) / static_cast<double>(m_count) : 0.0;
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+  if (m_count == 0) return 0;
+  percentile = std::clamp(percentile, 0.0, 100.0);
+
+  // Rank of the value to report (1-based), as in the nearest-rank method
+  uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_count)));
+  rank = std::max<uint64_t>(rank, 1);
+
+  uint64_t seen = 0;
+  for (int bucket = 0; bucket <= m_highestBucket; ++bucket) {
+    seen += m_counts[bucket];
+    if (seen >= rank) return std::min(highestValueIn(bucket), m_max);
+  }
+  return m_max;
+}
+
+waos::common::LatencyStats LatencyHistogram::summary() const {
+  waos::common::LatencyStats stats;
+  stats.count = static_cast<int>(m_count);
+  stats.min = min();
+  stats.max = m_max;
+  stats.mean = mean();
+  stats.p50 = valueAtPercentile(50.0);
+  stats.p95 = valueAtPercentile(95.0);
+  stats.p99 = valueAtPercentile(99.0);
+  return stats;
+}
+
+}  // namespace waos::core
@@ -13,6 +13,7 @@ namespace waos::core {
     }
 
     std::vector<ProcessInfo> processes;
+    std::map<std::string, SharedRegionInfo> regions;
     std::string line;
     int lineNumber = 0;
 
@@ -20,14 +21,20 @@ namespace waos::core {
       lineNumber++;
       if (line.empty() || line[0] == '#') continue; // Skip empty lines and comments
 
-      auto processInfoOpt = parseLine(line, lineNumber);
+      if (line.rfind("REGION", 0) == 0) {
+        parseRegion(line, lineNumber, regions);
+        continue;
+      }
+
+      auto processInfoOpt = parseLine(line, lineNumber, regions);
       if (processInfoOpt) processes.push_back(*processInfoOpt);
     }
 
     return processes;
   }
 
-  std::optional<ProcessInfo> Parser::parseLine(const std::string& line, int lineNumber) {
+  std::optional<ProcessInfo> Parser::parseLine(const std::string& line, int lineNumber,
+                                               const std::map<std::string, SharedRegionInfo>& regions) {
     std::stringstream ss(line);
     ProcessInfo info;
     std::string pidStr, burstsStr;
@@ -51,13 +58,16 @@ namespace waos::core {
       }
     }
     
-    ss >> info.requiredPages;
+    std::string pagesStr;
+    ss >> pagesStr;
+    std::optional<waos::common::PageNumber> requiredPages = parsePageNumber(pagesStr);
 
-    if (ss.fail()) {
+    if (ss.fail() || !requiredPages) {
       std::cerr << "Warning: Invalid format on line " << lineNumber << ". Skipping." << std::endl;
       return std::nullopt;
     }
-    
+    info.requiredPages = *requiredPages;
+
     // Parse PID ("P1" to 1)
     try {
       if (pidStr.length() > 1 && (pidStr[0] == 'P' || pidStr[0] == 'p')) {
@@ -107,7 +117,128 @@ namespace waos::core {
       return std::nullopt;
     }
 
+    // Optional trailing tokens: SHM(name@page), COW(name@page), TICKETS(n), DEADLINE(d), PERIOD(p), JOBS(n)
+    std::string extraToken;
+    while (ss >> extraToken) {
+      if (extraToken.rfind("TICKETS(", 0) == 0) {
+        if (auto value = parseCountToken(extraToken, lineNumber)) info.tickets = *value;
+      } else if (extraToken.rfind("DEADLINE(", 0) == 0) {
+        if (auto value = parseCountToken(extraToken, lineNumber)) info.deadline = *value;
+      } else if (extraToken.rfind("PERIOD(", 0) == 0) {
+        if (auto value = parseCountToken(extraToken, lineNumber)) info.period = *value;
+      } else if (extraToken.rfind("JOBS(", 0) == 0) {
+        if (auto value = parseCountToken(extraToken, lineNumber)) info.jobs = *value;
+      } else if (extraToken.rfind("SHM(", 0) == 0 || extraToken.rfind("COW(", 0) == 0) {
+        auto mapping = parseSharedMapping(extraToken, lineNumber, regions);
+        if (!mapping) continue;
+
+        if (mapping->pageCount > info.requiredPages || mapping->firstPage > info.requiredPages - mapping->pageCount) {
+          std::cerr << "Warning: Shared mapping '" << extraToken
+            << "' exceeds the address space on line " << lineNumber << ". Ignored." << std::endl;
+          continue;
+        }
+        info.sharedMappings.push_back(*mapping);
+      } else {
+        std::cerr << "Warning: Unknown token '" << extraToken
+          << "' on line " << lineNumber << ". Ignored." << std::endl;
+      }
+    }
+
+    // Implicit deadline: a periodic job must finish before the next release
+    if (info.period > 0 && info.deadline == 0) info.deadline = info.period;
+    if (info.period == 0 && info.jobs > 1) {
+      std::cerr << "Warning: JOBS without PERIOD on line " << lineNumber << ". Ignored." << std::endl;
+      info.jobs = 1;
+    }
+
     return info;
   }
 
+  void Parser::parseRegion(const std::string& line, int lineNumber,
+                           std::map<std::string, SharedRegionInfo>& regions) {
+    std::stringstream ss(line);
+    std::string keyword, name, pagesStr;
+
+    ss >> keyword >> name >> pagesStr;
+    std::optional<waos::common::PageNumber> pages = parsePageNumber(pagesStr);
+    if (ss.fail() || name.empty() || !pages || *pages == 0) {
+      std::cerr << "Warning: Invalid region declaration on line " << lineNumber << ". Skipping." << std::endl;
+      return;
+    }
+
+    if (regions.count(name)) {
+      std::cerr << "Warning: Region '" << name << "' redeclared on line " << lineNumber << ". Skipping." << std::endl;
+      return;
+    }
+
+    SharedRegionInfo region;
+    region.regionId = static_cast<int>(regions.size());
+    region.pageCount = *pages;
+    regions[name] = region;
+  }
+
+  std::optional<SharedMapping> Parser::parseSharedMapping(const std::string& token, int lineNumber,
+                                                          const std::map<std::string, SharedRegionInfo>& regions) {
+    size_t openParen = token.find('(');
+    size_t at = token.find('@');
+    size_t closeParen = token.find(')');
+
+    if (openParen == std::string::npos || at == std::string::npos || closeParen == std::string::npos ||
+        at < openParen || closeParen < at) {
+      std::cerr << "Warning: Invalid shared mapping '" << token << "' on line " << lineNumber << std::endl;
+      return std::nullopt;
+    }
+
+    std::string name = token.substr(openParen + 1, at - openParen - 1);
+    auto it = regions.find(name);
+    if (it == regions.end()) {
+      std::cerr << "Warning: Unknown region '" << name << "' on line " << lineNumber << std::endl;
+      return std::nullopt;
+    }
+
+    SharedMapping mapping;
+    mapping.regionId = it->second.regionId;
+    mapping.pageCount = it->second.pageCount;
+    mapping.copyOnWrite = (token.rfind("COW(", 0) == 0);
+
+    std::string pageStr = token.substr(at + 1, closeParen - at - 1);
+    if (!pageStr.empty() && pageStr[0] == '-') {
+      std::cerr << "Warning: Negative mapping page in '" << token << "' on line " << lineNumber << std::endl;
+      return std::nullopt;
+    }
+
+    std::optional<waos::common::PageNumber> firstPage = parsePageNumber(pageStr);
+    if (!firstPage) {
+      std::cerr << "Warning: Invalid mapping page in '" << token << "' on line " << lineNumber << std::endl;
+      return std::nullopt;
+    }
+    mapping.firstPage = *firstPage;
+    return mapping;
+  }
+
+  std::optional<int> Parser::parseCountToken(const std::string& token, int lineNumber) {
+    size_t openParen = token.find('(');
+    if (openParen != std::string::npos && token.back() == ')') {
+      try {
+        size_t consumed = 0;
+        std::string valueStr = token.substr(openParen + 1, token.size() - openParen - 2);
+        int value = std::stoi(valueStr, &consumed);
+        if (consumed == valueStr.size() && value > 0) return value;
+      } catch (...) {
+      }
+    }
+    std::cerr << "Warning: Invalid value in '" << token << "' on line " << lineNumber << ". Ignored." << std::endl;
+    return std::nullopt;
+  }
+
+  std::optional<waos::common::PageNumber> Parser::parsePageNumber(const std::string& text) {
+    // std::stoull accepts a leading '-' and wraps it around, so only digits are allowed
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) return std::nullopt;
+    try {
+      return static_cast<waos::common::PageNumber>(std::stoull(text));
+    } catch (...) {
+      return std::nullopt;  // Out of range
+    }
+  }
+
 }
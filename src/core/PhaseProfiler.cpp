@@ -0,0 +1,104 @@
+#include "waos/core/PhaseProfiler.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace waos::core {
+
+namespace {
+
+constexpr size_t PHASES = static_cast<size_t>(ProfilePhase::COUNT);
+
+constexpr const char* PHASE_NAMES[PHASES] = {"step",       "io",      "page_faults",    "cpu_execution", "arrivals",
+                                             "scheduling", "metrics", "scheduler_call", "memory_call"};
+
+struct Counter {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> totalNs{0};
+  std::atomic<uint64_t> minNs{UINT64_MAX};
+  std::atomic<uint64_t> maxNs{0};
+};
+
+bool initialEnabled() {
+  const char* value = std::getenv("WAOS_PROFILE");
+  return value && *value && std::string(value) != "0";
+}
+
+std::atomic<bool> g_enabled{initialEnabled()};
+std::array<Counter, PHASES> g_counters;
+
+// Writes the totals at exit, so a profiled run needs no extra code in the front-end
+struct ExitDump {
+  ~ExitDump() {
+    if (!PhaseProfiler::enabled()) return;
+    if (g_counters[static_cast<size_t>(ProfilePhase::STEP)].calls.load(std::memory_order_relaxed) == 0) return;
+    PhaseProfiler::dump(std::cerr);
+  }
+} g_exitDump;
+
+}  // namespace
+
+bool PhaseProfiler::enabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void PhaseProfiler::setEnabled(bool enabled) {
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void PhaseProfiler::record(ProfilePhase phase, uint64_t nanoseconds) {
+  if (phase >= ProfilePhase::COUNT) return;
+  Counter& counter = g_counters[static_cast<size_t>(phase)];
+  counter.calls.fetch_add(1, std::memory_order_relaxed);
+  counter.totalNs.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+  // Only the rare new extreme pays for a compare-exchange
+  uint64_t current = counter.minNs.load(std::memory_order_relaxed);
+  while (nanoseconds < current && !counter.minNs.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+  }
+  current = counter.maxNs.load(std::memory_order_relaxed);
+  while (nanoseconds > current && !counter.maxNs.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+  }
+}
+
+PhaseStats PhaseProfiler::stats(ProfilePhase phase) {
+  PhaseStats result;
+  if (phase >= ProfilePhase::COUNT) return result;
+  const Counter& counter = g_counters[static_cast<size_t>(phase)];
+  result.calls = counter.calls.load(std::memory_order_relaxed);
+  result.totalNs = counter.totalNs.load(std::memory_order_relaxed);
+  result.minNs = result.calls ? counter.minNs.load(std::memory_order_relaxed) : 0;
+  result.maxNs = counter.maxNs.load(std::memory_order_relaxed);
+  return result;
+}
+
+void PhaseProfiler::reset() {
+  for (Counter& counter : g_counters) {
+    counter.calls.store(0, std::memory_order_relaxed);
+    counter.totalNs.store(0, std::memory_order_relaxed);
+    counter.minNs.store(UINT64_MAX, std::memory_order_relaxed);
+    counter.maxNs.store(0, std::memory_order_relaxed);
+  }
+}
+
+const char* PhaseProfiler::phaseName(ProfilePhase phase) {
+  return (phase < ProfilePhase::COUNT) ? PHASE_NAMES[static_cast<size_t>(phase)] : "unknown";
+}
+
+void PhaseProfiler::dump(std::ostream& out) {
+  out << std::left << std::setw(16) << "phase" << std::right << std::setw(12) << "calls" << std::setw(14)
+      << "total_us" << std::setw(12) << "mean_ns" << std::setw(12) << "min_ns" << std::setw(12) << "max_ns" << '\n';
+  for (size_t i = 0; i < PHASES; ++i) {
+    PhaseStats s = stats(static_cast<ProfilePhase>(i));
+    if (s.calls == 0) continue;
+    out << std::left << std::setw(16) << PHASE_NAMES[i] << std::right << std::setw(12) << s.calls << std::setw(14)
+        << s.totalNs / 1000 << std::setw(12) << static_cast<uint64_t>(s.meanNs()) << std::setw(12) << s.minNs
+        << std::setw(12) << s.maxNs << '\n';
+  }
+}
+
+}  // namespace waos::core
@@ -0,0 +1,196 @@
+#include "waos/core/PolicyRegistry.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace waos::core {
+
+namespace {
+
+bool isSharedLibrary(const std::filesystem::path& path) {
+  std::string extension = path.extension().string();
+  return extension == ".so" || extension == ".dylib" || extension == ".dll";
+}
+
+}  // namespace
+
+int PolicyArguments::get(const std::string& name, int fallback) const {
+  auto it = values.find(name);
+  return (it != values.end()) ? it->second : fallback;
+}
+
+PolicyRegistry& PolicyRegistry::instance() {
+  static PolicyRegistry registry;
+  return registry;
+}
+
+template <typename Factory>
+const PolicyRegistry::Entry<Factory>* PolicyRegistry::find(const Table<Factory>& table, const std::string& name) {
+  auto it = std::find_if(table.begin(), table.end(),
+                         [&name](const Entry<Factory>& entry) { return entry.descriptor.name == name; });
+  return (it != table.end()) ? &*it : nullptr;
+}
+
+PolicyArguments PolicyRegistry::resolve(const PolicyDescriptor& descriptor, const PolicyArguments& args) {
+  PolicyArguments resolved = args;
+  for (const PolicyParameter& parameter : descriptor.parameters) {
+    int value = args.get(parameter.name, parameter.defaultValue);
+    if (value < parameter.minValue || value > parameter.maxValue) {
+      throw std::invalid_argument(descriptor.name + ": parameter '" + parameter.name + "' out of range [" +
+                                  std::to_string(parameter.minValue) + ", " + std::to_string(parameter.maxValue) +
+                                  "]");
+    }
+    resolved.values[parameter.name] = value;
+  }
+  return resolved;
+}
+
+void PolicyRegistry::registerScheduler(PolicyDescriptor descriptor, SchedulerFactory factory) {
+  if (descriptor.name.empty() || !factory) throw std::invalid_argument("Scheduler policy needs a name and a factory");
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = std::find_if(m_schedulers.begin(), m_schedulers.end(),
+                         [&](const auto& entry) { return entry.descriptor.name == descriptor.name; });
+  if (it != m_schedulers.end()) {
+    *it = {std::move(descriptor), std::move(factory)};
+  } else {
+    m_schedulers.push_back({std::move(descriptor), std::move(factory)});
+  }
+}
+
+void PolicyRegistry::registerMemoryManager(PolicyDescriptor descriptor, MemoryManagerFactory factory) {
+  if (descriptor.name.empty() || !factory) {
+    throw std::invalid_argument("Memory manager policy needs a name and a factory");
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = std::find_if(m_memoryManagers.begin(), m_memoryManagers.end(),
+                         [&](const auto& entry) { return entry.descriptor.name == descriptor.name; });
+  if (it != m_memoryManagers.end()) {
+    *it = {std::move(descriptor), std::move(factory)};
+  } else {
+    m_memoryManagers.push_back({std::move(descriptor), std::move(factory)});
+  }
+}
+
+std::unique_ptr<waos::scheduler::IScheduler> PolicyRegistry::createScheduler(const std::string& name,
+                                                                             const PolicyArguments& args) const {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  const auto* entry = find(m_schedulers, name);
+  if (!entry) throw std::invalid_argument("Unknown scheduler: " + name);
+  PolicyArguments resolved = resolve(entry->descriptor, args);
+  SchedulerFactory factory = entry->factory;
+  lock.unlock();  // The factory may be slow or query the registry
+
+  auto scheduler = factory(resolved);
+  if (!scheduler) throw std::invalid_argument("Scheduler factory returned null: " + name);
+  return scheduler;
+}
+
+std::unique_ptr<waos::memory::IMemoryManager> PolicyRegistry::createMemoryManager(const std::string& name,
+                                                                                  const PolicyArguments& args) const {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  const auto* entry = find(m_memoryManagers, name);
+  if (!entry) throw std::invalid_argument("Unknown memory manager: " + name);
+  PolicyArguments resolved = resolve(entry->descriptor, args);
+  MemoryManagerFactory factory = entry->factory;
+  lock.unlock();
+
+  auto manager = factory(resolved);
+  if (!manager) throw std::invalid_argument("Memory manager factory returned null: " + name);
+  return manager;
+}
+
+bool PolicyRegistry::hasScheduler(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return find(m_schedulers, name) != nullptr;
+}
+
+bool PolicyRegistry::hasMemoryManager(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return find(m_memoryManagers, name) != nullptr;
+}
+
+std::vector<PolicyDescriptor> PolicyRegistry::schedulers() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<PolicyDescriptor> result;
+  for (const auto& entry : m_schedulers) result.push_back(entry.descriptor);
+  return result;
+}
+
+std::vector<PolicyDescriptor> PolicyRegistry::memoryManagers() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<PolicyDescriptor> result;
+  for (const auto& entry : m_memoryManagers) result.push_back(entry.descriptor);
+  return result;
+}
+
+bool PolicyRegistry::loadPlugin(const std::string& path) {
+  void* symbol = nullptr;
+  void* handle = nullptr;
+  std::string error;
+
+#ifdef _WIN32
+  HMODULE module = LoadLibraryA(path.c_str());
+  handle = module;
+  if (!module) {
+    error = "Cannot load " + path;
+  } else if (!(symbol = reinterpret_cast<void*>(GetProcAddress(module, PLUGIN_ENTRY_SYMBOL)))) {
+    error = path + ": missing " + PLUGIN_ENTRY_SYMBOL;
+    FreeLibrary(module);
+  }
+#else
+  handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (!handle) {
+    const char* message = dlerror();
+    error = message ? message : "Cannot load " + path;
+  } else if (!(symbol = dlsym(handle, PLUGIN_ENTRY_SYMBOL))) {
+    error = path + ": missing " + PLUGIN_ENTRY_SYMBOL;
+    dlclose(handle);
+  }
+#endif
+
+  if (!error.empty()) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lastPluginError = error;
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pluginHandles.push_back(handle);
+  }
+
+  // Outside the lock: the entry point registers its policies through this registry
+  reinterpret_cast<PluginEntryPoint>(symbol)(*this);
+  return true;
+}
+
+int PolicyRegistry::loadPluginDirectory(const std::string& directory) {
+  std::error_code ec;
+  if (!std::filesystem::is_directory(directory, ec)) return 0;
+
+  std::vector<std::filesystem::path> libraries;
+  for (const auto& file : std::filesystem::directory_iterator(directory, ec)) {
+    if (file.is_regular_file(ec) && isSharedLibrary(file.path())) libraries.push_back(file.path());
+  }
+  std::sort(libraries.begin(), libraries.end());  // Deterministic override order
+
+  int loaded = 0;
+  for (const auto& library : libraries) {
+    if (loadPlugin(library.string())) loaded++;
+  }
+  return loaded;
+}
+
+std::string PolicyRegistry::lastPluginError() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_lastPluginError;
+}
+
+}  // namespace waos::core
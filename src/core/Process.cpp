@@ -1,25 +1,28 @@
 #include "waos/core/Process.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <stdexcept>
 
 namespace waos::core {
 
-Process::Process(int pid, uint64_t arrivalTime, int priority, std::queue<Burst> bursts, int requiredPages)
+Process::Process(int pid, uint64_t arrivalTime, int priority, std::queue<Burst> bursts,
+                 waos::common::PageNumber requiredPages)
     : m_pid(pid),
       m_arrivalTime(arrivalTime),
       m_priority(priority),
       m_bursts(std::move(bursts)),
       m_requiredPages(requiredPages),
       m_quantumUsed(0),
+      m_cpuTicksInBurst(0),
       m_state(ProcessState::NEW),
       m_instructionPointer(0),
       m_running(false),
       m_tickCompleted(false),
       m_stopThread(false) {
   if (m_pid < 0) throw std::invalid_argument("Process ID cannot be negative.");
-  if (m_requiredPages < 0) throw std::invalid_argument("Required pages cannot be negative.");
 
   generateReferenceString();
 }
@@ -121,7 +124,7 @@ bool Process::executeOneTick() {
 int Process::getPid() const { return m_pid; }
 uint64_t Process::getArrivalTime() const { return m_arrivalTime; }
 int Process::getPriority() const { return m_priority; }
-int Process::getRequiredPages() const { return m_requiredPages; }
+waos::common::PageNumber Process::getRequiredPages() const { return m_requiredPages; }
 
 ProcessStats Process::getStats() const {
   std::lock_guard<std::mutex> lock(m_processMutex);
@@ -147,9 +150,10 @@ void Process::setState(ProcessState newState, uint64_t currentTime) {
   if (newState == ProcessState::READY) {
     // Entering READY state, record the time
     m_stats.lastReadyTime = currentTime;
-  } else if (newState == ProcessState::RUNNING && m_stats.startTime == 0) {
-    // First time running
+  } else if (newState == ProcessState::RUNNING && !m_stats.hasStarted) {
+    // First time running (a flag, since tick 0 is a valid start time)
     m_stats.startTime = currentTime;
+    m_stats.hasStarted = true;
   } else if (newState == ProcessState::TERMINATED) {
     m_stats.finishTime = currentTime;
   }
@@ -170,6 +174,12 @@ int Process::getCurrentBurstDuration() const {
 void Process::advanceToNextBurst() {
   std::lock_guard<std::mutex> lock(m_processMutex);
   if (!m_bursts.empty()) m_bursts.pop();
+  m_cpuTicksInBurst = 0;
+}
+
+int Process::getCpuTicksInBurst() const {
+  std::lock_guard<std::mutex> lock(m_processMutex);
+  return m_cpuTicksInBurst;
 }
 
 bool Process::hasMoreBursts() const {
@@ -191,12 +201,18 @@ void Process::generateReferenceString() {
   // Generate references using the Locality Principle
   // Deterministic seed based on PID for reproducibility
   std::mt19937 gen(m_pid);
-  std::uniform_int_distribution<> distPage(0, m_requiredPages - 1);
+  std::uniform_int_distribution<waos::common::PageNumber> distPage(0, m_requiredPages > 0 ? m_requiredPages - 1 : 0);
   std::uniform_real_distribution<> distProb(0.0, 1.0);
 
-  int currentPage = 0;
+  waos::common::PageNumber currentPage = 0;
+
+  // Separate stream for read/write so the page sequence is unchanged
+  std::mt19937 genWrite(m_pid + 0x9e3779b9u);
 
   for (int i = 0; i < totalCpuTicks; ++i) {
+    // Una fracción WRITE_RATIO de los accesos son escrituras (relevante para copy-on-write)
+    m_writeReferenceString.push_back(distProb(genWrite) < WRITE_RATIO);
+
     double p = distProb(gen);
 
     if (p < 0.7) {
@@ -210,7 +226,7 @@ void Process::generateReferenceString() {
   }
 }
 
-int Process::getCurrentPageRequirement() const {
+waos::common::PageNumber Process::getCurrentPageRequirement() const {
   // No lock needed if m_instructionPointer is only touched by owned thread or during init
   // But for safety in getters:
   std::lock_guard<std::mutex> lock(m_processMutex);
@@ -220,6 +236,65 @@ int Process::getCurrentPageRequirement() const {
   return 0;  // Safe fallback
 }
 
+bool Process::isCurrentAccessWrite() const {
+  std::lock_guard<std::mutex> lock(m_processMutex);
+  if (m_instructionPointer < m_writeReferenceString.size()) {
+    return m_writeReferenceString[m_instructionPointer];
+  }
+  return false;
+}
+
+void Process::setSharedMappings(std::vector<SharedMapping> mappings) {
+  m_sharedMappings = std::move(mappings);
+}
+
+const std::vector<SharedMapping>& Process::getSharedMappings() const {
+  return m_sharedMappings;
+}
+
+void Process::setTickets(int tickets) {
+  if (tickets < 0) throw std::invalid_argument("Ticket count cannot be negative.");
+  m_tickets = tickets;
+}
+
+int Process::getTickets() const {
+  if (m_tickets > 0) return m_tickets;
+  return std::max(1, 100 / (std::max(0, m_priority) + 1));
+}
+
+void Process::setDeadline(uint64_t relativeDeadline) {
+  m_relativeDeadline = relativeDeadline;
+}
+
+uint64_t Process::getRelativeDeadline() const {
+  return m_relativeDeadline;
+}
+
+bool Process::hasDeadline() const {
+  return m_relativeDeadline > 0;
+}
+
+uint64_t Process::getAbsoluteDeadline() const {
+  if (m_relativeDeadline == 0) return std::numeric_limits<uint64_t>::max();
+  return m_arrivalTime + m_relativeDeadline;
+}
+
+void Process::setPeriod(uint64_t period) {
+  m_period = period;
+}
+
+uint64_t Process::getPeriod() const {
+  return m_period;
+}
+
+void Process::setTaskId(int taskId) {
+  m_taskId = taskId;
+}
+
+int Process::getTaskId() const {
+  return (m_taskId >= 0) ? m_taskId : m_pid;
+}
+
 void Process::advanceInstructionPointer() {
   // Called internally by executeOneTick (already locked)
   if (m_instructionPointer < m_pageReferenceString.size()) {
@@ -227,7 +302,7 @@ void Process::advanceInstructionPointer() {
   }
 }
 
-const std::vector<int>& Process::getPageReferenceString() const {
+const std::vector<waos::common::PageNumber>& Process::getPageReferenceString() const {
   return m_pageReferenceString;
 }
 
@@ -250,6 +325,7 @@ void Process::incrementQuantum(int ticks) {
 void Process::addCpuTime(uint64_t time) {
   std::lock_guard<std::mutex> lock(m_processMutex);
   m_stats.totalCpuTime += time;
+  m_cpuTicksInBurst += static_cast<int>(time);
 }
 
 void Process::addIoTime(uint64_t time) {
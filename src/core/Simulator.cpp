@@ -5,9 +5,12 @@
 
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 #include "waos/common/DataStructures.h"
 #include "waos/core/Parser.h"
+#include "waos/core/PhaseProfiler.h"
 
 namespace waos::core {
 
@@ -21,6 +24,7 @@ Simulator::Simulator(QObject* parent)
       m_totalContextSwitches(0),
       m_isRunning(false),
       m_pageFaultPenalty(5),
+      m_copyOnWritePenalty(1),
       m_contextSwitchDuration(1),
       m_needsContextSwitchOverhead(false) {
 }
@@ -33,10 +37,12 @@ Simulator::~Simulator() {
 bool Simulator::loadProcesses(const std::string& filePath) {
   try {
     auto processInfos = Parser::parseFile(filePath);
+    for (const auto& info : processInfos) checkAddressSpace(info.pid, info.requiredPages);
 
     // Clear existing data
     m_processes.clear();
     m_incomingProcesses.clear();
+    m_periodicTasks.clear();
     m_blockedQueue.clear();
     m_memoryWaitQueue.clear();
     m_runningProcess = nullptr;
@@ -47,24 +53,24 @@ bool Simulator::loadProcesses(const std::string& filePath) {
     m_cpuActiveTicks = 0;
     m_totalPageFaults = 0;
     m_totalContextSwitches = 0;
+    if (m_timeSeries) m_timeSeries->clear();
+    clearCompletionTotals();
 
     // Reset Clock
     m_clock.reset();
 
+    // Later jobs of periodic tasks get fresh PIDs above every loaded one
+    m_nextJobPid = 0;
+    for (const auto& info : processInfos) m_nextJobPid = std::max(m_nextJobPid, info.pid + 1);
+
     // Convert ProcessInfo (DTO) to Process (Entity)
     for (const auto& info : processInfos) {
-      auto process = std::make_unique<Process>(
-          info.pid,
-          info.arrivalTime,
-          info.priority,
-          info.bursts,
-          info.requiredPages);
+      Process* process = createProcess(info, info.pid, info.arrivalTime);
 
       // Store raw pointer in incoming list for arrival checks
-      m_incomingProcesses.push_back(process.get());
+      m_incomingProcesses.push_back(process);
 
-      // Move ownership to the main vector
-      m_processes.push_back(std::move(process));
+      if (info.period > 0 && info.jobs > 1) m_periodicTasks[info.pid] = {info, info.jobs - 1};
     }
 
     // Sort incoming processes by arrival time for efficiency
@@ -85,7 +91,14 @@ bool Simulator::loadProcesses(const std::string& filePath) {
   }
 }
 
+void Simulator::checkAddressSpace(int pid, waos::common::PageNumber requiredPages) const {
+  if (!m_memoryManager || requiredPages <= m_memoryManager->getMaxPages()) return;
+  throw std::invalid_argument("P" + std::to_string(pid) + " needs " + std::to_string(requiredPages) +
+                              " pages; the address space holds " + std::to_string(m_memoryManager->getMaxPages()));
+}
+
 void Simulator::setScheduler(std::unique_ptr<waos::scheduler::IScheduler> scheduler) {
+  if (m_scheduler) m_readyVersionOffset += m_scheduler->getReadyQueueVersion();
   m_scheduler = std::move(scheduler);
 }
 
@@ -93,6 +106,39 @@ void Simulator::setMemoryManager(std::unique_ptr<waos::memory::IMemoryManager> m
   m_memoryManager = std::move(memoryManager);
 }
 
+void Simulator::setTimeSeriesRecorder(std::unique_ptr<TimeSeriesRecorder> recorder) {
+  m_timeSeries = std::move(recorder);
+}
+
+const TimeSeriesRecorder* Simulator::getTimeSeriesRecorder() const {
+  return m_timeSeries.get();
+}
+
+void Simulator::setTraceWriter(std::unique_ptr<ChromeTraceWriter> writer) {
+  m_traceWriter = std::move(writer);
+  if (!m_traceWriter) return;
+
+  // Processes that already arrived; from now on changeState() reports every transition
+  for (const auto& p : m_processes) {
+    ProcessState state = p->getState();
+    if (state != ProcessState::NEW && state != ProcessState::TERMINATED) {
+      m_traceWriter->processState(p->getPid(), state, m_clock.getTime());
+    }
+  }
+}
+
+const ChromeTraceWriter* Simulator::getTraceWriter() const {
+  return m_traceWriter.get();
+}
+
+void Simulator::setEventLog(std::unique_ptr<EventLogWriter> log) {
+  m_eventLog = std::move(log);
+}
+
+const EventLogWriter* Simulator::getEventLog() const {
+  return m_eventLog.get();
+}
+
 void Simulator::start() {
   if (!m_scheduler || !m_memoryManager) {
     log("Error: Planificador o Gestor de Memoria no inicializado.", LogCategory::SYS);
@@ -104,12 +150,22 @@ void Simulator::start() {
     return;
   }
 
+  // The memory manager may have been replaced after loading: allocateForProcess() must not throw mid-run
+  try {
+    for (const auto& p : m_processes) checkAddressSpace(p->getPid(), p->getRequiredPages());
+  } catch (const std::invalid_argument& e) {
+    log(QString("Error: %1").arg(e.what()), LogCategory::SYS);
+    return;
+  }
+
   m_isRunning = true;
   log("Simulación iniciada.", LogCategory::SYS);
 }
 
 void Simulator::stop() {
   m_isRunning = false;
+  if (m_timeSeries) m_timeSeries->flush();  // Keep the partial window of a paused run
+  if (m_eventLog) m_eventLog->flush();
   log("Simulación detenida.", LogCategory::SYS);
 }
 
@@ -133,6 +189,10 @@ void Simulator::reset() {
   m_totalPageFaults = 0;
   m_totalContextSwitches = 0;
   m_metrics = waos::common::SimulatorMetrics();
+  clearCompletionTotals();
+  if (m_timeSeries) m_timeSeries->clear();
+  if (m_traceWriter) m_traceWriter->finish(m_clock.getTime());
+  if (m_eventLog) m_eventLog->close();
   m_needsContextSwitchOverhead = false;
 
   // Reset Memory Manager
@@ -146,6 +206,7 @@ void Simulator::reset() {
   // Clear main container (Destructors will run, but threads are already joined)
   m_processes.clear();
   m_incomingProcesses.clear();
+  m_periodicTasks.clear();
 
   log("Simulación reiniciada.", LogCategory::SYS);
 }
@@ -159,9 +220,17 @@ void Simulator::step() {
   // std::lock_guard<std::recursive_mutex> lock(m_simulationMutex);
   // std::cout << "[DEBUG] Simulator::step start" << std::endl;
 
+  WAOS_PROFILE_SCOPE(STEP);
   uint64_t now = m_clock.getTime();
   emit clockTicked(now);
 
+  // Counters before the tick, to attribute its activity in the time series and trace
+  const bool switching = m_contextSwitchCounter > 0;
+  const int runningBefore = m_runningProcess ? m_runningProcess->getPid() : -1;
+  const uint64_t activeBefore = m_cpuActiveTicks;
+  const int faultsBefore = m_totalPageFaults;
+  const int switchesBefore = m_totalContextSwitches;
+
   // IO Devices (Parallel to CPU)
   handleIO();
 
@@ -172,13 +241,12 @@ void Simulator::step() {
   if (m_contextSwitchCounter > 0) {
     // Context Switch Overhead, CPU is busy doing kernel work
     m_contextSwitchCounter--;
+    if (m_contextSwitchCounter == 0) logSwitch(TransitionCause::SWITCH_END, m_nextProcess);
     if (m_contextSwitchCounter == 0 && m_nextProcess) {
       m_runningProcess = m_nextProcess;
       m_nextProcess = nullptr;
 
-      m_runningProcess->setState(ProcessState::RUNNING, m_clock.getTime());
-
-      emit processStateChanged(m_runningProcess->getPid(), ProcessState::RUNNING);
+      changeState(m_runningProcess, ProcessState::RUNNING, TransitionCause::DISPATCH);
       log(QString("Cambio de contexto completado. Ejecutando P%1").arg(m_runningProcess->getPid()), LogCategory::SCHED);
     }
   } else {
@@ -193,12 +261,56 @@ void Simulator::step() {
   if (m_runningProcess == nullptr && m_contextSwitchCounter == 0) handleScheduling();
 
   updateMetrics();
+  if (m_timeSeries || m_traceWriter) {
+    TickSample sample = sampleTick(now, switching, activeBefore, faultsBefore, switchesBefore);
+    if (m_timeSeries) m_timeSeries->record(sample);
+    if (m_traceWriter) writeTraceEvents(sample, runningBefore);
+  }
   m_clock.tick();
   // std::cout << "[DEBUG] Simulator::step end" << std::endl;
 }
 
+Process* Simulator::createProcess(const ProcessInfo& info, int pid, uint64_t arrivalTime) {
+  auto process = std::make_unique<Process>(pid, arrivalTime, info.priority, info.bursts, info.requiredPages);
+  process->setSharedMappings(info.sharedMappings);
+  process->setTickets(info.tickets);
+  process->setDeadline(info.deadline);
+  process->setPeriod(info.period);
+  process->setTaskId(info.pid);
+
+  // Move ownership to the main vector
+  Process* raw = process.get();
+  m_processes.push_back(std::move(process));
+  return raw;
+}
+
+void Simulator::releaseNextJob(const Process* job) {
+  auto task = m_periodicTasks.find(job->getTaskId());
+  if (task == m_periodicTasks.end() || task->second.remainingJobs <= 0) return;
+
+  uint64_t release = job->getArrivalTime() + task->second.info.period;
+  Process* next = createProcess(task->second.info, m_nextJobPid++, release);
+  task->second.remainingJobs--;
+
+  // Keep m_incomingProcesses ordered by arrival time
+  auto pos = std::upper_bound(m_incomingProcesses.begin(), m_incomingProcesses.end(), next,
+                              [](const Process* a, const Process* b) {
+                                return a->getArrivalTime() < b->getArrivalTime();
+                              });
+  m_incomingProcesses.insert(pos, next);
+
+  log(QString("Tarea periódica T%1: trabajo P%2 se liberará en t=%3 (deadline t=%4).")
+          .arg(job->getTaskId())
+          .arg(next->getPid())
+          .arg(release)
+          .arg(next->getAbsoluteDeadline()),
+      LogCategory::PROC);
+}
+
 void Simulator::handleArrivals() {
+  WAOS_PROFILE_SCOPE(ARRIVALS);
   uint64_t now = m_clock.getTime();
+  std::vector<Process*> arrived;
   auto it = m_incomingProcesses.begin();
 
   while (it != m_incomingProcesses.end()) {
@@ -208,36 +320,33 @@ void Simulator::handleArrivals() {
       p->startThread();
 
       // Reserve structures
-      m_memoryManager->allocateForProcess(p->getPid(), p->getRequiredPages());
-      m_memoryManager->registerFutureReferences(p->getPid(), p->getPageReferenceString());
+      WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->allocateForProcess(p->getPid(), p->getRequiredPages()));
+      WAOS_PROFILE_CALL(MEMORY_CALL,
+                        m_memoryManager->registerFutureReferences(p->getPid(), p->getPageReferenceString()));
+      for (const auto& mapping : p->getSharedMappings()) {
+        WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->mapSharedRegion(p->getPid(), mapping.regionId, mapping.firstPage,
+                                                                        mapping.pageCount, mapping.copyOnWrite));
+      }
 
       // Move to READY (Scheduler se encarga de la cola)
-      p->setState(ProcessState::READY, now);
-      emit processStateChanged(p->getPid(), ProcessState::READY);
-      m_scheduler->addProcess(p);
-
-      // Preemption check
-      Process* current = (m_runningProcess) ? m_runningProcess : m_nextProcess;
-      if (current && p->getPriority() < current->getPriority()) {
-        // New process has higher priority (lower value)
-        log(QString("Apropiación: P%1 (Prio %2) desplaza a P%3 (Prio %4)")
-                .arg(p->getPid())
-                .arg(p->getPriority())
-                .arg(current->getPid())
-                .arg(current->getPriority()),
-            LogCategory::SCHED);
-
-        triggerContextSwitch(current, nullptr);  // Put current back to ready
-        // The scheduler will pick the new high-priority process in handleScheduling
-      }
+      changeState(p, ProcessState::READY, TransitionCause::ARRIVAL);
+      WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->addProcess(p));
+      recordRelease(p);
+
+      // Preemption on arrival, decided by the scheduler's own ordering
+      checkPreemption(p);
 
       it = m_incomingProcesses.erase(it);
+      arrived.push_back(p);
       log(QString("Proceso P%1 llegó.").arg(p->getPid()), LogCategory::PROC);
     } else {
       // Como están ordenados, si este no llegó, los siguientes tampoco.
       break;
     }
   }
+
+  // Periodic release: each arriving job schedules the next one (after the loop, it reorders the list)
+  for (Process* p : arrived) releaseNextJob(p);
 }
 
 bool Simulator::processIoStep(Process* p) {
@@ -251,6 +360,7 @@ bool Simulator::processIoStep(Process* p) {
 }
 
 void Simulator::handleIO() {
+  WAOS_PROFILE_SCOPE(IO);
   // IO handling remains simulated in kernel space for simplicity
   // and determinism, even with threaded processes. The thread is sleeping.
   auto it = m_blockedQueue.begin();
@@ -268,12 +378,11 @@ void Simulator::handleIO() {
       p->resetQuantum();
 
       // Back to READY
-      p->setState(ProcessState::READY, m_clock.getTime());
-      emit processStateChanged(p->getPid(), ProcessState::READY);
-      m_scheduler->addProcess(p);
+      changeState(p, ProcessState::READY, TransitionCause::IO_COMPLETE);
+      WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->addProcess(p));
 
-      // Preemption on IO Completion could also happen here for Priority Scheduling
-      // We omit it for simplicity, but it follows the same logic as Arrivals.
+      // Preemption on IO Completion (e.g. SRTF with a shorter remaining burst)
+      checkPreemption(p);
 
       it = m_blockedQueue.erase(it);
       log(QString("Proceso P%1 terminó E/S.").arg(p->getPid()), LogCategory::NOTIFY);
@@ -282,6 +391,7 @@ void Simulator::handleIO() {
 }
 
 void Simulator::handlePageFaults() {
+  WAOS_PROFILE_SCOPE(PAGE_FAULTS);
   // Kernel simulates disk latency.
   auto it = m_memoryWaitQueue.begin();
   if (it != m_memoryWaitQueue.end()) {
@@ -293,29 +403,64 @@ void Simulator::handlePageFaults() {
 
     if (info.ticksRemaining <= 0) {
       // Notify to MemoryManager que la carga física is finished.
-      m_memoryManager->completePageLoad(info.process->getPid(), info.pageNumber);
+      WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->completePageLoad(info.process->getPid(), info.pageNumber));
 
       // Reset Quantum on Fault Resolution
       info.process->resetQuantum();
 
-      info.process->setState(ProcessState::READY, m_clock.getTime());
-      emit processStateChanged(info.process->getPid(), ProcessState::READY);
-      m_scheduler->addProcess(info.process);
+      // Only the event log records the frame; skip the lookup otherwise
+      int frame = -1;
+      if (m_eventLog) {
+        frame = WAOS_PROFILE_CALL(MEMORY_CALL,
+                                  m_memoryManager->getFrameForPage(info.process->getPid(), info.pageNumber));
+      }
+      changeState(info.process, ProcessState::READY, TransitionCause::PAGE_LOADED, info.pageNumber, frame);
+      WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->addProcess(info.process));
 
       log(QString("Proceso P%1 resolvió Fallo de Página.").arg(info.process->getPid()), LogCategory::MEM);
+      Process* resolved = info.process;
       it = m_memoryWaitQueue.erase(it);
+      checkPreemption(resolved);
     }
   }
 }
 
+void Simulator::checkPreemption(Process* readied) {
+  Process* current = (m_runningProcess) ? m_runningProcess : m_nextProcess;
+  if (!current || current == readied) return;
+  if (!WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->shouldPreempt(current, readied))) return;
+
+  log(QString("Apropiación: P%1 pasa a listo y desplaza a P%2")
+          .arg(readied->getPid())
+          .arg(current->getPid()),
+      LogCategory::SCHED);
+
+  current->incrementPreemptions();
+  triggerContextSwitch(current, nullptr, TransitionCause::PREEMPTION);  // The scheduler picks the better candidate in handleScheduling
+}
+
+int Simulator::faultPenalty(waos::memory::PageRequestResult result) const {
+  // Copy-on-write splits and compressed reloads stay in RAM: no disk transfer involved
+  int penalty = m_pageFaultPenalty;
+  if (result == waos::memory::PageRequestResult::COPY_ON_WRITE) {
+    penalty = m_copyOnWritePenalty;
+  } else if (result == waos::memory::PageRequestResult::COMPRESSED_RELOAD) {
+    penalty = WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->getCompressedReloadPenalty());
+  }
+  return penalty + WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->getLastWalkCost());
+}
+
 void Simulator::handleCpuExecution() {
+  WAOS_PROFILE_SCOPE(CPU_EXECUTION);
   if (!m_runningProcess) return;
 
   // MMU Check (Hardware Instruction Fetch simulation)
-  int pageRequired = m_runningProcess->getCurrentPageRequirement();
+  waos::common::PageNumber pageRequired = m_runningProcess->getCurrentPageRequirement();
 
   // Request page - this counts hits AND faults
-  waos::memory::PageRequestResult result = m_memoryManager->requestPage(m_runningProcess->getPid(), pageRequired);
+  waos::memory::PageRequestResult result =
+      WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->requestPage(m_runningProcess->getPid(), pageRequired,
+                                                                  m_runningProcess->isCurrentAccessWrite()));
 
   if (result != waos::memory::PageRequestResult::HIT) {
     // Page Fault Exception (either PAGE_FAULT or REPLACEMENT)
@@ -327,10 +472,9 @@ void Simulator::handleCpuExecution() {
     m_runningProcess->incrementPageFaults();
     m_totalPageFaults++;
 
-    m_runningProcess->setState(ProcessState::WAITING_MEMORY, m_clock.getTime());
-    emit processStateChanged(m_runningProcess->getPid(), ProcessState::WAITING_MEMORY);
+    changeState(m_runningProcess, ProcessState::WAITING_MEMORY, TransitionCause::PAGE_FAULT, pageRequired);
 
-    m_memoryWaitQueue.push_back({m_runningProcess, m_pageFaultPenalty, pageRequired});
+    m_memoryWaitQueue.push_back({m_runningProcess, faultPenalty(result), pageRequired});
     m_runningProcess = nullptr;           // Immediate yield on fault
     m_needsContextSwitchOverhead = true;  // Save context required
     return;                               // Tick used for the faulting instruction attempt
@@ -351,63 +495,70 @@ void Simulator::handleCpuExecution() {
   m_runningProcess->incrementQuantum(1);
 
   // Advance instruction pointer in memory manager (for optimal algorithm)
-  m_memoryManager->advanceInstructionPointer(m_runningProcess->getPid());
+  WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->advanceInstructionPointer(m_runningProcess->getPid()));
 
   // Check Burst Completion (Thread updated the queue)
   // We check the result of the thread's work.
   int remaining = m_runningProcess->getCurrentBurstDuration();
 
   if (remaining == 0) {
+    // Let burst-predicting schedulers learn the observed length t(n)
+    WAOS_PROFILE_CALL(SCHEDULER_CALL,
+                      m_scheduler->onBurstCompleted(m_runningProcess, m_runningProcess->getCpuTicksInBurst()));
     m_runningProcess->advanceToNextBurst();
 
     if (!m_runningProcess->hasMoreBursts()) {
-      m_runningProcess->setState(ProcessState::TERMINATED, m_clock.getTime());
-      emit processStateChanged(m_runningProcess->getPid(), ProcessState::TERMINATED);
+      changeState(m_runningProcess, ProcessState::TERMINATED, TransitionCause::EXIT);
+      recordCompletion(m_runningProcess);
       log(QString("Proceso P%1 Terminado.").arg(m_runningProcess->getPid()), LogCategory::PROC);
 
       // Thread cleanup
       m_runningProcess->stopThread();
-      m_memoryManager->freeForProcess(m_runningProcess->getPid());
+      WAOS_PROFILE_CALL(MEMORY_CALL, m_memoryManager->freeForProcess(m_runningProcess->getPid()));
+      WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->onProcessTerminated(m_runningProcess->getPid()));
 
       m_runningProcess = nullptr;
       m_needsContextSwitchOverhead = false;  // No context to save
     } else {
       if (m_runningProcess->getCurrentBurstType() == BurstType::IO) {
-        m_runningProcess->setState(ProcessState::BLOCKED, m_clock.getTime());
-        emit processStateChanged(m_runningProcess->getPid(), ProcessState::BLOCKED);
+        changeState(m_runningProcess, ProcessState::BLOCKED, TransitionCause::IO_REQUEST);
         m_blockedQueue.push_back(m_runningProcess);
         m_runningProcess = nullptr;
         m_needsContextSwitchOverhead = false;  // Save context required
       } else {
         // Sigue siendo CPU (caso raro de CPU consecutiva o retorno de interrupción)
         // For now, treat as yield to re-evaluate priorities/quantum
-        triggerContextSwitch(m_runningProcess, nullptr);
+        triggerContextSwitch(m_runningProcess, nullptr, TransitionCause::YIELD);
       }
     }
   } else {
     // Burst not finished, check Quantum (Preemption)
-    int timeSlice = m_scheduler->getTimeSlice();
+    int timeSlice = WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->getTimeSliceFor(m_runningProcess));
 
     // Only apply quantum if scheduler uses time-slicing (timeSlice > 0)
     if (timeSlice > 0 && m_runningProcess->getQuantumUsed() >= timeSlice) {
       log(QString("Quantum expirado para P%1").arg(m_runningProcess->getPid()), LogCategory::SCHED);
       m_runningProcess->incrementPreemptions();
-      triggerContextSwitch(m_runningProcess, nullptr);
+      WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->onQuantumExpired(m_runningProcess));
+      triggerContextSwitch(m_runningProcess, nullptr, TransitionCause::QUANTUM_EXPIRED);
     }
   }
 }
 
 void Simulator::handleScheduling() {
-  if (!m_scheduler->hasReadyProcesses()) return;
-  Process* candidate = m_scheduler->getNextProcess();
+  WAOS_PROFILE_SCOPE(SCHEDULING);
+  if (!WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->hasReadyProcesses())) return;
+  Process* candidate = WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->getNextProcess());
 
   if (!candidate) {
     log("Advertencia: El planificador devolvió nulo a pesar de reportar procesos listos.", LogCategory::SYS);
     return;
   }
 
-  int pageRequired = candidate->getCurrentPageRequirement();
-  waos::memory::PageRequestResult result = m_memoryManager->requestPage(candidate->getPid(), pageRequired);
+  waos::common::PageNumber pageRequired = candidate->getCurrentPageRequirement();
+  waos::memory::PageRequestResult result =
+      WAOS_PROFILE_CALL(MEMORY_CALL,
+                        m_memoryManager->requestPage(candidate->getPid(), pageRequired, candidate->isCurrentAccessWrite()));
 
   if (result != waos::memory::PageRequestResult::HIT) {
     log(QString("Fallo de Página al intentar iniciar P%1 (Página %2). Iniciando CS.")
@@ -419,14 +570,14 @@ void Simulator::handleScheduling() {
     m_totalPageFaults++;
 
     // El proceso pasa a esperar memoria
-    candidate->setState(ProcessState::WAITING_MEMORY, m_clock.getTime());
-    emit processStateChanged(candidate->getPid(), ProcessState::WAITING_MEMORY);
-    m_memoryWaitQueue.push_back({candidate, m_pageFaultPenalty, pageRequired});
+    changeState(candidate, ProcessState::WAITING_MEMORY, TransitionCause::PAGE_FAULT, pageRequired);
+    m_memoryWaitQueue.push_back({candidate, faultPenalty(result), pageRequired});
 
     // Regla: Se produce un cambio de contexto en ese mismo instante.
     // No hay runningProcess. Activamos el contador de CS para simular la gestión del fallo.
     m_contextSwitchCounter = m_contextSwitchDuration; 
     m_totalContextSwitches++; // Contamos el CS asociado al fallo
+    if (m_contextSwitchCounter > 0) logSwitch(TransitionCause::SWITCH_BEGIN, nullptr);
     
     // No asignamos m_runningProcess, por lo que el siguiente tick consumirá CS
     return;
@@ -437,6 +588,7 @@ void Simulator::handleScheduling() {
     m_nextProcess = candidate;
     m_contextSwitchCounter = m_contextSwitchDuration;
     m_totalContextSwitches++;
+    logSwitch(TransitionCause::SWITCH_BEGIN, candidate);
     log(QString("Planificador seleccionó P%1. Iniciando cambio de contexto (%2 ticks).")
             .arg(candidate->getPid())
             .arg(m_contextSwitchDuration),
@@ -444,9 +596,8 @@ void Simulator::handleScheduling() {
   } else {
     // Immediate switch (First process, or previous terminated)
     m_runningProcess = candidate;
-    m_runningProcess->setState(ProcessState::RUNNING, m_clock.getTime());
+    changeState(m_runningProcess, ProcessState::RUNNING, TransitionCause::DISPATCH);
     m_totalContextSwitches++;
-    emit processStateChanged(m_runningProcess->getPid(), ProcessState::RUNNING);
     log(QString("Planificador seleccionó P%1. Iniciando inmediatamente.").arg(candidate->getPid()), LogCategory::SCHED);
   }
 
@@ -454,16 +605,15 @@ void Simulator::handleScheduling() {
   m_needsContextSwitchOverhead = false;
 }
 
-void Simulator::triggerContextSwitch(Process* current, Process* next) {
+void Simulator::triggerContextSwitch(Process* current, Process* next, TransitionCause cause) {
   bool isPreemption = (current != nullptr && current->getState() != ProcessState::TERMINATED);
 
   if (current) {
     // Reset Quantum on Preemption/Yield (Returning to Ready)
     current->resetQuantum();
 
-    current->setState(ProcessState::READY, m_clock.getTime());
-    emit processStateChanged(current->getPid(), ProcessState::READY);
-    m_scheduler->addProcess(current);
+    changeState(current, ProcessState::READY, cause);
+    WAOS_PROFILE_CALL(SCHEDULER_CALL, m_scheduler->addProcess(current));
   }
   m_runningProcess = nullptr;
 
@@ -472,6 +622,7 @@ void Simulator::triggerContextSwitch(Process* current, Process* next) {
   if (isPreemption) {
     m_nextProcess = next;
     m_contextSwitchCounter = m_contextSwitchDuration;
+    if (m_contextSwitchCounter > 0) logSwitch(TransitionCause::SWITCH_BEGIN, next);
     // m_totalContextSwitches++; // Moved to handleScheduling/dispatch
 
     // We are paying the price now, so no need for handleScheduling to pay it again
@@ -480,9 +631,8 @@ void Simulator::triggerContextSwitch(Process* current, Process* next) {
     // Immediate switch for non-preemptive cases
     if (next) {
       m_runningProcess = next;
-      m_runningProcess->setState(ProcessState::RUNNING, m_clock.getTime());
+      changeState(m_runningProcess, ProcessState::RUNNING, TransitionCause::DISPATCH);
       m_totalContextSwitches++;
-      emit processStateChanged(m_runningProcess->getPid(), ProcessState::RUNNING);
     }
     // If next is null, handleScheduling will pick one immediately in step()
     m_contextSwitchCounter = 0;
@@ -490,6 +640,23 @@ void Simulator::triggerContextSwitch(Process* current, Process* next) {
   }
 }
 
+void Simulator::changeState(Process* p, ProcessState state, TransitionCause cause, waos::common::PageNumber page,
+                            int frame) {
+  ProcessState old = p->getState();
+  p->setState(state, m_clock.getTime());
+  emit processStateChanged(p->getPid(), state);
+  if (m_traceWriter) m_traceWriter->processState(p->getPid(), state, m_clock.getTime());
+  if (!m_eventLog) return;
+
+  m_eventLog->append({m_clock.getTime(), p->getPid(), old, state, cause, page, frame});
+}
+
+void Simulator::logSwitch(TransitionCause cause, const Process* next) {
+  if (!m_eventLog) return;
+  ProcessState state = next ? next->getState() : ProcessState::NEW;
+  m_eventLog->append({m_clock.getTime(), next ? next->getPid() : -1, state, state, cause, waos::common::NO_PAGE, -1});
+}
+
 uint64_t Simulator::getCurrentTime() const { return m_clock.getTime(); }
 
 const uint64_t* Simulator::getClockRef() const { return m_clock.getTimeAddress(); }
@@ -499,6 +666,7 @@ bool Simulator::isRunning() const { return m_isRunning; }
 bool Simulator::isContextSwitching() const { return m_contextSwitchCounter > 0; }
 
 void Simulator::updateMetrics() {
+  WAOS_PROFILE_SCOPE(METRICS);
   m_metrics.currentTick = m_clock.getTime();
   m_metrics.totalProcesses = m_processes.size();
 
@@ -512,27 +680,18 @@ void Simulator::updateMetrics() {
     m_metrics.cpuUtilization = 0.0;
   }
 
-  // Process-specific stats still require iteration, but simpler logic
-  m_metrics.completedProcesses = 0;
-  double totalWait = 0;
-  double totalTurnaround = 0;
-
-  for (const auto& p : m_processes) {
-    if (p->getState() == ProcessState::TERMINATED) {
-      auto stats = p->getStats();
-      m_metrics.completedProcesses++;
-      totalWait += stats.totalWaitTime;
-      totalTurnaround += (stats.finishTime - p->getArrivalTime());
-    }
+  // Deadlines that passed this tick; finished jobs left the count in recordCompletion
+  while (!m_pendingDeadlines.empty() && m_pendingDeadlines.top().first < m_metrics.currentTick) {
+    const Process* job = m_pendingDeadlines.top().second;
+    m_pendingDeadlines.pop();
+    if (job->getState() != ProcessState::TERMINATED) m_overdueJobs.insert(job);
   }
 
-  if (m_metrics.completedProcesses > 0) {
-    m_metrics.avgWaitTime = totalWait / m_metrics.completedProcesses;
-    m_metrics.avgTurnaroundTime = totalTurnaround / m_metrics.completedProcesses;
-  } else {
-    m_metrics.avgWaitTime = 0.0;
-    m_metrics.avgTurnaroundTime = 0.0;
-  }
+  // Process-specific stats come from running totals; averages are computed on read
+  m_metrics.completedProcesses = m_completion.completed;
+  m_metrics.deadlineJobs = m_completion.deadlineJobs;
+  m_metrics.deadlineMisses = m_completion.lateFinished + static_cast<int>(m_overdueJobs.size());
+  m_metrics.maxLateness = m_completion.maxLateness;
 
   // Check for simulation completion
   if (m_isRunning && m_metrics.completedProcesses == m_metrics.totalProcesses && m_metrics.totalProcesses > 0) {
@@ -542,6 +701,76 @@ void Simulator::updateMetrics() {
   }
 }
 
+void Simulator::recordRelease(const Process* p) {
+  if (!p->hasDeadline()) return;
+  m_completion.deadlineJobs++;
+  m_pendingDeadlines.push({p->getAbsoluteDeadline(), p});
+}
+
+void Simulator::recordCompletion(const Process* p) {
+  auto stats = p->getStats();  // One copy per process lifetime, not per tick
+  uint64_t turnaround = stats.finishTime - p->getArrivalTime();
+  m_completion.completed++;
+  m_completion.waitSum += stats.totalWaitTime;
+  m_completion.turnaroundSum += turnaround;
+
+  m_waitHistogram.record(stats.totalWaitTime);
+  m_turnaroundHistogram.record(turnaround);
+  if (stats.hasStarted) m_responseHistogram.record(stats.startTime - p->getArrivalTime());
+  if (turnaround > 0) {
+    double share = static_cast<double>(stats.totalCpuTime) / static_cast<double>(turnaround);
+    m_completion.serviceShares++;
+    m_completion.serviceShareSum += share;
+    m_completion.serviceShareSquares += share * share;
+  }
+
+  if (!p->hasDeadline()) return;
+  int64_t lateness = static_cast<int64_t>(stats.finishTime) - static_cast<int64_t>(p->getAbsoluteDeadline());
+  m_overdueJobs.erase(p);
+  if (lateness > 0) m_completion.lateFinished++;
+  m_completion.maxLateness =
+      (m_completion.finishedDeadlineJobs == 0) ? lateness : std::max(m_completion.maxLateness, lateness);
+  m_completion.latenessSum += lateness;
+  m_completion.finishedDeadlineJobs++;
+}
+
+void Simulator::clearCompletionTotals() {
+  m_completion = CompletionTotals();
+  m_waitHistogram.clear();
+  m_responseHistogram.clear();
+  m_turnaroundHistogram.clear();
+  m_pendingDeadlines = {};
+  m_overdueJobs.clear();
+}
+
+TickSample Simulator::sampleTick(uint64_t now, bool switching, uint64_t activeBefore, int faultsBefore,
+                                 int switchesBefore) const {
+  TickSample sample;
+  sample.tick = now;
+  sample.ready = m_scheduler ? static_cast<uint32_t>(m_scheduler->getReadyCount()) : 0;
+  sample.blocked = static_cast<uint32_t>(m_blockedQueue.size());
+  sample.memoryWait = static_cast<uint32_t>(m_memoryWaitQueue.size());
+  sample.usedFrames = m_memoryManager ? static_cast<uint32_t>(m_memoryManager->getUsedFrameCount()) : 0;
+  if (switching) {
+    sample.cpu = CpuActivity::CONTEXT_SWITCH;
+  } else if (m_cpuActiveTicks > activeBefore) {
+    sample.cpu = CpuActivity::BUSY;
+  }
+  sample.pageFaults = static_cast<uint32_t>(m_totalPageFaults - faultsBefore);
+  sample.contextSwitches = static_cast<uint32_t>(m_totalContextSwitches - switchesBefore);
+  return sample;
+}
+
+void Simulator::writeTraceEvents(const TickSample& sample, int ranPid) {
+  // State changes are stamped with the tick that decides them, so the CPU work of step t
+  // is drawn over [t - 1, t): a process dispatched at t - 1 shows running from t - 1
+  if (sample.tick > 0) m_traceWriter->cpuActivity(sample.cpu, ranPid, sample.tick - 1);
+  m_traceWriter->counters(sample.tick, sample.ready, sample.blocked, sample.memoryWait, sample.usedFrames);
+
+  bool done = m_metrics.totalProcesses > 0 && m_metrics.completedProcesses == m_metrics.totalProcesses;
+  if (done) m_traceWriter->finish(sample.tick + 1);
+}
+
 // APIs to GUI
 std::vector<const Process*> Simulator::getAllProcesses() const {
   // std::lock_guard<std::recursive_mutex> lock(m_simulationMutex);
@@ -577,9 +806,39 @@ std::vector<const Process*> Simulator::getReadyProcesses() const {
   return {};
 }
 
+void Simulator::forEachReadyProcess(const waos::scheduler::IScheduler::ReadyVisitor& visit) const {
+  if (m_scheduler) m_scheduler->forEachReady(visit);
+}
+
+uint64_t Simulator::getReadyQueueVersion() const {
+  if (!m_scheduler) return 0;
+  uint64_t version = m_scheduler->getReadyQueueVersion();
+  return version ? m_readyVersionOffset + version : 0;
+}
+
 waos::common::SimulatorMetrics Simulator::getSimulatorMetrics() const {
   // std::lock_guard<std::recursive_mutex> lock(m_simulationMutex);
-  return m_metrics;
+  waos::common::SimulatorMetrics metrics = m_metrics;
+  const CompletionTotals& totals = m_completion;
+  if (totals.completed > 0) {
+    metrics.avgWaitTime = static_cast<double>(totals.waitSum) / totals.completed;
+    metrics.avgTurnaroundTime = static_cast<double>(totals.turnaroundSum) / totals.completed;
+  }
+  if (totals.finishedDeadlineJobs > 0) {
+    metrics.avgLateness = static_cast<double>(totals.latenessSum) / totals.finishedDeadlineJobs;
+  }
+
+  // Percentile queries scan a fixed bucket array: cost does not grow with the process count
+  metrics.waitLatency = m_waitHistogram.summary();
+  metrics.responseLatency = m_responseHistogram.summary();
+  metrics.turnaroundLatency = m_turnaroundHistogram.summary();
+  if (metrics.currentTick > 0) metrics.throughput = static_cast<double>(totals.completed) / metrics.currentTick;
+  if (totals.serviceShareSquares > 0.0) {
+    // Jain: (sum x)^2 / (n * sum x^2), 1/n (one process got everything) .. 1 (all equal)
+    metrics.fairnessIndex =
+        totals.serviceShareSum * totals.serviceShareSum / (totals.serviceShares * totals.serviceShareSquares);
+  }
+  return metrics;
 }
 
 std::string Simulator::getSchedulerAlgorithmName() const {
@@ -618,6 +877,16 @@ waos::common::MemoryStats Simulator::getMemoryStats() const {
   return {};
 }
 
+std::vector<waos::common::FaultWindowInfo> Simulator::getFaultTimeline(uint64_t fromTick, uint64_t toTick) const {
+  if (m_memoryManager) return m_memoryManager->getFaultTimeline(fromTick, toTick);
+  return {};
+}
+
+waos::common::ProcessFaultRate Simulator::getProcessFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const {
+  if (m_memoryManager) return m_memoryManager->getProcessFaultRate(processId, fromTick, toTick);
+  return {};
+}
+
 void Simulator::log(const QString& message, LogCategory category) {
   uint64_t time = m_clock.getTime();
   QString timeStr = QString("%1:%2")
@@ -0,0 +1,275 @@
+#include "waos/core/TimeSeriesRecorder.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace waos::core {
+
+namespace {
+
+constexpr char MAGIC[8] = {'W', 'A', 'O', 'S', 'T', 'S', '0', '1'};
+
+constexpr const char* COLUMN_NAMES[TimeSeriesRecorder::COLUMN_COUNT] = {
+    "tick", "span", "ready", "blocked", "memory_wait", "used_frames",
+    "cpu_busy", "cpu_idle", "cpu_switch", "page_faults", "switches"};
+
+size_t index(SeriesColumn column) {
+  return static_cast<size_t>(column);
+}
+
+size_t widthOf(size_t column) {
+  return (column == index(SeriesColumn::TICK)) ? 8 : 4;
+}
+
+void writeLittleEndian(std::ostream& out, uint64_t value, size_t bytes) {
+  char buffer[8];
+  for (size_t i = 0; i < bytes; ++i) buffer[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+  out.write(buffer, static_cast<std::streamsize>(bytes));
+}
+
+uint64_t readLittleEndian(std::istream& in, size_t bytes) {
+  unsigned char buffer[8];
+  if (!in.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(bytes))) {
+    throw std::runtime_error("Truncated time-series file");
+  }
+  uint64_t value = 0;
+  for (size_t i = 0; i < bytes; ++i) value |= uint64_t(buffer[i]) << (8 * i);
+  return value;
+}
+
+uint32_t saturate(uint64_t value) {
+  return static_cast<uint32_t>(std::min<uint64_t>(value, UINT32_MAX));
+}
+
+}  // namespace
+
+// ---- ChunkedColumn ----
+
+template <typename T>
+void TimeSeriesRecorder::ChunkedColumn<T>::push(T value, size_t chunkRows) {
+  m_chunkRows = chunkRows;
+  if (m_size == m_chunks.size() * m_chunkRows) m_chunks.push_back(std::make_unique<T[]>(m_chunkRows));
+  m_chunks[m_size / m_chunkRows][m_size % m_chunkRows] = value;
+  m_size++;
+}
+
+template <typename T>
+T TimeSeriesRecorder::ChunkedColumn<T>::at(size_t index) const {
+  return m_chunks[index / m_chunkRows][index % m_chunkRows];
+}
+
+template <typename T>
+void TimeSeriesRecorder::ChunkedColumn<T>::set(size_t index, T value) {
+  m_chunks[index / m_chunkRows][index % m_chunkRows] = value;
+}
+
+template <typename T>
+void TimeSeriesRecorder::ChunkedColumn<T>::truncate(size_t size) {
+  m_size = std::min(m_size, size);  // Chunks stay allocated for the rows that follow
+}
+
+template <typename T>
+void TimeSeriesRecorder::ChunkedColumn<T>::clear() {
+  m_chunks.clear();
+  m_size = 0;
+}
+
+// ---- TimeSeriesRecorder ----
+
+TimeSeriesRecorder::TimeSeriesRecorder(TimeSeriesConfig config) : m_config(config), m_interval(config.interval) {
+  if (m_config.interval == 0) throw std::invalid_argument("Time-series interval must be positive");
+  if (m_config.chunkRows == 0) throw std::invalid_argument("Time-series chunk size must be positive");
+  if (m_config.maxRows == 1) throw std::invalid_argument("Time-series maxRows must be 0 or at least 2");
+}
+
+void TimeSeriesRecorder::record(const TickSample& sample) {
+  Window& w = m_window;
+  if (w.ticks == 0) {
+    // Make room before the window opens, so it already spans the doubled interval
+    if (m_config.maxRows > 0 && rowCount() >= m_config.maxRows) halve();
+    w.start = sample.tick;
+  }
+
+  const std::array<uint32_t, GAUGES> gauges = {sample.ready, sample.blocked, sample.memoryWait, sample.usedFrames};
+  for (size_t i = 0; i < GAUGES; ++i) {
+    w.sum[i] += gauges[i];
+    w.max[i] = (w.ticks == 0) ? gauges[i] : std::max(w.max[i], gauges[i]);
+    w.last[i] = gauges[i];
+  }
+  w.cpu[static_cast<size_t>(sample.cpu)]++;
+  w.pageFaults += sample.pageFaults;
+  w.switches += sample.contextSwitches;
+  w.ticks++;
+
+  if (w.ticks >= m_interval) flush();
+}
+
+void TimeSeriesRecorder::flush() {
+  const Window& w = m_window;
+  if (w.ticks == 0) return;
+
+  Row row{};
+  row[index(SeriesColumn::TICK)] = w.start;
+  row[index(SeriesColumn::SPAN)] = w.ticks;
+  for (size_t i = 0; i < GAUGES; ++i) {
+    row[index(SeriesColumn::READY) + i] = reduce(w.sum[i], w.max[i], w.last[i], w.ticks);
+  }
+  row[index(SeriesColumn::CPU_BUSY)] = w.cpu[static_cast<size_t>(CpuActivity::BUSY)];
+  row[index(SeriesColumn::CPU_IDLE)] = w.cpu[static_cast<size_t>(CpuActivity::IDLE)];
+  row[index(SeriesColumn::CPU_SWITCH)] = w.cpu[static_cast<size_t>(CpuActivity::CONTEXT_SWITCH)];
+  row[index(SeriesColumn::PAGE_FAULTS)] = w.pageFaults;
+  row[index(SeriesColumn::SWITCHES)] = w.switches;
+
+  m_window = Window();
+  appendRow(row);
+}
+
+void TimeSeriesRecorder::clear() {
+  m_window = Window();
+  m_interval = m_config.interval;
+  m_ticks.clear();
+  for (auto& column : m_columns) column.clear();
+}
+
+size_t TimeSeriesRecorder::rowCount() const {
+  return m_ticks.size();
+}
+
+uint64_t TimeSeriesRecorder::interval() const {
+  return m_interval;
+}
+
+uint64_t TimeSeriesRecorder::value(size_t row, SeriesColumn column) const {
+  if (row >= rowCount() || column == SeriesColumn::COUNT) throw std::out_of_range("Time-series cell out of range");
+  if (column == SeriesColumn::TICK) return m_ticks.at(row);
+  return m_columns[index(column) - 1].at(row);
+}
+
+TimeSeriesRecorder::Row TimeSeriesRecorder::row(size_t i) const {
+  Row result{};
+  for (size_t c = 0; c < COLUMN_COUNT; ++c) result[c] = value(i, static_cast<SeriesColumn>(c));
+  return result;
+}
+
+const TimeSeriesConfig& TimeSeriesRecorder::config() const {
+  return m_config;
+}
+
+const char* TimeSeriesRecorder::columnName(SeriesColumn column) {
+  return (column < SeriesColumn::COUNT) ? COLUMN_NAMES[index(column)] : "unknown";
+}
+
+void TimeSeriesRecorder::writeCsv(std::ostream& out) const {
+  for (size_t c = 0; c < COLUMN_COUNT; ++c) out << (c ? "," : "") << COLUMN_NAMES[c];
+  out << '\n';
+  for (size_t r = 0; r < rowCount(); ++r) {
+    out << m_ticks.at(r);
+    for (const auto& column : m_columns) out << ',' << column.at(r);
+    out << '\n';
+  }
+}
+
+void TimeSeriesRecorder::writeBinary(std::ostream& out) const {
+  out.write(MAGIC, sizeof(MAGIC));
+  writeLittleEndian(out, COLUMN_COUNT, 4);
+  writeLittleEndian(out, rowCount(), 8);
+  writeLittleEndian(out, m_interval, 8);
+  for (size_t c = 0; c < COLUMN_COUNT; ++c) {
+    std::string name = COLUMN_NAMES[c];
+    writeLittleEndian(out, widthOf(c), 1);
+    writeLittleEndian(out, name.size(), 1);
+    out.write(name.data(), static_cast<std::streamsize>(name.size()));
+  }
+
+  // Column after column: each one is a contiguous run a reader can map or skip
+  for (size_t r = 0; r < rowCount(); ++r) writeLittleEndian(out, m_ticks.at(r), 8);
+  for (const auto& column : m_columns) {
+    for (size_t r = 0; r < rowCount(); ++r) writeLittleEndian(out, column.at(r), 4);
+  }
+}
+
+std::vector<TimeSeriesRecorder::Row> TimeSeriesRecorder::readBinary(std::istream& in) {
+  char magic[sizeof(MAGIC)];
+  if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)) {
+    throw std::runtime_error("Not a WaOS time-series file");
+  }
+  size_t columns = readLittleEndian(in, 4);
+  size_t rows = readLittleEndian(in, 8);
+  readLittleEndian(in, 8);  // Interval: informative only
+  if (columns != COLUMN_COUNT) throw std::runtime_error("Unsupported time-series column layout");
+
+  std::vector<size_t> widths;
+  for (size_t c = 0; c < columns; ++c) {
+    widths.push_back(readLittleEndian(in, 1));
+    size_t nameLength = readLittleEndian(in, 1);
+    in.ignore(static_cast<std::streamsize>(nameLength));
+  }
+
+  std::vector<Row> result(rows);
+  for (size_t c = 0; c < columns; ++c) {
+    for (size_t r = 0; r < rows; ++r) result[r][c] = readLittleEndian(in, widths[c]);
+  }
+  return result;
+}
+
+void TimeSeriesRecorder::appendRow(const Row& row) {
+  m_ticks.push(row[0], m_config.chunkRows);
+  for (size_t c = 1; c < COLUMN_COUNT; ++c) m_columns[c - 1].push(saturate(row[c]), m_config.chunkRows);
+}
+
+void TimeSeriesRecorder::halve() {
+  const size_t rows = rowCount();
+  const size_t span = index(SeriesColumn::SPAN) - 1;
+  for (size_t out = 0, in = 0; in < rows; ++out, in += 2) {
+    m_ticks.set(out, m_ticks.at(in));
+    if (in + 1 == rows) {
+      for (auto& column : m_columns) column.set(out, column.at(in));
+      continue;
+    }
+
+    uint64_t spanA = m_columns[span].at(in);
+    uint64_t spanB = m_columns[span].at(in + 1);
+    for (size_t c = 1; c < COLUMN_COUNT; ++c) {
+      auto& column = m_columns[c - 1];
+      uint64_t a = column.at(in), b = column.at(in + 1);
+      bool gauge = c >= index(SeriesColumn::READY) && c <= index(SeriesColumn::USED_FRAMES);
+      uint64_t merged = a + b;  // Span and counters add up
+      if (gauge) {
+        switch (m_config.reduction) {
+          case GaugeReduction::MEAN:
+            merged = (a * spanA + b * spanB + (spanA + spanB) / 2) / (spanA + spanB);
+            break;
+          case GaugeReduction::MAX:
+            merged = std::max(a, b);
+            break;
+          case GaugeReduction::LAST:
+            merged = b;
+            break;
+        }
+      }
+      column.set(out, saturate(merged));
+    }
+  }
+
+  size_t kept = (rows + 1) / 2;
+  m_ticks.truncate(kept);
+  for (auto& column : m_columns) column.truncate(kept);
+  m_interval *= 2;
+}
+
+uint32_t TimeSeriesRecorder::reduce(uint64_t sum, uint32_t max, uint32_t last, uint64_t ticks) const {
+  switch (m_config.reduction) {
+    case GaugeReduction::MAX:
+      return max;
+    case GaugeReduction::LAST:
+      return last;
+    case GaugeReduction::MEAN:
+    default:
+      return saturate((sum + ticks / 2) / ticks);
+  }
+}
+
+}  // namespace waos::core
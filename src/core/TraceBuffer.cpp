@@ -0,0 +1,212 @@
+#include "waos/core/TraceBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+
+namespace waos::core {
+
+namespace {
+
+static_assert((TraceBuffer::RING_CAPACITY & (TraceBuffer::RING_CAPACITY - 1)) == 0,
+              "Trace ring capacity must be a power of two");
+
+// One record, written with relaxed atomics so a concurrent drain is never a data race.
+// `version` is 2 * position + 1 while the producer writes the slot and 2 * position + 2 once done.
+struct Slot {
+  std::atomic<uint64_t> version{0};
+  std::atomic<uint64_t> sequence{0};
+  std::atomic<const char*> tag{nullptr};
+  std::atomic<TraceEvent> event{TraceEvent::ENQUEUE};
+  std::atomic<int32_t> pid{0};
+  std::atomic<int64_t> arg0{0};
+  std::atomic<int64_t> arg1{0};
+};
+
+// Single producer (the owning thread), single consumer (drain, under the registry mutex)
+struct Ring {
+  std::array<Slot, TraceBuffer::RING_CAPACITY> slots;
+  std::atomic<uint64_t> head{0};  // Next write position
+  uint64_t tail = 0;              // Next read position (consumer only)
+};
+
+bool initialEnabled() {
+  const char* value = std::getenv("WAOS_TRACE");
+  return value && *value && std::string(value) != "0";
+}
+
+std::atomic<bool> g_enabled{initialEnabled()};
+std::atomic<uint64_t> g_sequence{0};
+std::atomic<uint64_t> g_dropped{0};
+
+std::mutex g_registryMutex;
+std::vector<std::shared_ptr<Ring>>& registry() {
+  static std::vector<std::shared_ptr<Ring>> rings;
+  return rings;
+}
+
+Ring& localRing() {
+  // The registry keeps the ring alive after its thread exits, until it is drained
+  thread_local std::shared_ptr<Ring> ring = [] {
+    auto created = std::make_shared<Ring>();
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    registry().push_back(created);
+    return created;
+  }();
+  return *ring;
+}
+
+// Writes what is still buffered at exit, so a traced run needs no extra code in the front-end
+struct ExitDrain {
+  ExitDrain() { registry(); }  // Constructed first, so the registry outlives this destructor
+  ~ExitDrain() {
+    if (TraceBuffer::enabled()) TraceBuffer::drainTo(std::cerr);
+  }
+} g_exitDrain;
+
+}  // namespace
+
+bool TraceBuffer::enabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void TraceBuffer::setEnabled(bool enabled) {
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void TraceBuffer::record(const char* tag, TraceEvent event, int pid, int64_t arg0, int64_t arg1) {
+  Ring& ring = localRing();
+  uint64_t head = ring.head.load(std::memory_order_relaxed);
+
+  Slot& slot = ring.slots[head & (RING_CAPACITY - 1)];
+  slot.version.store(2 * head + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);  // Odd version is visible before any field
+  slot.sequence.store(g_sequence.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+  slot.tag.store(tag, std::memory_order_relaxed);
+  slot.event.store(event, std::memory_order_relaxed);
+  slot.pid.store(pid, std::memory_order_relaxed);
+  slot.arg0.store(arg0, std::memory_order_relaxed);
+  slot.arg1.store(arg1, std::memory_order_relaxed);
+  slot.version.store(2 * head + 2, std::memory_order_release);
+
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<TraceRecord> TraceBuffer::drain() {
+  std::vector<TraceRecord> result;
+  std::lock_guard<std::mutex> lock(g_registryMutex);
+
+  auto& rings = registry();
+  for (const auto& ring : rings) {
+    uint64_t head = ring->head.load(std::memory_order_acquire);
+    if (head - ring->tail > RING_CAPACITY) {
+      g_dropped.fetch_add(head - ring->tail - RING_CAPACITY, std::memory_order_relaxed);
+      ring->tail = head - RING_CAPACITY;
+    }
+
+    for (; ring->tail < head; ++ring->tail) {
+      const Slot& slot = ring->slots[ring->tail & (RING_CAPACITY - 1)];
+      uint64_t expected = 2 * ring->tail + 2;
+      uint64_t before = slot.version.load(std::memory_order_acquire);
+
+      TraceRecord copy;
+      copy.sequence = slot.sequence.load(std::memory_order_relaxed);
+      copy.tag = slot.tag.load(std::memory_order_relaxed);
+      copy.event = slot.event.load(std::memory_order_relaxed);
+      copy.pid = slot.pid.load(std::memory_order_relaxed);
+      copy.arg0 = slot.arg0.load(std::memory_order_relaxed);
+      copy.arg1 = slot.arg1.load(std::memory_order_relaxed);
+
+      // The producer may have lapped us while copying: discard records it rewrote
+      std::atomic_thread_fence(std::memory_order_acquire);
+      uint64_t after = slot.version.load(std::memory_order_relaxed);
+      if (before != expected || after != expected) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      result.push_back(copy);
+    }
+  }
+
+  // Rings of finished threads are no longer written: drop them once empty
+  rings.erase(std::remove_if(rings.begin(), rings.end(),
+                             [](const std::shared_ptr<Ring>& ring) {
+                               return ring.use_count() == 1 && ring->tail == ring->head.load();
+                             }),
+              rings.end());
+
+  std::sort(result.begin(), result.end(),
+            [](const TraceRecord& a, const TraceRecord& b) { return a.sequence < b.sequence; });
+  return result;
+}
+
+size_t TraceBuffer::drainTo(std::ostream& out) {
+  auto records = drain();
+  for (const auto& record : records) out << format(record) << '\n';
+  out.flush();
+  return records.size();
+}
+
+std::string TraceBuffer::format(const TraceRecord& record) {
+  std::ostringstream line;
+  line << "  [" << (record.tag ? record.tag : "?") << "] ";
+
+  switch (record.event) {
+    case TraceEvent::ENQUEUE:
+    case TraceEvent::DISPATCH:
+      line << eventName(record.event) << " P" << record.pid;
+      if (record.arg0 >= 0) line << " (key=" << record.arg0 << ")";
+      break;
+    case TraceEvent::DEMOTE:
+      line << "demote P" << record.pid << " to level " << record.arg0;
+      break;
+    case TraceEvent::BOOST:
+      line << "priority boost at t=" << record.arg0;
+      break;
+    case TraceEvent::LOTTERY_DRAW:
+      line << "ticket " << record.arg0 << "/" << record.arg1 << " won by P" << record.pid;
+      break;
+    case TraceEvent::PAGE_LOADED:
+    case TraceEvent::PAGE_EVICTED:
+      line << eventName(record.event) << " P" << record.pid << " page " << record.arg0 << " frame " << record.arg1;
+      break;
+  }
+  return line.str();
+}
+
+const char* TraceBuffer::eventName(TraceEvent event) {
+  switch (event) {
+    case TraceEvent::ENQUEUE:
+      return "enqueue";
+    case TraceEvent::DISPATCH:
+      return "dispatch";
+    case TraceEvent::DEMOTE:
+      return "demote";
+    case TraceEvent::BOOST:
+      return "boost";
+    case TraceEvent::LOTTERY_DRAW:
+      return "lottery";
+    case TraceEvent::PAGE_LOADED:
+      return "load";
+    case TraceEvent::PAGE_EVICTED:
+      return "evict";
+  }
+  return "unknown";
+}
+
+uint64_t TraceBuffer::droppedRecords() {
+  return g_dropped.load(std::memory_order_relaxed);
+}
+
+void TraceBuffer::clear() {
+  drain();
+  g_dropped.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace waos::core
@@ -3,21 +3,29 @@
 #include <QCoreApplication>
 #include <QDebug>
 #include <QFileInfo>
+#include <QUrl>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
 
 #include "../viewmodels/BlockingEventsViewModel.h"
 #include "../viewmodels/GanttViewModel.h"
+#include "waos/core/ChromeTraceWriter.h"
+#include "waos/core/EventLog.h"
+#include "waos/core/PolicyRegistry.h"
+#include "waos/core/TimeSeriesRecorder.h"
+#include "waos/core/TraceBuffer.h"
+#include "waos/memory/BuiltinMemoryManagers.h"
 #include "waos/memory/FIFOMemoryManager.h"
-#include "waos/memory/LRUMemoryManager.h"
-#include "waos/memory/OptimalMemoryManager.h"
+#include "waos/scheduler/BuiltinSchedulers.h"
 #include "waos/scheduler/FCFSScheduler.h"
-#include "waos/scheduler/PriorityScheduler.h"
-#include "waos/scheduler/RRScheduler.h"
-#include "waos/scheduler/SJFScheduler.h"
 
 namespace waos::gui::controllers {
 
 SimulationController::SimulationController(QObject* parent)
     : QObject(parent), m_simulator(std::make_unique<waos::core::Simulator>()), m_timer(new QTimer(this)) {
+  registerPolicies();
+
   // Initialize with defaults for integration testing
   m_simulator->setScheduler(std::make_unique<waos::scheduler::FCFSScheduler>());
   m_simulator->setMemoryManager(std::make_unique<waos::memory::FIFOMemoryManager>(16, m_simulator->getClockRef()));
@@ -45,6 +53,10 @@ SimulationController::SimulationController(QObject* parent)
     qWarning() << "Failed to load process file. Checked paths:" << candidatePaths;
   }
 
+  // WAOS_REPLAY=<log> opens straight into replay mode; the Replay button does the same at runtime
+  QString replay = qEnvironmentVariable("WAOS_REPLAY");
+  if (!replay.isEmpty()) loadReplay(replay);
+
   connect(m_timer, &QTimer::timeout, this, &SimulationController::onTimeout);
   connect(m_simulator.get(), &waos::core::Simulator::simulationFinished, this, [this]() {
     stop();
@@ -53,7 +65,16 @@ SimulationController::SimulationController(QObject* parent)
 }
 
 void SimulationController::start() {
+  if (m_replay) {
+    m_timer->start(m_tickInterval);
+    emit isRunningChanged();
+    return;
+  }
+
   if (!m_simulator->getAllProcesses().empty()) {
+    attachTraceExport();
+    attachEventLog();
+    attachTimeSeries();
     m_simulator->start();
     m_timer->start(m_tickInterval);
     emit isRunningChanged();
@@ -65,11 +86,15 @@ void SimulationController::start() {
 void SimulationController::stop() {
   m_simulator->stop();
   m_timer->stop();
+  drainTrace();
+  exportTimeSeries();  // Before reset() or a new process file clears the recorder
   emit isRunningChanged();
 }
 
 void SimulationController::reset() {
   stop();
+  m_replay.reset();
+  m_replayLog.reset();
   m_simulator->reset();
 
   // Reload processes
@@ -89,33 +114,77 @@ void SimulationController::reset() {
 }
 
 void SimulationController::step() {
+  if (m_replay) {
+    replayStep();
+    return;
+  }
+
   // Force a single step even if paused
   m_simulator->tick(true);
+  drainTrace();
+}
+
+bool SimulationController::loadReplay(const QString& path) {
+  // File dialogs hand over URLs
+  QString cleanPath = path.startsWith("file:") ? QUrl(path).toLocalFile() : path;
+
+  std::unique_ptr<waos::core::EventLogReader> log;
+  try {
+    log = std::make_unique<waos::core::EventLogReader>(cleanPath.toStdString());
+  } catch (const std::runtime_error& e) {
+    qWarning() << "Cannot replay" << cleanPath << ":" << e.what();
+    return false;
+  }
+  if (!log->complete()) qWarning() << "Event log" << cleanPath << "was not closed; replaying the records it has";
+
+  stop();
+  emit simulationReset();  // Clear the views before feeding them recorded ticks
+  m_replayLog = std::move(log);
+  m_replay = std::make_unique<waos::core::EventLogReplay>(*m_replayLog);
+  m_replayTick = 0;
+  return true;
+}
+
+void SimulationController::replayStep() {
+  // Same order as a live tick: the views see the state left by the previous ticks
+  m_replay->seek(m_replayTick);
+  int runningPid = m_replay->runningPid();
+  if (runningPid < 0 && m_replay->isContextSwitching()) runningPid = -2;
+  if (m_ganttViewModel) m_ganttViewModel->appendTick(m_replayTick, runningPid);
+  if (m_blockingViewModel) {
+    m_blockingViewModel->showBlocked(m_replayTick, m_replay->blockedPids(), m_replay->memoryWaits());
+  }
+
+  if (m_replay->atEnd() && m_replayTick > m_replayLog->lastTick()) {
+    stop();
+    emit simulationFinished();
+    return;
+  }
+  m_replayTick++;
 }
 
 void SimulationController::configure(const QString& scheduler, int quantum, const QString& memory, int frames, const QString& filePath) {
-  // 1. Configure Scheduler
-  if (scheduler == "Round Robin") {
-    m_simulator->setScheduler(std::make_unique<waos::scheduler::RRScheduler>(quantum));
-  } else if (scheduler == "SJF") {
-    m_simulator->setScheduler(std::make_unique<waos::scheduler::SJFScheduler>());
-  } else if (scheduler == "Priority") {
-    m_simulator->setScheduler(std::make_unique<waos::scheduler::PriorityScheduler>());
-  } else {
-    // Default to FCFS
+  auto& registry = waos::core::PolicyRegistry::instance();
+  waos::core::PolicyArguments args;
+  args.clockRef = m_simulator->getClockRef();
+  args.values["quantum"] = quantum;
+  args.values["frames"] = (frames > 0) ? frames : 16;  // Default fallback
+
+  // 1. Configure Scheduler (unknown names fall back to FCFS)
+  try {
+    m_simulator->setScheduler(registry.createScheduler(scheduler.toStdString(), args));
+  } catch (const std::invalid_argument& e) {
+    qWarning() << "Scheduler" << scheduler << "unavailable:" << e.what();
     m_simulator->setScheduler(std::make_unique<waos::scheduler::FCFSScheduler>());
   }
 
-  // 2. Configure Memory Manager
-  if (frames <= 0) frames = 16;  // Default fallback
-
-  if (memory == "LRU") {
-    m_simulator->setMemoryManager(std::make_unique<waos::memory::LRUMemoryManager>(frames, m_simulator->getClockRef()));
-  } else if (memory == "Optimal") {
-    m_simulator->setMemoryManager(std::make_unique<waos::memory::OptimalMemoryManager>(frames, m_simulator->getClockRef()));
-  } else {
-    // Default to FIFO
-    m_simulator->setMemoryManager(std::make_unique<waos::memory::FIFOMemoryManager>(frames, m_simulator->getClockRef()));
+  // 2. Configure Memory Manager (unknown names fall back to FIFO)
+  try {
+    m_simulator->setMemoryManager(registry.createMemoryManager(memory.toStdString(), args));
+  } catch (const std::invalid_argument& e) {
+    qWarning() << "Memory manager" << memory << "unavailable:" << e.what();
+    m_simulator->setMemoryManager(
+        std::make_unique<waos::memory::FIFOMemoryManager>(args.get("frames"), m_simulator->getClockRef()));
   }
 
   // 3. Load Process File
@@ -137,6 +206,102 @@ void SimulationController::configure(const QString& scheduler, int quantum, cons
   emit simulationReset();  // Refresh views
 }
 
+void SimulationController::registerPolicies() {
+  auto& registry = waos::core::PolicyRegistry::instance();
+  waos::scheduler::registerBuiltinSchedulers(registry);
+  waos::memory::registerBuiltinMemoryManagers(registry);
+
+  // In-house policies: shared libraries in <app dir>/plugins and in $WAOS_PLUGIN_DIR
+  QStringList directories = {QCoreApplication::applicationDirPath() + "/plugins"};
+  QString extra = qEnvironmentVariable("WAOS_PLUGIN_DIR");
+  if (!extra.isEmpty()) directories << extra;
+
+  for (const QString& directory : directories) {
+    int loaded = registry.loadPluginDirectory(directory.toStdString());
+    if (loaded > 0) qDebug() << "Loaded" << loaded << "policy plugin(s) from" << directory;
+  }
+  if (!registry.lastPluginError().empty()) {
+    qWarning() << "Policy plugin error:" << QString::fromStdString(registry.lastPluginError());
+  }
+}
+
+void SimulationController::attachTraceExport() {
+  // A paused run keeps its writer; a new run overwrites the file (open it in ui.perfetto.dev)
+  QString path = qEnvironmentVariable("WAOS_CHROME_TRACE");
+  const auto* writer = m_simulator->getTraceWriter();
+  if (path.isEmpty() || (writer && !writer->finished())) return;
+
+  try {
+    m_simulator->setTraceWriter(std::make_unique<waos::core::ChromeTraceWriter>(path.toStdString()));
+  } catch (const std::runtime_error& e) {
+    qWarning() << "Trace export disabled:" << e.what();
+  }
+}
+
+void SimulationController::attachEventLog() {
+  // Like the trace export: kept while the run is paused, replaced by the next run
+  QString path = qEnvironmentVariable("WAOS_EVENT_LOG");
+  const auto* log = m_simulator->getEventLog();
+  if (path.isEmpty() || (log && !log->closed())) return;
+
+  try {
+    m_simulator->setEventLog(std::make_unique<waos::core::EventLogWriter>(path.toStdString()));
+  } catch (const std::runtime_error& e) {
+    qWarning() << "Event log disabled:" << e.what();
+  }
+}
+
+void SimulationController::attachTimeSeries() {
+  // One recorder for the whole session: the Simulator clears it on reset and on a new process file
+  if (qEnvironmentVariable("WAOS_TIME_SERIES").isEmpty() || m_simulator->getTimeSeriesRecorder()) return;
+  m_simulator->setTimeSeriesRecorder(std::make_unique<waos::core::TimeSeriesRecorder>());
+}
+
+void SimulationController::exportTimeSeries() {
+  // CSV for a ".csv" path, the WAOSTS01 columnar format otherwise
+  QString path = qEnvironmentVariable("WAOS_TIME_SERIES");
+  const auto* series = m_simulator->getTimeSeriesRecorder();
+  if (path.isEmpty() || !series || series->rowCount() == 0) return;
+
+  bool csv = path.endsWith(".csv", Qt::CaseInsensitive);
+  std::ofstream out(path.toStdString(), csv ? std::ios::out : std::ios::out | std::ios::binary);
+  if (!out) {
+    qWarning() << "Time series export failed: cannot write" << path;
+    return;
+  }
+  if (csv) {
+    series->writeCsv(out);
+  } else {
+    series->writeBinary(out);
+  }
+}
+
+QStringList SimulationController::schedulerNames() const {
+  QStringList names;
+  for (const auto& descriptor : waos::core::PolicyRegistry::instance().schedulers()) {
+    names << QString::fromStdString(descriptor.name);
+  }
+  return names;
+}
+
+QStringList SimulationController::memoryNames() const {
+  QStringList names;
+  for (const auto& descriptor : waos::core::PolicyRegistry::instance().memoryManagers()) {
+    names << QString::fromStdString(descriptor.name);
+  }
+  return names;
+}
+
+bool SimulationController::schedulerHasParameter(const QString& scheduler, const QString& parameter) const {
+  for (const auto& descriptor : waos::core::PolicyRegistry::instance().schedulers()) {
+    if (QString::fromStdString(descriptor.name) != scheduler) continue;
+    for (const auto& p : descriptor.parameters) {
+      if (QString::fromStdString(p.name) == parameter) return true;
+    }
+  }
+  return false;
+}
+
 bool SimulationController::isRunning() const {
   return m_timer->isActive();
 }
@@ -186,6 +351,7 @@ void SimulationController::registerBlockingEventsViewModel(waos::gui::viewmodels
   if (vm) {
     vm->setSimulator(m_simulator.get());
     connect(this, &SimulationController::simulationReset, vm, &waos::gui::viewmodels::BlockingEventsViewModel::reset);
+    m_blockingViewModel = vm;
   }
 }
 
@@ -193,11 +359,22 @@ void SimulationController::registerGanttViewModel(waos::gui::viewmodels::GanttVi
   if (vm) {
     vm->setSimulator(m_simulator.get());
     connect(this, &SimulationController::simulationReset, vm, &waos::gui::viewmodels::GanttViewModel::reset);
+    m_ganttViewModel = vm;
   }
 }
 
 void SimulationController::onTimeout() {
+  if (m_replay) {
+    replayStep();
+    return;
+  }
   m_simulator->tick();
+  drainTrace();
+}
+
+void SimulationController::drainTrace() {
+  // Every tick, so the per-thread rings never wrap; whatever is left at exit is written by TraceBuffer
+  if (waos::core::TraceBuffer::enabled()) waos::core::TraceBuffer::drainTo(std::cerr);
 }
 
 }  // namespace waos::gui::controllers
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QObject>
+#include <QStringList>
 #include <QTimer>
 #include <memory>
 
@@ -19,6 +20,8 @@ class SimulationController : public QObject {
   Q_PROPERTY(int tickInterval READ tickInterval WRITE setTickInterval NOTIFY tickIntervalChanged)
   Q_PROPERTY(QString schedulerAlgorithm READ schedulerAlgorithm NOTIFY schedulerAlgorithmChanged)
   Q_PROPERTY(QString memoryAlgorithm READ memoryAlgorithm NOTIFY memoryAlgorithmChanged)
+  Q_PROPERTY(QStringList schedulerNames READ schedulerNames CONSTANT)
+  Q_PROPERTY(QStringList memoryNames READ memoryNames CONSTANT)
 
  public:
   explicit SimulationController(QObject* parent = nullptr);
@@ -29,6 +32,10 @@ class SimulationController : public QObject {
   Q_INVOKABLE void step();
   Q_INVOKABLE void configure(const QString& scheduler, int quantum, const QString& memory, int frames, const QString& filePath);
 
+  // Plays a recorded event log through the Gantt and blocking views instead of running the engine.
+  // start/stop/step drive the playback; reset() returns to live simulation.
+  Q_INVOKABLE bool loadReplay(const QString& path);
+
   bool isRunning() const;
   int tickInterval() const;
   void setTickInterval(int interval);
@@ -36,6 +43,11 @@ class SimulationController : public QObject {
   QString schedulerAlgorithm() const;
   QString memoryAlgorithm() const;
 
+  // Policies available in the registry (built-ins plus loaded plugins)
+  QStringList schedulerNames() const;
+  QStringList memoryNames() const;
+  Q_INVOKABLE bool schedulerHasParameter(const QString& scheduler, const QString& parameter) const;
+
   void registerProcessViewModel(waos::gui::viewmodels::ProcessMonitorViewModel* vm);
   void registerMemoryViewModel(waos::gui::viewmodels::MemoryMonitorViewModel* vm);
   void registerExecutionLogViewModel(waos::gui::viewmodels::ExecutionLogViewModel* vm);
@@ -54,9 +66,23 @@ class SimulationController : public QObject {
   void onTimeout();
 
  private:
+  void registerPolicies();  // Built-ins plus plugin directories, once per controller
+  void attachTraceExport();  // $WAOS_CHROME_TRACE: one Chrome trace file per run
+  void attachEventLog();     // $WAOS_EVENT_LOG: one binary event log per run
+  void attachTimeSeries();   // $WAOS_TIME_SERIES: per-tick series, written by exportTimeSeries()
+  void exportTimeSeries();   // Rewrites the series file with every row recorded so far
+  void replayStep();         // Feeds the next replayed tick to the views
+  void drainTrace();         // $WAOS_TRACE: writes buffered trace records to stderr
+
   std::unique_ptr<waos::core::Simulator> m_simulator;
   QTimer* m_timer;
   int m_tickInterval = 1000;
+
+  waos::gui::viewmodels::GanttViewModel* m_ganttViewModel = nullptr;
+  waos::gui::viewmodels::BlockingEventsViewModel* m_blockingViewModel = nullptr;
+  std::unique_ptr<waos::core::EventLogReader> m_replayLog;
+  std::unique_ptr<waos::core::EventLogReplay> m_replay;
+  uint64_t m_replayTick = 0;
 };
 
 }  // namespace waos::gui::controllers
@@ -118,7 +118,7 @@ std::vector<waos::common::FrameInfo> MockDataProvider::generateFrameStatus(int t
       frame.loadedAtTick = randomInt(0, static_cast<int>(tick));
     } else {
       frame.ownerPid = -1;
-      frame.pageNumber = -1;
+      frame.pageNumber = waos::common::NO_PAGE;
       frame.loadedAtTick = 0;
     }
 
@@ -128,11 +128,12 @@ std::vector<waos::common::FrameInfo> MockDataProvider::generateFrameStatus(int t
   return frames;
 }
 
-std::vector<waos::common::PageTableEntryInfo> MockDataProvider::generatePageTable(int pid, int pages, uint64_t tick) {
+std::vector<waos::common::PageTableEntryInfo> MockDataProvider::generatePageTable(int pid, waos::common::PageNumber pages,
+                                                                                 uint64_t tick) {
   std::vector<waos::common::PageTableEntryInfo> pageTable;
   pageTable.reserve(pages);
 
-  for (int i = 0; i < pages; ++i) {
+  for (waos::common::PageNumber i = 0; i < pages; ++i) {
     waos::common::PageTableEntryInfo entry;
     entry.pageNumber = i;
     entry.present = randomInt(0, 100) < 60;  // 60% probabilidad de estar en memoria
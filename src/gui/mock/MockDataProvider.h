@@ -58,7 +58,8 @@ class MockDataProvider {
    * @param tick Tick actual de la simulación
    * @return Vector de PageTableEntryInfo
    */
-  static std::vector<waos::common::PageTableEntryInfo> generatePageTable(int pid, int pages, uint64_t tick);
+  static std::vector<waos::common::PageTableEntryInfo> generatePageTable(int pid, waos::common::PageNumber pages,
+                                                                         uint64_t tick);
 
   /**
    * @brief Genera estadísticas de memoria
@@ -6,17 +6,18 @@ namespace waos::gui::mock {
 
 MockMemoryManager::MockMemoryManager() {}
 
-bool MockMemoryManager::isPageLoaded(int processId, int pageNumber) const {
+bool MockMemoryManager::isPageLoaded(int processId, waos::common::PageNumber pageNumber) const {
   return true;
 }
 
-waos::memory::PageRequestResult MockMemoryManager::requestPage(int processId, int pageNumber) {
+waos::memory::PageRequestResult MockMemoryManager::requestPage(int processId, waos::common::PageNumber pageNumber,
+                                                               bool isWrite) {
   return waos::memory::PageRequestResult::HIT;
 }
 
-void MockMemoryManager::allocateForProcess(int processId, int requiredPages) {}
+void MockMemoryManager::allocateForProcess(int processId, waos::common::PageNumber requiredPages) {}
 void MockMemoryManager::freeForProcess(int processId) {}
-void MockMemoryManager::completePageLoad(int processId, int pageNumber) {}
+void MockMemoryManager::completePageLoad(int processId, waos::common::PageNumber pageNumber) {}
 
 std::vector<waos::common::FrameInfo> MockMemoryManager::getFrameStatus() const {
   return MockDataProvider::generateFrameStatus(m_totalFrames, 0);
@@ -14,11 +14,12 @@ class MockMemoryManager : public waos::memory::IMemoryManager {
   ~MockMemoryManager() override = default;
 
   // IMemoryManager interface
-  bool isPageLoaded(int processId, int pageNumber) const override;
-  waos::memory::PageRequestResult requestPage(int processId, int pageNumber) override;
-  void allocateForProcess(int processId, int requiredPages) override;
+  bool isPageLoaded(int processId, waos::common::PageNumber pageNumber) const override;
+  waos::memory::PageRequestResult requestPage(int processId, waos::common::PageNumber pageNumber,
+                                              bool isWrite = false) override;
+  void allocateForProcess(int processId, waos::common::PageNumber requiredPages) override;
   void freeForProcess(int processId) override;
-  void completePageLoad(int processId, int pageNumber) override;
+  void completePageLoad(int processId, waos::common::PageNumber pageNumber) override;
 
   // GUI Requirements
   std::vector<waos::common::FrameInfo> getFrameStatus() const;
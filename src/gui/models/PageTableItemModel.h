@@ -7,15 +7,15 @@ namespace waos::gui::models {
 
 class PageTableItemModel : public QObject {
   Q_OBJECT
-  Q_PROPERTY(int pageNumber READ pageNumber CONSTANT)
+  Q_PROPERTY(quint64 pageNumber READ pageNumber CONSTANT)
   Q_PROPERTY(QString frameNumber READ frameNumber CONSTANT)
   Q_PROPERTY(QString state READ state CONSTANT)
 
  public:
-  explicit PageTableItemModel(int page, int frame, bool valid, QObject* parent = nullptr)
+  explicit PageTableItemModel(quint64 page, int frame, bool valid, QObject* parent = nullptr)
       : QObject(parent), m_page(page), m_frame(frame), m_valid(valid) {}
 
-  int pageNumber() const { return m_page; }
+  quint64 pageNumber() const { return m_page; }
 
   QString frameNumber() const {
     if (!m_valid || m_frame == -1) return "—";
@@ -27,7 +27,7 @@ class PageTableItemModel : public QObject {
   }
 
  private:
-  int m_page;
+  quint64 m_page;
   int m_frame;
   bool m_valid;
 };
@@ -57,7 +57,7 @@ void ProcessItemModel::updateFrom(const waos::core::Process* process) {
   }
 
   // Actualizar Next Page
-  int next = process->getCurrentPageRequirement();
+  quint64 next = process->getCurrentPageRequirement();
   if (m_nextPage != next) {
     m_nextPage = next;
     statsUpdated = true;
@@ -67,7 +67,7 @@ void ProcessItemModel::updateFrom(const waos::core::Process* process) {
   if (m_referenceString.isEmpty()) {
     const auto& refs = process->getPageReferenceString();
     QStringList list;
-    for (int p : refs) list << QString::number(p);
+    for (auto p : refs) list << QString::number(p);
     m_referenceString = list.join(", ");
   }
 
@@ -32,8 +32,8 @@ class ProcessItemModel : public QObject {
   Q_PROPERTY(QString currentBurst READ currentBurst NOTIFY burstChanged)
   Q_PROPERTY(int pageFaults READ pageFaults NOTIFY statsChanged)
   Q_PROPERTY(int preemptions READ preemptions NOTIFY statsChanged)
-  Q_PROPERTY(int requiredPages READ requiredPages CONSTANT)
-  Q_PROPERTY(int nextPage READ nextPage NOTIFY statsChanged)
+  Q_PROPERTY(quint64 requiredPages READ requiredPages CONSTANT)
+  Q_PROPERTY(quint64 nextPage READ nextPage NOTIFY statsChanged)
   Q_PROPERTY(QString referenceString READ referenceString CONSTANT)
 
  public:
@@ -50,8 +50,8 @@ class ProcessItemModel : public QObject {
   QString currentBurst() const { return m_currentBurst; }
   int pageFaults() const { return m_pageFaults; }
   int preemptions() const { return m_preemptions; }
-  int requiredPages() const { return m_requiredPages; }
-  int nextPage() const { return m_nextPage; }
+  quint64 requiredPages() const { return m_requiredPages; }
+  quint64 nextPage() const { return m_nextPage; }
   QString referenceString() const { return m_referenceString; }
 
   /**
@@ -76,8 +76,8 @@ class ProcessItemModel : public QObject {
   QString m_currentBurst;
   int m_pageFaults = 0;
   int m_preemptions = 0;
-  int m_requiredPages = 0;
-  int m_nextPage = 0;
+  quint64 m_requiredPages = 0;
+  quint64 m_nextPage = 0;
   QString m_referenceString;
 
   QString stateToString(waos::core::ProcessState state) const;
@@ -35,7 +35,7 @@ Rectangle {
                 Label { text: "Scheduler"; color: controlPanel.textColor; font.bold: true }
                 ComboBox {
                     id: schedulerCombo
-                    model: ["FCFS", "Round Robin", "SJF", "Priority"]
+                    model: simulationController.schedulerNames
                     currentIndex: 0
                     Layout.preferredWidth: 160
                     
@@ -98,9 +98,9 @@ Rectangle {
                 }
             }
 
-            // Quantum (Only for Round Robin)
+            // Quantum (policies whose schema declares "quantum": RR, MLFQ, Lottery, Stride, plugins)
             RowLayout {
-                visible: schedulerCombo.currentText === "Round Robin"
+                visible: simulationController.schedulerHasParameter(schedulerCombo.currentText, "quantum")
                 spacing: 10
                 Label { text: "Quantum"; color: controlPanel.textColor; font.bold: true }
                 SpinBox {
@@ -140,7 +140,7 @@ Rectangle {
                 Label { text: "Memory"; color: controlPanel.textColor; font.bold: true }
                 ComboBox {
                     id: memoryCombo
-                    model: ["FIFO", "LRU", "Optimal"]
+                    model: simulationController.memoryNames
                     currentIndex: 0
                     Layout.preferredWidth: 140
                     
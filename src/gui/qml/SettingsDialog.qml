@@ -55,7 +55,7 @@ Dialog {
             Label { text: "Scheduler Algorithm"; color: textColor; font.bold: true }
             ComboBox {
                 id: schedulerCombo
-                model: ["FCFS", "Round Robin", "SJF", "Priority"]
+                model: simulationController.schedulerNames
                 currentIndex: 0
                 Layout.fillWidth: true
                 
@@ -93,9 +93,9 @@ Dialog {
             }
         }
 
-        // Quantum (Only for Round Robin)
+        // Quantum (policies whose schema declares "quantum": RR, MLFQ, Lottery, Stride, plugins)
         ColumnLayout {
-            visible: schedulerCombo.currentText === "Round Robin"
+            visible: simulationController.schedulerHasParameter(schedulerCombo.currentText, "quantum")
             Layout.fillWidth: true
             spacing: 8
             Label { text: "Time Quantum"; color: textColor; font.bold: true }
@@ -143,7 +143,7 @@ Dialog {
                 
                 ComboBox {
                     id: memoryCombo
-                    model: ["FIFO", "LRU", "Optimal"]
+                    model: simulationController.memoryNames
                     currentIndex: 0
                     Layout.fillWidth: true
                     
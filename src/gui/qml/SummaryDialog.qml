@@ -82,6 +82,57 @@ Dialog {
             }
         }
         
+        // Latency Distribution (ticks)
+        GroupBox {
+            title: "Latency Distribution (ticks)"
+            Layout.fillWidth: true
+            background: Rectangle { color: "transparent"; border.color: "#313244"; radius: 4 }
+            label: Text { text: parent.title; color: "#89b4fa"; font.bold: true }
+
+            GridLayout {
+                columns: 5
+                rowSpacing: 10
+                columnSpacing: 20
+
+                Text { text: ""; color: "#a6adc8" }
+                Text { text: "p50"; color: "#a6adc8" }
+                Text { text: "p95"; color: "#a6adc8" }
+                Text { text: "p99"; color: "#a6adc8" }
+                Text { text: "max"; color: "#a6adc8" }
+
+                Repeater {
+                    model: processViewModel.latencyPercentiles
+                    delegate: Repeater {
+                        required property var modelData
+                        model: [modelData.name + ":", modelData.p50, modelData.p95, modelData.p99, modelData.max]
+                        Text {
+                            required property var modelData
+                            required property int index
+                            text: modelData
+                            color: index === 0 ? "#a6adc8" : "#cdd6f4"
+                            font.bold: index > 0
+                        }
+                    }
+                }
+
+                Text { text: "Throughput:"; color: "#a6adc8" }
+                Text {
+                    Layout.columnSpan: 4
+                    text: processViewModel.throughput.toFixed(3) + " proc/tick"
+                    color: "#a6e3a1"
+                    font.bold: true
+                }
+
+                Text { text: "Jain Fairness:"; color: "#a6adc8" }
+                Text {
+                    Layout.columnSpan: 4
+                    text: processViewModel.fairnessIndex.toFixed(3)
+                    color: "#f9e2af"
+                    font.bold: true
+                }
+            }
+        }
+
         // Memory Stats
         GroupBox {
             title: "Memory Statistics"
@@ -2,6 +2,7 @@ import QtQuick 2.15
 import QtQuick.Controls 2.15
 import QtQuick.Window 2.15
 import QtQuick.Layouts 1.15
+import QtQuick.Dialogs
 
 ApplicationWindow {
     id: mainWindow
@@ -172,6 +173,17 @@ ApplicationWindow {
                                     ToolTip.visible: hovered; ToolTip.text: "Reset"
                                 }
 
+                                // Replay a recorded event log
+                                Button {
+                                    icon.source: "qrc:/icons/folder.svg"
+                                    icon.color: enabled ? mainWindow.textMuted : mainWindow.borderColor
+                                    display: AbstractButton.IconOnly
+                                    background: Rectangle { color: "transparent" }
+                                    enabled: !simulationController.isRunning
+                                    onClicked: replayDialog.open()
+                                    ToolTip.visible: hovered; ToolTip.text: "Replay Event Log"
+                                }
+
                                 // Step
                                 Button {
                                     id: stepButton
@@ -734,6 +746,14 @@ ApplicationWindow {
             anchors.centerIn: parent
         }
 
+        // Event log picker for the Replay button
+        FileDialog {
+            id: replayDialog
+            title: "Select Event Log"
+            nameFilters: ["Event logs (*.wev)", "All files (*)"]
+            onAccepted: simulationController.loadReplay(selectedFile.toString())
+        }
+
         // Summary Dialog Instance
         SummaryDialog {
             id: summaryDialog
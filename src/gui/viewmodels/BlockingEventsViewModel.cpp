@@ -15,17 +15,23 @@ void BlockingEventsViewModel::setSimulator(waos::core::Simulator* simulator) {
 void BlockingEventsViewModel::onClockTicked(uint64_t tick) {
   if (!m_simulator) return;
 
+  std::vector<int> ioBlockedPids;
+  for (const auto* p : m_simulator->getBlockedProcesses()) ioBlockedPids.push_back(p->getPid());
+  showBlocked(tick, ioBlockedPids, m_simulator->getMemoryWaitQueue());
+}
+
+void BlockingEventsViewModel::showBlocked(uint64_t tick, const std::vector<int>& ioBlockedPids,
+                                          const std::vector<waos::common::MemoryWaitInfo>& memoryBlocked) {
   // 1. Handle I/O Blocked Processes
-  auto ioBlocked = m_simulator->getBlockedProcesses();
   std::set<int> currentIoPids;
 
   qDeleteAll(m_ioBlockedItems);
   m_ioBlockedItems.clear();
 
-  for (const auto* p : ioBlocked) {
-    currentIoPids.insert(p->getPid());
+  for (int pid : ioBlockedPids) {
+    currentIoPids.insert(pid);
     // In a real scenario, we'd get the specific I/O device or remaining time
-    m_ioBlockedItems.append(new BlockedItemModel(p->getPid(), "I/O", "Esperando E/S", this));
+    m_ioBlockedItems.append(new BlockedItemModel(pid, "I/O", "Esperando E/S", this));
   }
   emit ioBlockedListChanged();
 
@@ -42,7 +48,6 @@ void BlockingEventsViewModel::onClockTicked(uint64_t tick) {
   m_prevIoBlockedPids = currentIoPids;
 
   // 2. Handle Memory Blocked Processes
-  auto memoryBlocked = m_simulator->getMemoryWaitQueue();
   std::set<int> currentMemPids;
 
   qDeleteAll(m_memoryBlockedItems);
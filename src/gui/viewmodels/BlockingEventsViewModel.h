@@ -27,6 +27,10 @@ class BlockingEventsViewModel : public QObject {
 
   void setSimulator(waos::core::Simulator* simulator);
 
+  // Shows the blocked lists as of `tick`; also fed by log replay
+  void showBlocked(uint64_t tick, const std::vector<int>& ioBlockedPids,
+                   const std::vector<waos::common::MemoryWaitInfo>& memoryBlocked);
+
   QList<QObject*> ioBlockedList() const { return m_ioBlockedItems; }
   QList<QObject*> memoryBlockedList() const { return m_memoryBlockedItems; }
   QStringList notifications() const { return m_notifications; }
@@ -61,9 +61,6 @@ QHash<int, QByteArray> GanttViewModel::roleNames() const {
 void GanttViewModel::onClockTicked(uint64_t tick) {
   if (!m_simulator) return;
 
-  m_totalTicks = tick;
-  emit totalTicksChanged();
-
   const auto* runningProcess = m_simulator->getRunningProcess();
   int runningPid = -1;  // Default to IDLE
 
@@ -72,6 +69,12 @@ void GanttViewModel::onClockTicked(uint64_t tick) {
   } else if (m_simulator->isContextSwitching()) {
     runningPid = -2;  // CS
   }
+  appendTick(tick, runningPid);
+}
+
+void GanttViewModel::appendTick(uint64_t tick, int runningPid) {
+  m_totalTicks = tick;
+  emit totalTicksChanged();
 
   // If process changed, close current block and start new one
   if (runningPid != m_currentPid) {
@@ -33,6 +33,10 @@ class GanttViewModel : public QAbstractListModel {
   explicit GanttViewModel(QObject* parent = nullptr);
 
   void setSimulator(waos::core::Simulator* simulator);
+
+  // Records who held the CPU when `tick` started (-2: CS, -1: Idle); also fed by log replay
+  void appendTick(uint64_t tick, int runningPid);
+
   int totalTicks() const { return m_totalTicks; }
   int idleTime() const { return m_idleTime; }
   int contextSwitchTime() const { return m_contextSwitchTime; }
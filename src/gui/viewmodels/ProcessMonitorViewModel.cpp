@@ -1,9 +1,22 @@
 #include "ProcessMonitorViewModel.h"
 
 #include <QDebug>
+#include <QVariantMap>
 
 namespace waos::gui::viewmodels {
 
+namespace {
+
+QVariantMap latencyRow(const QString& name, const waos::common::LatencyStats& stats) {
+  return {{"name", name},
+          {"p50", QVariant::fromValue<qulonglong>(stats.p50)},
+          {"p95", QVariant::fromValue<qulonglong>(stats.p95)},
+          {"p99", QVariant::fromValue<qulonglong>(stats.p99)},
+          {"max", QVariant::fromValue<qulonglong>(stats.max)}};
+}
+
+}  // namespace
+
 ProcessMonitorViewModel::ProcessMonitorViewModel(QObject* parent) : QObject(parent) {}
 
 void ProcessMonitorViewModel::setSimulator(waos::core::Simulator* simulator) {
@@ -47,6 +60,17 @@ void ProcessMonitorViewModel::onClockTicked(uint64_t tick) {
     m_totalContextSwitches = metrics.totalContextSwitches;
     emit totalContextSwitchesChanged();
   }
+
+  // Distributions only change when a process terminates; throughput changes every tick
+  m_throughput = metrics.throughput;
+  if (m_latencyCount != metrics.completedProcesses) {
+    m_latencyCount = metrics.completedProcesses;
+    m_fairnessIndex = metrics.fairnessIndex;
+    m_latencyPercentiles = {latencyRow("Wait", metrics.waitLatency),
+                            latencyRow("Response", metrics.responseLatency),
+                            latencyRow("Turnaround", metrics.turnaroundLatency)};
+  }
+  emit latencyChanged();
 }
 
 void ProcessMonitorViewModel::reset() {
@@ -65,6 +89,12 @@ void ProcessMonitorViewModel::reset() {
 
   m_totalContextSwitches = 0;
   emit totalContextSwitchesChanged();
+
+  m_throughput = 0.0;
+  m_fairnessIndex = 0.0;
+  m_latencyPercentiles.clear();
+  m_latencyCount = -1;
+  emit latencyChanged();
 }
 
 }  // namespace waos::gui::viewmodels
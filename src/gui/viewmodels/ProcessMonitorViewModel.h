@@ -1,6 +1,7 @@
 #pragma once
 #include <QList>
 #include <QObject>
+#include <QVariantList>
 
 #include "../models/ProcessItemModel.h"
 #include "waos/core/Process.h"
@@ -15,6 +16,10 @@ class ProcessMonitorViewModel : public QObject {
   Q_PROPERTY(double avgTurnaroundTime READ avgTurnaroundTime NOTIFY avgTurnaroundTimeChanged)
   Q_PROPERTY(double cpuUtilization READ cpuUtilization NOTIFY cpuUtilizationChanged)
   Q_PROPERTY(int totalContextSwitches READ totalContextSwitches NOTIFY totalContextSwitchesChanged)
+  Q_PROPERTY(double throughput READ throughput NOTIFY latencyChanged)
+  Q_PROPERTY(double fairnessIndex READ fairnessIndex NOTIFY latencyChanged)
+  // One map per metric: { name, p50, p95, p99, max }
+  Q_PROPERTY(QVariantList latencyPercentiles READ latencyPercentiles NOTIFY latencyChanged)
 
  public:
   explicit ProcessMonitorViewModel(QObject* parent = nullptr);
@@ -26,6 +31,9 @@ class ProcessMonitorViewModel : public QObject {
   double avgTurnaroundTime() const { return m_avgTurnaroundTime; }
   double cpuUtilization() const { return m_cpuUtilization; }
   int totalContextSwitches() const { return m_totalContextSwitches; }
+  double throughput() const { return m_throughput; }
+  double fairnessIndex() const { return m_fairnessIndex; }
+  QVariantList latencyPercentiles() const { return m_latencyPercentiles; }
 
  public slots:
   void onClockTicked(uint64_t tick);
@@ -37,6 +45,7 @@ class ProcessMonitorViewModel : public QObject {
   void avgTurnaroundTimeChanged();
   void cpuUtilizationChanged();
   void totalContextSwitchesChanged();
+  void latencyChanged();
 
  private:
   waos::core::Simulator* m_simulator = nullptr;
@@ -46,6 +55,10 @@ class ProcessMonitorViewModel : public QObject {
   double m_avgTurnaroundTime = 0.0;
   double m_cpuUtilization = 0.0;
   int m_totalContextSwitches = 0;
+  double m_throughput = 0.0;
+  double m_fairnessIndex = 0.0;
+  QVariantList m_latencyPercentiles;
+  int m_latencyCount = -1;  // Completed processes behind m_latencyPercentiles
 };
 
 }  // namespace waos::gui::viewmodels
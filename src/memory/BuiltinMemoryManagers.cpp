@@ -0,0 +1,62 @@
+#include "waos/memory/BuiltinMemoryManagers.h"
+
+#include "waos/memory/FIFOMemoryManager.h"
+#include "waos/memory/LRUMemoryManager.h"
+#include "waos/memory/OptimalMemoryManager.h"
+
+namespace waos::memory {
+
+using waos::core::PolicyArguments;
+
+namespace {
+
+std::vector<waos::core::PolicyParameter> pagingParameters() {
+  return {
+      {"frames", "Physical frames", 16, 1, 1 << 20},
+      {"compressedPoolPercent", "Share of the frames holding the compressed swap pool (0 = off)", 0, 0, 99},
+      {"invertedPageTable", "Page table mode: 0 = per-process radix, 1 = one inverted table", 0, 0, 1},
+      {"pageTableLevels", "Radix page table levels", 4, 1, 48},
+      {"bitsPerLevel", "Virtual page number bits resolved per level", 9, 1, 48},
+      {"walkCostPerLevel", "Fault ticks charged per table level walked (or probe)", 0, 0, 1000},
+  };
+}
+
+PageTableGeometry geometryFrom(const PolicyArguments& args) {
+  PageTableGeometry geometry;
+  geometry.levels = args.get("pageTableLevels");
+  geometry.bitsPerLevel = args.get("bitsPerLevel");
+  geometry.walkCostPerLevel = args.get("walkCostPerLevel");
+  geometry.mode = args.get("invertedPageTable") ? PageTableMode::INVERTED : PageTableMode::RADIX;
+  return geometry;
+}
+
+CompressedSwapConfig swapFrom(const PolicyArguments& args) {
+  CompressedSwapConfig swap;
+  swap.poolFraction = args.get("compressedPoolPercent") / 100.0;
+  return swap;
+}
+
+}  // namespace
+
+void registerBuiltinMemoryManagers(waos::core::PolicyRegistry& registry) {
+  registry.registerMemoryManager({"FIFO", "First-In, First-Out replacement", pagingParameters()},
+                                 [](const PolicyArguments& args) {
+                                   return std::make_unique<FIFOMemoryManager>(args.get("frames"), args.clockRef,
+                                                                              geometryFrom(args), swapFrom(args));
+                                 });
+
+  registry.registerMemoryManager({"LRU", "Least Recently Used replacement", pagingParameters()},
+                                 [](const PolicyArguments& args) {
+                                   return std::make_unique<LRUMemoryManager>(args.get("frames"), args.clockRef,
+                                                                             geometryFrom(args), swapFrom(args));
+                                 });
+
+  registry.registerMemoryManager({"Optimal", "Belady's optimal replacement (uses future references)",
+                                  pagingParameters()},
+                                 [](const PolicyArguments& args) {
+                                   return std::make_unique<OptimalMemoryManager>(args.get("frames"), args.clockRef,
+                                                                                 geometryFrom(args), swapFrom(args));
+                                 });
+}
+
+}  // namespace waos::memory
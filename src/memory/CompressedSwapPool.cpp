@@ -0,0 +1,126 @@
+#include "waos/memory/CompressedSwapPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace waos::memory {
+
+CompressedSwapPool::CompressedSwapPool(int poolFrames, double compressionRatio)
+    : m_poolFrames(poolFrames), m_compressionRatio(compressionRatio) {
+  if (poolFrames < 0) throw std::invalid_argument("Compressed pool frames cannot be negative");
+  if (compressionRatio < 1.0) throw std::invalid_argument("Compression ratio must be at least 1");
+}
+
+int CompressedSwapPool::framesFor(int totalFrames, double poolFraction) {
+  if (poolFraction < 0.0 || poolFraction >= 1.0) {
+    throw std::invalid_argument("Compressed pool fraction must be in [0, 1)");
+  }
+  if (totalFrames <= 0) return 0;
+  return static_cast<int>(std::floor(totalFrames * poolFraction));
+}
+
+bool CompressedSwapPool::enabled() const {
+  return m_poolFrames > 0;
+}
+
+bool CompressedSwapPool::store(int processId, uint64_t pageNumber) {
+  if (!enabled()) return false;
+
+  PageKey key{processId, pageNumber};
+  auto existing = m_slots.find(key);
+  if (existing != m_slots.end()) erase(existing);
+
+  int bytes = compressedSize(processId, pageNumber);
+  if (bytes > REJECT_BYTES) {
+    m_rejected++;
+    return false;
+  }
+
+  // Write the oldest compressed pages back to disk until the new one fits
+  while (!m_lru.empty() && m_usedBytes + bytes > capacityBytes()) {
+    erase(m_slots.find(m_lru.back()));
+    m_writebacks++;
+  }
+
+  m_lru.push_front(key);
+  m_slots[key] = {m_lru.begin(), bytes};
+  m_usedBytes += bytes;
+  return true;
+}
+
+bool CompressedSwapPool::take(int processId, uint64_t pageNumber) {
+  auto it = m_slots.find({processId, pageNumber});
+  if (it == m_slots.end()) return false;
+  erase(it);
+  return true;
+}
+
+bool CompressedSwapPool::contains(int processId, uint64_t pageNumber) const {
+  return m_slots.count({processId, pageNumber}) > 0;
+}
+
+void CompressedSwapPool::dropProcess(int processId) {
+  for (auto it = m_slots.begin(); it != m_slots.end();) {
+    if (it->first.owner == processId) {
+      m_usedBytes -= it->second.bytes;
+      m_lru.erase(it->second.lruPosition);
+      it = m_slots.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void CompressedSwapPool::clear() {
+  m_lru.clear();
+  m_slots.clear();
+  m_usedBytes = 0;
+  m_writebacks = 0;
+  m_rejected = 0;
+}
+
+int CompressedSwapPool::compressedSize(int processId, uint64_t pageNumber) const {
+  // SplitMix64 of the key: same page always compresses to the same size
+  uint64_t z = PageKey{processId, pageNumber}.folded() + 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z ^= z >> 31;
+
+  // Spread sizes over [0.5, 1.5) x the mean compressed size
+  double spread = 0.5 + static_cast<double>(z >> 11) / static_cast<double>(1ULL << 53);
+  int bytes = static_cast<int>(PAGE_BYTES / m_compressionRatio * spread);
+  return std::clamp(bytes, 1, PAGE_BYTES);
+}
+
+int CompressedSwapPool::poolFrames() const {
+  return m_poolFrames;
+}
+
+int CompressedSwapPool::storedPages() const {
+  return static_cast<int>(m_slots.size());
+}
+
+size_t CompressedSwapPool::usedBytes() const {
+  return m_usedBytes;
+}
+
+size_t CompressedSwapPool::capacityBytes() const {
+  return static_cast<size_t>(m_poolFrames) * PAGE_BYTES;
+}
+
+uint64_t CompressedSwapPool::writebacks() const {
+  return m_writebacks;
+}
+
+uint64_t CompressedSwapPool::rejected() const {
+  return m_rejected;
+}
+
+void CompressedSwapPool::erase(std::unordered_map<PageKey, Slot, PageKeyHash>::iterator it) {
+  m_usedBytes -= it->second.bytes;
+  m_lru.erase(it->second.lruPosition);
+  m_slots.erase(it);
+}
+
+}  // namespace waos::memory
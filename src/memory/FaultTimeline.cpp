@@ -0,0 +1,194 @@
+#include "waos/memory/FaultTimeline.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace waos::memory {
+
+namespace {
+constexpr uint64_t kEmptyWindow = std::numeric_limits<uint64_t>::max();
+}
+
+FaultTimeline::FaultTimeline(int windowTicks, int windowCount, int processSlots)
+    : m_windowTicks(windowTicks), m_windowCount(windowCount), m_processSlots(processSlots) {
+  if (windowTicks <= 0) throw std::invalid_argument("Window ticks must be positive");
+  if (windowCount <= 0) throw std::invalid_argument("Window count must be positive");
+  if (processSlots < 0) throw std::invalid_argument("Process slots cannot be negative");
+  reset();
+}
+
+void FaultTimeline::registerProcess(int processId) {
+  if (m_slotByPid.count(processId)) return;
+  if (m_freeSlots.empty()) return;  // Overflow: tracked only in global series and totals
+
+  int slot = m_freeSlots.back();
+  m_freeSlots.pop_back();
+
+  std::fill_n(m_slotFaults.begin() + static_cast<size_t>(slot) * m_windowCount, m_windowCount, 0);
+  m_slotTotals[slot] = 0;
+  m_slotOwner[slot] = processId;
+  m_slotByPid[processId] = slot;
+}
+
+void FaultTimeline::releaseProcess(int processId) {
+  auto it = m_slotByPid.find(processId);
+  if (it == m_slotByPid.end()) return;
+
+  int slot = it->second;
+  if (m_slotTotals[slot] > 0) m_retiredTotals[processId] += m_slotTotals[slot];
+  m_slotTotals[slot] = 0;
+  m_slotOwner[slot] = -1;
+  m_freeSlots.push_back(slot);
+  m_slotByPid.erase(it);
+}
+
+void FaultTimeline::recordHit(int processId, uint64_t tick) {
+  (void)processId;
+  int pos = touchWindow(tick);
+  if (pos >= 0) m_hits[pos]++;
+}
+
+void FaultTimeline::recordFault(int processId, uint64_t tick, bool replacement) {
+  int pos = touchWindow(tick);
+  if (pos >= 0) {
+    m_faults[pos]++;
+    if (replacement) m_replacements[pos]++;
+  }
+
+  int slot = slotOf(processId);
+  if (slot >= 0) {
+    if (pos >= 0) m_slotFaults[static_cast<size_t>(slot) * m_windowCount + pos]++;
+    m_slotTotals[slot]++;
+  } else {
+    m_retiredTotals[processId]++;
+  }
+}
+
+std::vector<waos::common::FaultWindowInfo> FaultTimeline::query(uint64_t fromTick, uint64_t toTick) const {
+  std::vector<waos::common::FaultWindowInfo> result;
+  if (!m_hasData || fromTick > toTick) return result;
+
+  uint64_t first = std::max<uint64_t>(fromTick / m_windowTicks, oldestWindow());
+  uint64_t last = std::min<uint64_t>(toTick / m_windowTicks, m_latestWindow);
+
+  for (uint64_t w = first; w <= last; ++w) {
+    waos::common::FaultWindowInfo info;
+    info.startTick = w * m_windowTicks;
+    info.endTick = info.startTick + m_windowTicks;
+
+    int pos = static_cast<int>(w % m_windowCount);
+    if (m_windowIds[pos] == w) {
+      info.faults = m_faults[pos];
+      info.hits = m_hits[pos];
+      info.replacements = m_replacements[pos];
+    }
+    result.push_back(info);
+  }
+  return result;
+}
+
+waos::common::ProcessFaultRate FaultTimeline::processFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const {
+  waos::common::ProcessFaultRate rate;
+  rate.pid = processId;
+
+  int slot = slotOf(processId);
+  if (slot < 0 || !m_hasData || fromTick > toTick) return rate;
+
+  uint64_t first = std::max<uint64_t>(fromTick / m_windowTicks, oldestWindow());
+  uint64_t last = std::min<uint64_t>(toTick / m_windowTicks, m_latestWindow);
+  for (uint64_t w = first; w <= last; ++w) {
+    if (!isRetained(w)) continue;
+
+    // Ticks of this window that fall inside the requested range
+    uint64_t start = std::max<uint64_t>(w * m_windowTicks, fromTick);
+    uint64_t end = std::min<uint64_t>((w + 1) * m_windowTicks - 1, toTick);
+    rate.ticks += end - start + 1;
+
+    int pos = static_cast<int>(w % m_windowCount);
+    rate.faults += m_slotFaults[static_cast<size_t>(slot) * m_windowCount + pos];
+  }
+
+  rate.faultRate = (rate.ticks > 0) ? static_cast<double>(rate.faults) / rate.ticks : 0.0;
+  return rate;
+}
+
+std::map<int, int> FaultTimeline::faultsPerProcess() const {
+  std::map<int, int> result = m_retiredTotals;
+  for (int slot = 0; slot < m_processSlots; ++slot) {
+    if (m_slotOwner[slot] != -1 && m_slotTotals[slot] > 0) {
+      result[m_slotOwner[slot]] += m_slotTotals[slot];
+    }
+  }
+  return result;
+}
+
+double FaultTimeline::faultRateAt(uint64_t tick) const {
+  uint64_t w = tick / m_windowTicks;
+  if (!isRetained(w)) return 0.0;
+
+  uint64_t elapsed = tick - w * m_windowTicks + 1;
+  return static_cast<double>(m_faults[w % m_windowCount]) / elapsed;
+}
+
+int FaultTimeline::getWindowTicks() const {
+  return m_windowTicks;
+}
+
+void FaultTimeline::reset() {
+  m_windowIds.assign(m_windowCount, kEmptyWindow);
+  m_faults.assign(m_windowCount, 0);
+  m_hits.assign(m_windowCount, 0);
+  m_replacements.assign(m_windowCount, 0);
+  m_latestWindow = 0;
+  m_hasData = false;
+
+  m_slotFaults.assign(static_cast<size_t>(m_processSlots) * m_windowCount, 0);
+  m_slotTotals.assign(m_processSlots, 0);
+  m_slotOwner.assign(m_processSlots, -1);
+  m_freeSlots.clear();
+  for (int slot = m_processSlots - 1; slot >= 0; --slot) m_freeSlots.push_back(slot);
+  m_slotByPid.clear();
+  m_retiredTotals.clear();
+}
+
+int FaultTimeline::touchWindow(uint64_t tick) {
+  uint64_t w = tick / m_windowTicks;
+
+  if (m_hasData && w + m_windowCount <= m_latestWindow) return -1;  // Older than retained history
+  if (!m_hasData || w > m_latestWindow) {
+    m_latestWindow = w;
+    m_hasData = true;
+  }
+
+  int pos = static_cast<int>(w % m_windowCount);
+  if (m_windowIds[pos] != w) {
+    // Recycle the ring position for the new window
+    m_windowIds[pos] = w;
+    m_faults[pos] = 0;
+    m_hits[pos] = 0;
+    m_replacements[pos] = 0;
+    for (int slot = 0; slot < m_processSlots; ++slot) {
+      m_slotFaults[static_cast<size_t>(slot) * m_windowCount + pos] = 0;
+    }
+  }
+  return pos;
+}
+
+int FaultTimeline::slotOf(int processId) const {
+  auto it = m_slotByPid.find(processId);
+  return (it != m_slotByPid.end()) ? it->second : -1;
+}
+
+uint64_t FaultTimeline::oldestWindow() const {
+  uint64_t span = static_cast<uint64_t>(m_windowCount - 1);
+  return (m_latestWindow >= span) ? m_latestWindow - span : 0;
+}
+
+bool FaultTimeline::isRetained(uint64_t windowId) const {
+  if (!m_hasData || windowId > m_latestWindow) return false;
+  if (windowId + m_windowCount <= m_latestWindow) return false;
+  return m_windowIds[windowId % m_windowCount] == windowId;
+}
+
+}  // namespace waos::memory
@@ -0,0 +1,115 @@
+#include "waos/memory/InvertedPageTable.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace waos::memory {
+
+InvertedPageTable::InvertedPageTable(int expectedEntries) {
+  size_t slots = 8;
+  while (slots < static_cast<size_t>(expectedEntries > 0 ? expectedEntries : 0) * 2) slots <<= 1;
+  m_keys.assign(slots, EMPTY_KEY);
+  m_entries.resize(slots);
+  m_mask = slots - 1;
+}
+
+PageTableEntry* InvertedPageTable::find(int processId, uint64_t pageNumber, int* probes) {
+  const auto* self = this;
+  return const_cast<PageTableEntry*>(self->find(processId, pageNumber, probes));
+}
+
+const PageTableEntry* InvertedPageTable::find(int processId, uint64_t pageNumber, int* probes) const {
+  size_t slot = slotOf({processId, pageNumber}, probes);
+  return (m_keys[slot] != EMPTY_KEY) ? &m_entries[slot] : nullptr;
+}
+
+PageTableEntry& InvertedPageTable::insert(int processId, uint64_t pageNumber) {
+  PageKey key{processId, pageNumber};
+  size_t slot = slotOf(key, nullptr);
+  if (m_keys[slot] == key) return m_entries[slot];
+
+  if ((m_size + 1) * 2 > m_keys.size()) {
+    grow();
+    slot = slotOf(key, nullptr);
+  }
+
+  m_keys[slot] = key;
+  m_entries[slot] = PageTableEntry();
+  m_size++;
+  return m_entries[slot];
+}
+
+bool InvertedPageTable::erase(int processId, uint64_t pageNumber) {
+  size_t hole = slotOf({processId, pageNumber}, nullptr);
+  if (m_keys[hole] == EMPTY_KEY) return false;
+
+  // Backward shift: pull later chain members into the hole so lookups never need tombstones
+  size_t next = (hole + 1) & m_mask;
+  while (m_keys[next] != EMPTY_KEY) {
+    size_t ideal = home(m_keys[next]);
+    bool movable = ((next - ideal) & m_mask) >= ((next - hole) & m_mask);
+    if (movable) {
+      m_keys[hole] = m_keys[next];
+      m_entries[hole] = m_entries[next];
+      hole = next;
+    }
+    next = (next + 1) & m_mask;
+  }
+
+  m_keys[hole] = EMPTY_KEY;
+  m_entries[hole] = PageTableEntry();
+  m_size--;
+  return true;
+}
+
+size_t InvertedPageTable::size() const {
+  return m_size;
+}
+
+size_t InvertedPageTable::slotCount() const {
+  return m_keys.size();
+}
+
+size_t InvertedPageTable::memoryBytes() const {
+  return m_keys.size() * (sizeof(PageKey) + sizeof(PageTableEntry));
+}
+
+void InvertedPageTable::clear() {
+  std::fill(m_keys.begin(), m_keys.end(), EMPTY_KEY);
+  std::fill(m_entries.begin(), m_entries.end(), PageTableEntry());
+  m_size = 0;
+}
+
+size_t InvertedPageTable::slotOf(const PageKey& key, int* probes) const {
+  // Returns the slot holding `key`, or the empty slot ending its probe chain
+  size_t slot = home(key);
+  int count = 1;
+  while (m_keys[slot] != EMPTY_KEY && m_keys[slot] != key) {
+    slot = (slot + 1) & m_mask;
+    count++;
+  }
+  if (probes) *probes = count;
+  return slot;
+}
+
+size_t InvertedPageTable::home(const PageKey& key) const {
+  // Fibonacci hashing: spreads consecutive pages of a process across the table
+  return static_cast<size_t>((key.folded() * 0x9e3779b97f4a7c15ULL) >> 32) & m_mask;
+}
+
+void InvertedPageTable::grow() {
+  std::vector<PageKey> oldKeys(m_keys.size() * 2, EMPTY_KEY);
+  std::vector<PageTableEntry> oldEntries(m_keys.size() * 2);
+  std::swap(oldKeys, m_keys);
+  std::swap(oldEntries, m_entries);
+  m_mask = m_keys.size() - 1;
+
+  for (size_t i = 0; i < oldKeys.size(); ++i) {
+    if (oldKeys[i] == EMPTY_KEY) continue;
+    size_t slot = slotOf(oldKeys[i], nullptr);
+    m_keys[slot] = oldKeys[i];
+    m_entries[slot] = oldEntries[i];
+  }
+}
+
+}  // namespace waos::memory
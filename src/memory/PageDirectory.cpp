@@ -0,0 +1,109 @@
+#include "waos/memory/PageDirectory.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace waos::memory {
+
+PageDirectory::PageDirectory(PageTableGeometry geometry, int totalFrames)
+    : m_geometry(geometry),
+      m_inverted(geometry.mode == PageTableMode::INVERTED ? totalFrames : 0) {
+}
+
+void PageDirectory::addProcess(int processId, uint64_t requiredPages) {
+  if (m_geometry.mode == PageTableMode::INVERTED) {
+    m_processes.insert(processId);
+    return;
+  }
+
+  if (m_tables.count(processId)) return;
+
+  if (requiredPages > maxPages()) throw std::invalid_argument("Required pages exceed the page table address space");
+
+  // Only the empty table is reserved; entries are created on first touch
+  m_tables.emplace(processId, PageTable(m_geometry));
+}
+
+void PageDirectory::removeProcess(int processId) {
+  if (m_geometry.mode == PageTableMode::RADIX) {
+    m_tables.erase(processId);
+    return;
+  }
+
+  std::vector<uint64_t> pages;
+  forEach(processId, [&pages](uint64_t pageNumber, const PageTableEntry&) { pages.push_back(pageNumber); });
+  for (uint64_t pageNumber : pages) m_inverted.erase(processId, pageNumber);
+  m_processes.erase(processId);
+}
+
+bool PageDirectory::hasProcess(int processId) const {
+  if (m_geometry.mode == PageTableMode::INVERTED) return m_processes.count(processId) > 0;
+  return m_tables.count(processId) > 0;
+}
+
+PageTableEntry* PageDirectory::find(int processId, uint64_t pageNumber, int* levelsWalked) {
+  const auto* self = this;
+  return const_cast<PageTableEntry*>(self->find(processId, pageNumber, levelsWalked));
+}
+
+const PageTableEntry* PageDirectory::find(int processId, uint64_t pageNumber, int* levelsWalked) const {
+  if (levelsWalked) *levelsWalked = 0;
+  if (m_geometry.mode == PageTableMode::INVERTED) return m_inverted.find(processId, pageNumber, levelsWalked);
+
+  auto it = m_tables.find(processId);
+  if (it == m_tables.end()) return nullptr;
+  return it->second.find(pageNumber, levelsWalked);
+}
+
+PageTableEntry& PageDirectory::load(int processId, uint64_t pageNumber, int frameIndex, uint64_t currentTime) {
+  PageTableEntry* entry = nullptr;
+  if (m_geometry.mode == PageTableMode::INVERTED) {
+    entry = &m_inverted.insert(processId, pageNumber);
+  } else {
+    entry = &m_tables.try_emplace(processId, m_geometry).first->second[pageNumber];
+  }
+  entry->load(frameIndex, currentTime);
+  return *entry;
+}
+
+void PageDirectory::evict(int processId, uint64_t pageNumber) {
+  if (m_geometry.mode == PageTableMode::INVERTED) {
+    m_inverted.erase(processId, pageNumber);
+    return;
+  }
+  PageTableEntry* entry = find(processId, pageNumber);
+  if (entry) entry->evict();
+}
+
+size_t PageDirectory::nodeCount() const {
+  if (m_geometry.mode == PageTableMode::INVERTED) return 1;
+
+  size_t nodes = 0;
+  for (const auto& pair : m_tables) nodes += pair.second.nodeCount();
+  return nodes;
+}
+
+size_t PageDirectory::memoryBytes() const {
+  if (m_geometry.mode == PageTableMode::INVERTED) return m_inverted.memoryBytes();
+
+  size_t bytes = 0;
+  for (const auto& pair : m_tables) bytes += pair.second.memoryBytes();
+  return bytes;
+}
+
+uint64_t PageDirectory::maxPages() const {
+  if (m_geometry.mode == PageTableMode::INVERTED) return UINT64_MAX;  // Keys are (pid, page) hashes
+  return uint64_t(1) << (m_geometry.levels * m_geometry.bitsPerLevel);
+}
+
+const PageTableGeometry& PageDirectory::geometry() const {
+  return m_geometry;
+}
+
+void PageDirectory::clear() {
+  m_tables.clear();
+  m_inverted.clear();
+  m_processes.clear();
+}
+
+}  // namespace waos::memory
@@ -0,0 +1,354 @@
+#include "waos/memory/PagedMemoryManager.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "waos/core/TraceBuffer.h"
+
+namespace waos::memory {
+
+PagedMemoryManager::PagedMemoryManager(int totalFrames, const uint64_t* clockRef, PageTableGeometry geometry,
+                                       CompressedSwapConfig swap, const char* traceTag)
+    : m_frames(totalFrames - CompressedSwapPool::framesFor(totalFrames, swap.poolFraction)),
+      m_clockRef(clockRef),
+      m_pageTables(geometry, static_cast<int>(m_frames.size())),
+      m_geometry(geometry),
+      m_swapConfig(swap),
+      m_swap(CompressedSwapPool::framesFor(totalFrames, swap.poolFraction), swap.compressionRatio),
+      m_traceTag(traceTag) {
+  m_stats.totalFrames = static_cast<int>(m_frames.size());
+  m_stats.usedFrames = 0;
+  m_stats.totalPageFaults = 0;
+  m_stats.totalReplacements = 0;
+  m_stats.hitRatio = 0.0;
+
+  if (totalFrames <= 0) throw std::invalid_argument("Total frames must be positive");
+  if (m_frames.empty()) throw std::invalid_argument("Compressed pool leaves no frames for pages");
+  if (swap.reloadPenalty < 0) throw std::invalid_argument("Compressed reload penalty cannot be negative");
+  if (!clockRef) throw std::invalid_argument("Clock reference cannot be null");
+  PageTable validateGeometry(m_geometry);  // Throws on invalid geometry
+}
+
+bool PagedMemoryManager::isPageLoaded(int processId, waos::common::PageNumber pageNumber) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const PageTableEntry* entry = m_pageTables.find(processId, pageNumber);
+  return entry && entry->isLoaded();
+}
+
+int PagedMemoryManager::getFrameForPage(int processId, waos::common::PageNumber pageNumber) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const PageTableEntry* entry = m_pageTables.find(processId, pageNumber);
+  return (entry && entry->isLoaded()) ? entry->frameNumber : -1;
+}
+
+PageRequestResult PagedMemoryManager::requestPage(int processId, waos::common::PageNumber pageNumber, bool isWrite) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  PageKey sharedKey;
+  bool copyOnWrite = false;
+  bool shared = m_shared.lookup(processId, pageNumber, sharedKey, copyOnWrite);
+  bool needsPrivateCopy = shared && copyOnWrite && isWrite;
+
+  m_lastWalkCost = 0;
+  if (m_pageTables.hasProcess(processId)) {
+    int levelsWalked = 0;
+    PageTableEntry* entry = m_pageTables.find(processId, pageNumber, &levelsWalked);
+    m_totalWalkSteps += levelsWalked;
+    m_lastWalkCost = levelsWalked * m_geometry.walkCostPerLevel;
+    if (entry && entry->isLoaded()) {
+      if (needsPrivateCopy) return splitCopyOnWrite(processId, pageNumber, *entry);
+      if (isWrite) entry->modified = true;
+      recordHit(processId, pageNumber);
+      return PageRequestResult::HIT;
+    }
+
+    // Region page already resident for another process: map it, no I/O needed
+    int residentFrame = shared ? m_shared.residentFrame(sharedKey) : -1;
+    if (residentFrame != -1 && !needsPrivateCopy) {
+      PageTableEntry& mapped = m_pageTables.load(processId, pageNumber, residentFrame, *m_clockRef);
+      if (isWrite) mapped.modified = true;
+      m_shared.attach(sharedKey, residentFrame, processId, pageNumber, m_frames);
+      m_stats.sharedMappingHits++;
+      recordHit(processId, pageNumber);
+      return PageRequestResult::HIT;
+    }
+  }
+
+  m_stats.totalPageFaults++;
+
+  // Taken out of the pool before eviction so its space can be reused
+  bool fromPool = m_swap.take(processId, pageNumber);
+
+  bool replaced = false;
+  int frameIndex = acquireFrame(replaced);
+  loadPageIntoFrame(processId, pageNumber, frameIndex);
+  if (isWrite) m_pageTables.find(processId, pageNumber)->modified = true;
+  m_timeline.recordFault(processId, *m_clockRef, replaced);
+
+  if (needsPrivateCopy) {
+    // First write through a COW mapping: the copy is private from the start
+    m_shared.privatize(processId, pageNumber);
+    if (m_shared.residentFrame(sharedKey) != -1) {
+      m_stats.copyOnWriteFaults++;
+      return PageRequestResult::COPY_ON_WRITE;
+    }
+  } else if (shared) {
+    m_shared.attach(sharedKey, frameIndex, processId, pageNumber, m_frames);
+  }
+
+  if (fromPool) {
+    m_stats.compressedReloads++;
+    return PageRequestResult::COMPRESSED_RELOAD;
+  }
+  return replaced ? PageRequestResult::REPLACEMENT : PageRequestResult::PAGE_FAULT;
+}
+
+void PagedMemoryManager::allocateForProcess(int processId, waos::common::PageNumber requiredPages) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (m_pageTables.hasProcess(processId)) return;
+  m_pageTables.addProcess(processId, requiredPages);
+  m_timeline.registerProcess(processId);
+}
+
+void PagedMemoryManager::mapSharedRegion(int processId, int regionId, waos::common::PageNumber firstPage,
+                                         waos::common::PageNumber pageCount, bool copyOnWrite) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_shared.mapRegion(processId, {regionId, firstPage, pageCount, copyOnWrite});
+}
+
+void PagedMemoryManager::freeForProcess(int processId) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (!m_pageTables.hasProcess(processId)) return;
+
+  // Free the frames mapped by this process; shared frames stay while other mappers remain
+  m_pageTables.forEach(processId, [this, processId](uint64_t pageNumber, const PageTableEntry& entry) {
+    if (!entry.present) return;
+    int frameIndex = entry.frameNumber;
+    if (m_shared.detach(frameIndex, processId, pageNumber, m_frames) > 0) return;
+    m_frames[frameIndex].reset();
+    m_stats.usedFrames--;
+  });
+  m_shared.unmapProcess(processId);
+  m_swap.dropProcess(processId);
+  onProcessFreed(processId);
+
+  m_timeline.releaseProcess(processId);
+  m_pageTables.removeProcess(processId);
+}
+
+void PagedMemoryManager::completePageLoad(int processId, waos::common::PageNumber pageNumber) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  PageTableEntry* entry = m_pageTables.find(processId, pageNumber);
+  if (!entry || !entry->present) return;
+
+  WAOS_TRACE(m_traceTag, PAGE_LOADED, processId, static_cast<int64_t>(pageNumber), entry->frameNumber);
+  entry->lastAccess = *m_clockRef;
+
+  int frameIndex = entry->frameNumber;
+  if (frameIndex >= 0 && frameIndex < static_cast<int>(m_frames.size())) {
+    m_frames[frameIndex].lastAccessTime = *m_clockRef;
+  }
+}
+
+std::vector<waos::common::FrameInfo> PagedMemoryManager::getFrameStatus() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  std::vector<waos::common::FrameInfo> result;
+  for (int i = 0; i < m_frames.size(); ++i) {
+    waos::common::FrameInfo info;
+    info.frameId = i;
+    info.isOccupied = m_frames[i].occupied;
+    info.ownerPid = m_frames[i].pid;
+    info.pageNumber = m_frames[i].pageNumber;
+    info.loadedAtTick = m_frames[i].loadTime;
+    info.refCount = m_frames[i].refCount;
+    result.push_back(info);
+  }
+  return result;
+}
+
+std::vector<waos::common::PageTableEntryInfo> PagedMemoryManager::getPageTableForProcess(int processId) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  std::vector<waos::common::PageTableEntryInfo> result;
+  m_pageTables.forEach(processId, [&result](uint64_t pageNumber, const PageTableEntry& entry) {
+    waos::common::PageTableEntryInfo info;
+    info.pageNumber = pageNumber;
+    info.frameNumber = entry.frameNumber;
+    info.present = entry.present;
+    info.referenced = entry.referenced;
+    info.modified = entry.modified;
+    result.push_back(info);
+  });
+  // Inverted tables are not ordered by page
+  std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) { return a.pageNumber < b.pageNumber; });
+  return result;
+}
+
+waos::common::MemoryStats PagedMemoryManager::getMemoryStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  waos::common::MemoryStats currentStats = m_stats;
+  uint64_t totalAccesses = m_stats.totalPageFaults + m_totalHits;
+  currentStats.hitRatio = (totalAccesses > 0) ? (double)m_totalHits / totalAccesses * 100.0 : 0.0;
+  currentStats.faultsPerProcess = m_timeline.faultsPerProcess();
+  currentStats.currentFaultRate = m_timeline.faultRateAt(*m_clockRef);
+  currentStats.totalPageWalkSteps = m_totalWalkSteps;
+  currentStats.pageTableNodes = static_cast<int>(m_pageTables.nodeCount());
+  currentStats.pageTableBytes = m_pageTables.memoryBytes();
+  currentStats.sharedFrames = m_shared.sharedFrameCount();
+  currentStats.compressedPoolFrames = m_swap.poolFrames();
+  currentStats.compressedPages = m_swap.storedPages();
+  currentStats.compressedWritebacks = static_cast<int>(m_swap.writebacks());
+  return currentStats;
+}
+
+int PagedMemoryManager::getLastWalkCost() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_lastWalkCost;
+}
+
+waos::common::PageNumber PagedMemoryManager::getMaxPages() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pageTables.maxPages();
+}
+
+int PagedMemoryManager::getCompressedReloadPenalty() const {
+  return m_swapConfig.reloadPenalty;
+}
+
+int PagedMemoryManager::getUsedFrameCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats.usedFrames;
+}
+
+std::vector<waos::common::FaultWindowInfo> PagedMemoryManager::getFaultTimeline(uint64_t fromTick, uint64_t toTick) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_timeline.query(fromTick, toTick);
+}
+
+waos::common::ProcessFaultRate PagedMemoryManager::getProcessFaultRate(int processId, uint64_t fromTick, uint64_t toTick) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_timeline.processFaultRate(processId, fromTick, toTick);
+}
+
+void PagedMemoryManager::reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Clear frames
+  for (auto& frame : m_frames) {
+    frame.reset();
+  }
+
+  // Clear page tables
+  m_pageTables.clear();
+  m_shared.clear();
+  m_swap.clear();
+
+  // Reset stats
+  m_stats.usedFrames = 0;
+  m_stats.totalPageFaults = 0;
+  m_stats.totalReplacements = 0;
+  m_stats.hitRatio = 0.0;
+  m_stats.faultsPerProcess.clear();
+  m_stats.sharedMappingHits = 0;
+  m_stats.copyOnWriteFaults = 0;
+  m_stats.compressedReloads = 0;
+  m_totalHits = 0;
+  m_timeline.reset();
+  m_totalWalkSteps = 0;
+  m_lastWalkCost = 0;
+
+  onReset();
+}
+
+void PagedMemoryManager::recordHit(int processId, waos::common::PageNumber pageNumber) {
+  onPageAccessed(processId, pageNumber);
+  m_totalHits++;
+  m_timeline.recordHit(processId, *m_clockRef);
+}
+
+int PagedMemoryManager::findFreeFrame() const {
+  for (size_t i = 0; i < m_frames.size(); ++i) {
+    if (m_frames[i].isFree()) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+void PagedMemoryManager::loadPageIntoFrame(int processId, waos::common::PageNumber pageNumber, int frameIndex) {
+  // Update physical frame
+  Frame& frame = m_frames[frameIndex];
+  frame.pid = processId;
+  frame.pageNumber = pageNumber;
+  frame.occupied = true;
+  frame.loadTime = *m_clockRef;
+  frame.lastAccessTime = *m_clockRef;
+  frame.refCount = 1;
+
+  // Update page table entry
+  m_pageTables.load(processId, pageNumber, frameIndex, *m_clockRef);
+  m_stats.usedFrames++;
+  onPageLoaded(frameIndex);
+}
+
+int PagedMemoryManager::acquireFrame(bool& replaced) {
+  int frameIndex = findFreeFrame();
+  replaced = (frameIndex == -1);
+  if (!replaced) return frameIndex;
+
+  // No free frames, must replace using the subclass policy
+  frameIndex = selectVictimFrame();
+  evictFrame(frameIndex);
+  m_stats.totalReplacements++;
+  return frameIndex;
+}
+
+PageRequestResult PagedMemoryManager::splitCopyOnWrite(int processId, waos::common::PageNumber pageNumber,
+                                                       PageTableEntry& entry) {
+  int sharedFrame = entry.frameNumber;
+  m_shared.privatize(processId, pageNumber);
+
+  if (m_frames[sharedFrame].refCount <= 1) {
+    // Last mapper: take the frame over instead of copying it
+    m_shared.detach(sharedFrame, processId, pageNumber, m_frames);
+    m_frames[sharedFrame].refCount = 1;
+    entry.modified = true;
+    recordHit(processId, pageNumber);
+    return PageRequestResult::HIT;
+  }
+
+  m_shared.detach(sharedFrame, processId, pageNumber, m_frames);
+  m_pageTables.evict(processId, pageNumber);
+  m_stats.totalPageFaults++;
+  m_stats.copyOnWriteFaults++;
+
+  bool replaced = false;
+  int frameIndex = acquireFrame(replaced);
+  loadPageIntoFrame(processId, pageNumber, frameIndex);
+  m_pageTables.find(processId, pageNumber)->modified = true;
+  m_timeline.recordFault(processId, *m_clockRef, replaced);
+  return PageRequestResult::COPY_ON_WRITE;
+}
+
+void PagedMemoryManager::evictFrame(int frameIndex) {
+  Frame& frame = m_frames[frameIndex];
+  if (!frame.occupied) return;
+  WAOS_TRACE(m_traceTag, PAGE_EVICTED, frame.pid, static_cast<int64_t>(frame.pageNumber), frameIndex);
+
+  // A shared frame is unmapped from every page table that references it
+  const auto& mappers = m_shared.mappers(frameIndex);
+  if (mappers.empty()) {
+    m_pageTables.evict(frame.pid, frame.pageNumber);
+    m_swap.store(frame.pid, frame.pageNumber);
+  } else {
+    for (const auto& mapper : mappers) m_pageTables.evict(mapper.first, mapper.second);
+    m_shared.dropFrame(frameIndex);
+  }
+  m_stats.usedFrames--;
+}
+
+}  // namespace waos::memory
@@ -0,0 +1,109 @@
+#include "waos/memory/RadixPageTable.h"
+
+#include <stdexcept>
+
+namespace waos::memory {
+
+RadixPageTable::RadixPageTable(PageTableGeometry geometry) : m_geometry(geometry) {
+  if (m_geometry.levels <= 0) throw std::invalid_argument("Page table levels must be positive");
+  if (m_geometry.bitsPerLevel <= 0) throw std::invalid_argument("Bits per level must be positive");
+  if (m_geometry.levels * m_geometry.bitsPerLevel > 48) {
+    throw std::invalid_argument("Page table geometry exceeds 48 bits of virtual page number");
+  }
+  if (m_geometry.walkCostPerLevel < 0) throw std::invalid_argument("Walk cost cannot be negative");
+}
+
+PageTableEntry* RadixPageTable::find(uint64_t pageNumber, int* levelsWalked) {
+  const auto* self = this;
+  return const_cast<PageTableEntry*>(self->find(pageNumber, levelsWalked));
+}
+
+const PageTableEntry* RadixPageTable::find(uint64_t pageNumber, int* levelsWalked) const {
+  if (levelsWalked) *levelsWalked = 0;
+  if (pageNumber >= capacity()) return nullptr;
+
+  const Node* node = m_root.get();
+  for (int level = 0; node; ++level) {
+    if (levelsWalked) (*levelsWalked)++;
+    size_t index = indexAt(pageNumber, level);
+
+    if (level == m_geometry.levels - 1) {
+      return node->used[index] ? &node->entries[index] : nullptr;
+    }
+    node = node->children[index].get();
+  }
+  return nullptr;
+}
+
+PageTableEntry& RadixPageTable::operator[](uint64_t pageNumber) {
+  if (pageNumber >= capacity()) throw std::out_of_range("Page number outside the virtual address space");
+
+  if (!m_root) m_root = makeNode(0);
+
+  Node* node = m_root.get();
+  for (int level = 0; level < m_geometry.levels - 1; ++level) {
+    auto& child = node->children[indexAt(pageNumber, level)];
+    if (!child) child = makeNode(level + 1);
+    node = child.get();
+  }
+
+  size_t index = indexAt(pageNumber, m_geometry.levels - 1);
+  if (!node->used[index]) {
+    node->used[index] = true;
+    node->entries[index] = PageTableEntry();
+    m_size++;
+  }
+  return node->entries[index];
+}
+
+size_t RadixPageTable::size() const {
+  return m_size;
+}
+
+size_t RadixPageTable::nodeCount() const {
+  return m_nodeCount;
+}
+
+size_t RadixPageTable::memoryBytes() const {
+  const size_t fanOut = size_t(1) << m_geometry.bitsPerLevel;
+  size_t leafBytes = fanOut * sizeof(PageTableEntry) + fanOut / 8;
+  size_t interiorBytes = fanOut * sizeof(std::unique_ptr<Node>);
+  return m_leafCount * leafBytes + (m_nodeCount - m_leafCount) * interiorBytes + m_nodeCount * sizeof(Node);
+}
+
+uint64_t RadixPageTable::capacity() const {
+  return uint64_t(1) << (m_geometry.levels * m_geometry.bitsPerLevel);
+}
+
+const PageTableGeometry& RadixPageTable::geometry() const {
+  return m_geometry;
+}
+
+void RadixPageTable::clear() {
+  m_root.reset();
+  m_size = 0;
+  m_nodeCount = 0;
+  m_leafCount = 0;
+}
+
+std::unique_ptr<RadixPageTable::Node> RadixPageTable::makeNode(int level) {
+  const size_t fanOut = size_t(1) << m_geometry.bitsPerLevel;
+  auto node = std::make_unique<Node>();
+  if (level == m_geometry.levels - 1) {
+    node->entries.resize(fanOut);
+    node->used.assign(fanOut, false);
+    m_leafCount++;
+  } else {
+    node->children.resize(fanOut);
+  }
+  m_nodeCount++;
+  return node;
+}
+
+size_t RadixPageTable::indexAt(uint64_t pageNumber, int level) const {
+  int shift = (m_geometry.levels - 1 - level) * m_geometry.bitsPerLevel;
+  uint64_t mask = (uint64_t(1) << m_geometry.bitsPerLevel) - 1;
+  return static_cast<size_t>((pageNumber >> shift) & mask);
+}
+
+}  // namespace waos::memory
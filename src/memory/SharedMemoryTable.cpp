@@ -0,0 +1,110 @@
+#include "waos/memory/SharedMemoryTable.h"
+
+#include <algorithm>
+
+namespace waos::memory {
+
+void SharedMemoryTable::mapRegion(int processId, const SharedRegionMapping& mapping) {
+  m_mappings[processId].push_back(mapping);
+}
+
+bool SharedMemoryTable::lookup(int processId, uint64_t pageNumber, PageKey& key, bool& copyOnWrite) const {
+  auto it = m_mappings.find(processId);
+  if (it == m_mappings.end()) return false;
+  if (m_privatized.count({processId, pageNumber})) return false;
+
+  for (const auto& mapping : it->second) {
+    if (pageNumber >= mapping.firstPage && pageNumber - mapping.firstPage < mapping.pageCount) {
+      key = {mapping.regionId, pageNumber - mapping.firstPage};
+      copyOnWrite = mapping.copyOnWrite;
+      return true;
+    }
+  }
+  return false;
+}
+
+int SharedMemoryTable::residentFrame(const PageKey& key) const {
+  auto it = m_residentByKey.find(key);
+  return (it != m_residentByKey.end()) ? it->second : -1;
+}
+
+void SharedMemoryTable::attach(const PageKey& key, int frameIndex, int processId, uint64_t pageNumber,
+                               std::vector<Frame>& frames) {
+  m_residentByKey[key] = frameIndex;
+  m_keyByFrame[frameIndex] = key;
+
+  auto& list = m_mappersByFrame[frameIndex];
+  if (std::find(list.begin(), list.end(), Mapper(processId, pageNumber)) == list.end()) {
+    list.emplace_back(processId, pageNumber);
+  }
+  frames[frameIndex].refCount = static_cast<int>(list.size());
+}
+
+int SharedMemoryTable::detach(int frameIndex, int processId, uint64_t pageNumber, std::vector<Frame>& frames) {
+  auto it = m_mappersByFrame.find(frameIndex);
+  if (it == m_mappersByFrame.end()) return 0;
+
+  auto& list = it->second;
+  list.erase(std::remove(list.begin(), list.end(), Mapper(processId, pageNumber)), list.end());
+
+  Frame& frame = frames[frameIndex];
+  frame.refCount = static_cast<int>(list.size());
+  if (!list.empty() && frame.pid == processId && frame.pageNumber == pageNumber) {
+    // Owner left: hand the frame over to the next mapper
+    frame.pid = list.front().first;
+    frame.pageNumber = list.front().second;
+  }
+
+  int remaining = static_cast<int>(list.size());
+  if (remaining == 0) dropFrame(frameIndex);
+  return remaining;
+}
+
+void SharedMemoryTable::privatize(int processId, uint64_t pageNumber) {
+  m_privatized.insert({processId, pageNumber});
+}
+
+const std::vector<SharedMemoryTable::Mapper>& SharedMemoryTable::mappers(int frameIndex) const {
+  static const std::vector<Mapper> kEmpty;
+  auto it = m_mappersByFrame.find(frameIndex);
+  return (it != m_mappersByFrame.end()) ? it->second : kEmpty;
+}
+
+void SharedMemoryTable::dropFrame(int frameIndex) {
+  auto it = m_keyByFrame.find(frameIndex);
+  if (it != m_keyByFrame.end()) {
+    auto resident = m_residentByKey.find(it->second);
+    if (resident != m_residentByKey.end() && resident->second == frameIndex) m_residentByKey.erase(resident);
+    m_keyByFrame.erase(it);
+  }
+  m_mappersByFrame.erase(frameIndex);
+}
+
+void SharedMemoryTable::unmapProcess(int processId) {
+  m_mappings.erase(processId);
+  for (auto it = m_privatized.begin(); it != m_privatized.end();) {
+    if (it->owner == processId) {
+      it = m_privatized.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+int SharedMemoryTable::sharedFrameCount() const {
+  int count = 0;
+  for (const auto& pair : m_mappersByFrame) {
+    if (pair.second.size() > 1) count++;
+  }
+  return count;
+}
+
+void SharedMemoryTable::clear() {
+  m_mappings.clear();
+  m_privatized.clear();
+  m_residentByKey.clear();
+  m_keyByFrame.clear();
+  m_mappersByFrame.clear();
+}
+
+}  // namespace waos::memory
@@ -0,0 +1,93 @@
+#include "waos/scheduler/BuiltinSchedulers.h"
+
+#include "waos/scheduler/CFSScheduler.h"
+#include "waos/scheduler/FCFSScheduler.h"
+#include "waos/scheduler/LotteryScheduler.h"
+#include "waos/scheduler/MLFQScheduler.h"
+#include "waos/scheduler/PredictiveSJFScheduler.h"
+#include "waos/scheduler/PriorityScheduler.h"
+#include "waos/scheduler/RRScheduler.h"
+#include "waos/scheduler/RealTimeScheduler.h"
+#include "waos/scheduler/SJFScheduler.h"
+#include "waos/scheduler/StrideScheduler.h"
+
+namespace waos::scheduler {
+
+using waos::core::PolicyArguments;
+using waos::core::PolicyParameter;
+
+namespace {
+
+PolicyParameter quantumParameter(int defaultValue) {
+    return {"quantum", "Time slice in ticks", defaultValue, 1, 1000};
+}
+
+}  // namespace
+
+void registerBuiltinSchedulers(waos::core::PolicyRegistry& registry) {
+    registry.registerScheduler({"FCFS", "First-Come, First-Served", {}},
+                               [](const PolicyArguments&) { return std::make_unique<FCFSScheduler>(); });
+
+    registry.registerScheduler({"Round Robin", "FIFO with a fixed time slice", {quantumParameter(5)}},
+                               [](const PolicyArguments& args) {
+                                   return std::make_unique<RRScheduler>(args.get("quantum"));
+                               });
+
+    registry.registerScheduler({"SJF", "Shortest Job First (non-preemptive)", {}},
+                               [](const PolicyArguments&) { return std::make_unique<SJFScheduler>(); });
+
+    registry.registerScheduler({"SRTF", "Shortest Remaining Time First", {}},
+                               [](const PolicyArguments&) { return std::make_unique<SJFScheduler>(true); });
+
+    registry.registerScheduler({"SJF Predictivo", "SJF with exponential burst prediction", {}},
+                               [](const PolicyArguments&) { return std::make_unique<PredictiveSJFScheduler>(); });
+
+    // Quantum doubles at each of the three levels
+    registry.registerScheduler(
+        {"MLFQ", "Three-level feedback queue with periodic boost",
+         {quantumParameter(5), {"boostInterval", "Ticks between priority boosts (0 = off)", 50, 0, 1 << 30}}},
+        [](const PolicyArguments& args) {
+            int quantum = args.get("quantum");
+            std::vector<int> quanta = {quantum, quantum * 2, quantum * 4};
+            return std::make_unique<MLFQScheduler>(args.clockRef, quanta,
+                                                   static_cast<uint64_t>(args.get("boostInterval")));
+        });
+
+    registry.registerScheduler({"CFS", "Completely Fair Scheduler (vruntime)", {}},
+                               [](const PolicyArguments&) { return std::make_unique<CFSScheduler>(); });
+
+    registry.registerScheduler({"Lottery", "Proportional share by random tickets", {quantumParameter(5)}},
+                               [](const PolicyArguments& args) {
+                                   return std::make_unique<LotteryScheduler>(args.get("quantum"));
+                               });
+
+    registry.registerScheduler({"Stride", "Deterministic proportional share", {quantumParameter(5)}},
+                               [](const PolicyArguments& args) {
+                                   return std::make_unique<StrideScheduler>(args.get("quantum"));
+                               });
+
+    registry.registerScheduler({"EDF", "Earliest Deadline First", {}}, [](const PolicyArguments&) {
+        return std::make_unique<RealTimeScheduler>(RealTimePolicy::EDF);
+    });
+
+    registry.registerScheduler({"RM", "Rate Monotonic", {}}, [](const PolicyArguments&) {
+        return std::make_unique<RealTimeScheduler>(RealTimePolicy::RATE_MONOTONIC);
+    });
+
+    registry.registerScheduler({"Priority", "Preemptive strict priority", {}}, [](const PolicyArguments& args) {
+        return std::make_unique<PriorityScheduler>(args.clockRef);
+    });
+
+    // One level gained every 10 ticks in READY; waits of 100+ ticks count as starvation
+    registry.registerScheduler(
+        {"Priority + Aging", "Preemptive priority with lazy aging",
+         {{"agingInterval", "Ticks in READY per level gained", 10, 1, 1 << 30},
+          {"starvationThreshold", "READY wait counted as starvation (0 = off)", 100, 0, 1 << 30}}},
+        [](const PolicyArguments& args) {
+            return std::make_unique<PriorityScheduler>(args.clockRef,
+                                                       static_cast<uint64_t>(args.get("agingInterval")),
+                                                       static_cast<uint64_t>(args.get("starvationThreshold")));
+        });
+}
+
+}  // namespace waos::scheduler
@@ -0,0 +1,223 @@
+#include "waos/scheduler/CFSScheduler.h"
+#include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace waos::scheduler {
+
+namespace {
+
+// Linux sched_prio_to_weight: nice -20 .. 19
+constexpr uint32_t kNiceToWeight[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+    9548,  7620,  6100,  4904,  3906,
+    3121,  2501,  1991,  1586,  1277,
+    1024,  820,   655,   526,   423,
+    335,   272,   215,   172,   137,
+    110,   87,    70,    56,    45,
+    36,    29,    23,    18,    15,
+};
+
+}  // namespace
+
+bool CFSScheduler::Node::operator<(const Node& other) const {
+    if (vruntime != other.vruntime) return vruntime < other.vruntime;
+    return sequence < other.sequence;
+}
+
+CFSScheduler::CFSScheduler(int targetLatency, int minGranularity)
+    : m_targetLatency(targetLatency), m_minGranularity(minGranularity) {
+    if (targetLatency <= 0) throw std::invalid_argument("Target latency must be positive");
+    if (minGranularity <= 0) throw std::invalid_argument("Minimum granularity must be positive");
+    if (minGranularity > targetLatency) {
+        throw std::invalid_argument("Minimum granularity cannot exceed the target latency");
+    }
+    m_metrics.totalSchedulingDecisions = 0;
+}
+
+void CFSScheduler::addProcess(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int pid = p->getPid();
+    if (m_queued.count(pid)) return;
+
+    auto inserted = m_entities.emplace(pid, Entity{});
+    Entity& entity = inserted.first->second;
+    entity.weight = weightFromNice(niceFromPriority(p->getPriority()));
+
+    // Charge the CPU time used since the last enqueue (a reused PID starts below chargedCpu)
+    uint64_t cpu = p->getStats().totalCpuTime;
+    uint64_t delta = cpu > entity.chargedCpu ? cpu - entity.chargedCpu : 0;
+    entity.vruntime += delta * VRUNTIME_SCALE * NICE_0_WEIGHT / entity.weight;
+    entity.chargedCpu = cpu;
+
+    // New or waking processes: limited credit relative to the queue
+    uint64_t halfLatency = static_cast<uint64_t>(m_targetLatency) * VRUNTIME_SCALE / 2;
+    uint64_t floor = (m_minVruntime > halfLatency) ? m_minVruntime - halfLatency : 0;
+    if (inserted.second) floor = m_minVruntime;
+    entity.vruntime = std::max(entity.vruntime, floor);
+
+    m_queued[pid] = m_timeline.insert(Node{entity.vruntime, m_sequence++, p}).first;
+    m_readyVersion++;
+    m_readyWeight += entity.weight;
+    publish(pid);
+
+    WAOS_TRACE("CFS", ENQUEUE, pid, entity.vruntime, entity.weight);
+}
+
+waos::core::Process* CFSScheduler::getNextProcess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_timeline.empty()) return nullptr;
+
+    // Leftmost node: least virtual runtime
+    auto it = m_timeline.begin();
+    waos::core::Process* p = it->process;
+    m_minVruntime = std::max(m_minVruntime, it->vruntime);
+    m_timeline.erase(it);
+    m_queued.erase(p->getPid());
+    m_readyVersion++;
+    m_readyWeight -= m_entities[p->getPid()].weight;
+
+    m_metrics.totalSchedulingDecisions++;
+    m_metrics.selectionCount[p->getPid()]++;
+    m_metrics.minVirtualRuntime = m_minVruntime / double(VRUNTIME_SCALE);
+
+    WAOS_TRACE("CFS", DISPATCH, p->getPid(), m_minVruntime);
+    return p;
+}
+
+bool CFSScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto queued = m_queued.find(pid);
+    if (queued == m_queued.end()) return false;
+
+    m_timeline.erase(queued->second);
+    m_queued.erase(queued);
+    m_readyWeight -= m_entities[pid].weight;
+    m_readyVersion++;
+    return true;
+}
+
+bool CFSScheduler::updateKey(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto queued = m_queued.find(pid);
+    if (queued == m_queued.end()) return false;
+
+    // A new nice value changes the weight (slice and vruntime rate), not the queued vruntime
+    Entity& entity = m_entities[pid];
+    uint32_t weight = weightFromNice(niceFromPriority(queued->second->process->getPriority()));
+    m_readyWeight = m_readyWeight - entity.weight + weight;
+    entity.weight = weight;
+    return true;
+}
+
+void CFSScheduler::onProcessTerminated(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entities.erase(pid);
+    m_metrics.virtualRuntime.erase(pid);
+}
+
+bool CFSScheduler::hasReadyProcesses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_timeline.empty();
+}
+
+size_t CFSScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_timeline.size();
+}
+
+int CFSScheduler::getTimeSlice() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t total = m_readyWeight + NICE_0_WEIGHT;
+    int slice = static_cast<int>(m_targetLatency * NICE_0_WEIGHT / total);
+    return std::max(slice, m_minGranularity);
+}
+
+int CFSScheduler::getTimeSliceFor(const waos::core::Process* p) const {
+    if (!p) return getTimeSlice();
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint64_t weight = weightFromNice(niceFromPriority(p->getPriority()));
+    uint64_t total = m_readyWeight + (m_queued.count(p->getPid()) ? 0 : weight);
+    int slice = static_cast<int>(m_targetLatency * weight / total);
+    return std::max(slice, m_minGranularity);
+}
+
+bool CFSScheduler::shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const {
+    if (!running || !candidate) return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto queued = m_queued.find(candidate->getPid());
+    if (queued == m_queued.end()) return false;
+
+    uint64_t granularity = static_cast<uint64_t>(m_minGranularity) * VRUNTIME_SCALE;
+    return queued->second->vruntime + granularity < currentVruntime(running);
+}
+
+std::vector<const waos::core::Process*> CFSScheduler::peekReadyQueue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<const waos::core::Process*> result;
+    result.reserve(m_timeline.size());
+    for (const Node& node : m_timeline) result.push_back(node.process);
+    return result;
+}
+
+void CFSScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Node& node : m_timeline) visit(node.process);
+}
+
+uint64_t CFSScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
+}
+
+std::string CFSScheduler::getAlgorithmName() const {
+    return "CFS (Completely Fair, latency=" + std::to_string(m_targetLatency) +
+           ", granularity=" + std::to_string(m_minGranularity) + ")";
+}
+
+waos::common::SchedulerMetrics CFSScheduler::getSchedulerMetrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_metrics;
+}
+
+double CFSScheduler::getVirtualRuntime(int pid) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entities.find(pid);
+    return (it != m_entities.end()) ? it->second.vruntime / double(VRUNTIME_SCALE) : 0.0;
+}
+
+double CFSScheduler::getMinVirtualRuntime() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_minVruntime / double(VRUNTIME_SCALE);
+}
+
+int CFSScheduler::niceFromPriority(int priority) {
+    return std::clamp(priority, -20, 19);
+}
+
+uint32_t CFSScheduler::weightFromNice(int nice) {
+    return kNiceToWeight[std::clamp(nice, -20, 19) + 20];
+}
+
+uint64_t CFSScheduler::currentVruntime(const waos::core::Process* p) const {
+    auto it = m_entities.find(p->getPid());
+    uint64_t weight = weightFromNice(niceFromPriority(p->getPriority()));
+    uint64_t cpu = p->getStats().totalCpuTime;
+    if (it == m_entities.end()) return m_minVruntime + cpu * VRUNTIME_SCALE * NICE_0_WEIGHT / weight;
+
+    const Entity& entity = it->second;
+    uint64_t delta = cpu > entity.chargedCpu ? cpu - entity.chargedCpu : 0;
+    return entity.vruntime + delta * VRUNTIME_SCALE * NICE_0_WEIGHT / entity.weight;
+}
+
+void CFSScheduler::publish(int pid) {
+    m_metrics.virtualRuntime[pid] = m_entities[pid].vruntime / double(VRUNTIME_SCALE);
+}
+
+}
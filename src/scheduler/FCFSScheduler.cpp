@@ -1,6 +1,6 @@
 #include "waos/scheduler/FCFSScheduler.h"
 #include "waos/core/Process.h"
-#include <iostream>
+#include "waos/core/TraceBuffer.h"
 
 namespace waos::scheduler {
 
@@ -12,8 +12,9 @@ FCFSScheduler::FCFSScheduler() {
 void FCFSScheduler::addProcess(waos::core::Process* p) {
     if (!p) return;
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_queue.push(p);
-    std::cout << "  [FCFS] Added P" << p->getPid() << " to ready queue" << std::endl;
+    m_handles[p->getPid()] = m_queue.insert(m_queue.end(), p);
+    m_readyVersion++;
+    WAOS_TRACE("FCFS", ENQUEUE, p->getPid());
 }
 
 waos::core::Process* FCFSScheduler::getNextProcess() {
@@ -21,35 +22,61 @@ waos::core::Process* FCFSScheduler::getNextProcess() {
     if (m_queue.empty()) return nullptr;
 
     waos::core::Process* p = m_queue.front();
-    m_queue.pop();
+    m_queue.pop_front();
+    m_handles.erase(p->getPid());
+    m_readyVersion++;
 
     m_metrics.totalSchedulingDecisions++;
     m_metrics.selectionCount[p->getPid()]++;
 
-    std::cout << "  [FCFS] Selected P" << p->getPid() << " for execution (FIFO)" << std::endl;
+    WAOS_TRACE("FCFS", DISPATCH, p->getPid());
     return p;
 }
 
+bool FCFSScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto handle = m_handles.find(pid);
+    if (handle == m_handles.end()) return false;
+
+    m_queue.erase(handle->second);
+    m_handles.erase(handle);
+    m_readyVersion++;
+    return true;
+}
+
+bool FCFSScheduler::updateKey(int pid) {
+    // Arrival order is the only key: nothing to reposition
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_handles.count(pid) > 0;
+}
+
 bool FCFSScheduler::hasReadyProcesses() const {
     std::lock_guard<std::mutex> lock(m_mutex);
     return !m_queue.empty();
 }
 
+size_t FCFSScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue.size();
+}
+
 int FCFSScheduler::getTimeSlice() const {
     return -1; // Non-preemptive by time
 }
 
 std::vector<const waos::core::Process*> FCFSScheduler::peekReadyQueue() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    std::vector<const waos::core::Process*> result;
-    
-    // std::queue no permite iterar, hacemos una copia temporal
-    std::queue<waos::core::Process*> temp = m_queue;
-    while (!temp.empty()) {
-        result.push_back(temp.front());
-        temp.pop();
-    }
-    return result;
+    return {m_queue.begin(), m_queue.end()};
+}
+
+void FCFSScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const waos::core::Process* p : m_queue) visit(p);
+}
+
+uint64_t FCFSScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
 }
 
 std::string FCFSScheduler::getAlgorithmName() const {
@@ -0,0 +1,149 @@
+#include "waos/scheduler/IndexedProcessHeap.h"
+#include "waos/core/Process.h"
+#include <algorithm>
+
+namespace waos::scheduler {
+
+void IndexedProcessHeap::push(waos::core::Process* p, Key key) {
+    if (!p) return;
+    remove(p->getPid());  // A process is queued at most once
+
+    m_nodes.push_back({key, m_nextSequence++, p});
+    m_sortedValid = false;
+    m_positions[p->getPid()] = m_nodes.size() - 1;
+    siftUp(m_nodes.size() - 1);
+}
+
+waos::core::Process* IndexedProcessHeap::pop() {
+    if (m_nodes.empty()) return nullptr;
+    waos::core::Process* p = m_nodes.front().process;
+    removeAt(0);
+    return p;
+}
+
+waos::core::Process* IndexedProcessHeap::top() const {
+    return m_nodes.empty() ? nullptr : m_nodes.front().process;
+}
+
+IndexedProcessHeap::Key IndexedProcessHeap::topKey() const {
+    return m_nodes.front().key;
+}
+
+bool IndexedProcessHeap::updateKey(int pid, Key key) {
+    auto it = m_positions.find(pid);
+    if (it == m_positions.end()) return false;
+
+    size_t index = it->second;
+    Key previous = m_nodes[index].key;
+    if (key == previous) return true;
+
+    m_nodes[index].key = key;
+    m_sortedValid = false;
+    if (key < previous) {
+        siftUp(index);
+    } else {
+        siftDown(index);
+    }
+    return true;
+}
+
+IndexedProcessHeap::Key IndexedProcessHeap::keyOf(int pid) const {
+    return m_nodes[m_positions.at(pid)].key;
+}
+
+bool IndexedProcessHeap::remove(int pid) {
+    auto it = m_positions.find(pid);
+    if (it == m_positions.end()) return false;
+    removeAt(it->second);
+    return true;
+}
+
+waos::core::Process* IndexedProcessHeap::find(int pid) const {
+    auto it = m_positions.find(pid);
+    return (it != m_positions.end()) ? m_nodes[it->second].process : nullptr;
+}
+
+bool IndexedProcessHeap::contains(int pid) const {
+    return m_positions.count(pid) > 0;
+}
+
+bool IndexedProcessHeap::empty() const {
+    return m_nodes.empty();
+}
+
+size_t IndexedProcessHeap::size() const {
+    return m_nodes.size();
+}
+
+const std::vector<const waos::core::Process*>& IndexedProcessHeap::sorted() const {
+    if (m_sortedValid) return m_sortedCache;
+
+    std::vector<Node> nodes = m_nodes;
+    std::sort(nodes.begin(), nodes.end(), less);
+
+    m_sortedCache.clear();
+    m_sortedCache.reserve(nodes.size());
+    for (const Node& node : nodes) m_sortedCache.push_back(node.process);
+    m_sortedValid = true;
+    return m_sortedCache;
+}
+
+bool IndexedProcessHeap::less(const Node& a, const Node& b) {
+    if (a.key != b.key) return a.key < b.key;
+    return a.sequence < b.sequence;
+}
+
+void IndexedProcessHeap::siftUp(size_t index) {
+    Node node = m_nodes[index];
+    while (index > 0) {
+        size_t parent = (index - 1) / ARITY;
+        if (!less(node, m_nodes[parent])) break;
+        place(index, m_nodes[parent]);
+        index = parent;
+    }
+    place(index, node);
+}
+
+void IndexedProcessHeap::siftDown(size_t index) {
+    Node node = m_nodes[index];
+    const size_t count = m_nodes.size();
+    while (true) {
+        size_t first = ARITY * index + 1;
+        if (first >= count) break;
+
+        // Smallest of up to ARITY adjacent children
+        size_t child = first;
+        size_t last = std::min(first + ARITY, count);
+        for (size_t i = first + 1; i < last; ++i) {
+            if (less(m_nodes[i], m_nodes[child])) child = i;
+        }
+        if (!less(m_nodes[child], node)) break;
+        place(index, m_nodes[child]);
+        index = child;
+    }
+    place(index, node);
+}
+
+void IndexedProcessHeap::place(size_t index, const Node& node) {
+    m_nodes[index] = node;
+    m_positions[node.process->getPid()] = index;
+}
+
+void IndexedProcessHeap::removeAt(size_t index) {
+    m_positions.erase(m_nodes[index].process->getPid());
+    m_sortedValid = false;
+
+    Node last = m_nodes.back();
+    m_nodes.pop_back();
+    if (index == m_nodes.size()) return;
+
+    // Move the last node into the hole and restore the heap in whichever direction it violates
+    place(index, last);
+    if (index > 0 && less(m_nodes[index], m_nodes[(index - 1) / ARITY])) {
+        siftUp(index);
+    } else {
+        siftDown(index);
+    }
+}
+
+}
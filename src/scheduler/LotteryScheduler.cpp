@@ -0,0 +1,178 @@
+#include "waos/scheduler/LotteryScheduler.h"
+#include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
+
+namespace waos::scheduler {
+
+LotteryScheduler::LotteryScheduler(int quantum, uint64_t seed) : m_quantum(quantum), m_rng(seed) {
+    if (m_quantum <= 0) m_quantum = 2;  // Fallback seguro
+    m_metrics.totalSchedulingDecisions = 0;
+}
+
+void LotteryScheduler::addProcess(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_slotByPid.count(p->getPid())) return;
+
+    m_ledger.record(p);
+
+    if (m_freeSlots.empty()) grow();
+    size_t slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+
+    int64_t tickets = p->getTickets();
+    m_slots[slot] = p;
+    m_slotTickets[slot] = tickets;
+    m_slotByPid[p->getPid()] = slot;
+    fenwickAdd(slot, tickets);
+    m_totalTickets += tickets;
+    m_readyVersion++;
+
+    WAOS_TRACE("Lottery", ENQUEUE, p->getPid(), tickets);
+}
+
+waos::core::Process* LotteryScheduler::getNextProcess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_totalTickets == 0) return nullptr;
+
+    int64_t winner = static_cast<int64_t>(m_rng() % static_cast<uint64_t>(m_totalTickets));
+    size_t slot = fenwickFind(winner);
+    waos::core::Process* p = m_slots[slot];
+
+    releaseSlot(slot);
+    m_readyVersion++;
+
+    m_metrics.totalSchedulingDecisions++;
+    m_metrics.selectionCount[p->getPid()]++;
+
+    WAOS_TRACE("Lottery", LOTTERY_DRAW, p->getPid(), winner, m_totalTickets);
+    return p;
+}
+
+bool LotteryScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_slotByPid.find(pid);
+    if (it == m_slotByPid.end()) return false;
+
+    releaseSlot(it->second);
+    m_readyVersion++;
+    return true;
+}
+
+bool LotteryScheduler::updateKey(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_slotByPid.find(pid);
+    if (it == m_slotByPid.end()) return false;
+
+    // O(log n): only the Fenwick path of the slot changes
+    size_t slot = it->second;
+    int64_t tickets = m_slots[slot]->getTickets();
+    int64_t delta = tickets - m_slotTickets[slot];
+    fenwickAdd(slot, delta);
+    m_totalTickets += delta;
+    m_slotTickets[slot] = tickets;
+    return true;
+}
+
+bool LotteryScheduler::hasReadyProcesses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_slotByPid.empty();
+}
+
+size_t LotteryScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slotByPid.size();
+}
+
+int LotteryScheduler::getTimeSlice() const {
+    return m_quantum;
+}
+
+std::vector<const waos::core::Process*> LotteryScheduler::peekReadyQueue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<const waos::core::Process*> result;
+    result.reserve(m_slotByPid.size());
+    for (const waos::core::Process* p : m_slots) {
+        if (p) result.push_back(p);
+    }
+    return result;
+}
+
+void LotteryScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const waos::core::Process* p : m_slots) {
+        if (p) visit(p);
+    }
+}
+
+uint64_t LotteryScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
+}
+
+std::string LotteryScheduler::getAlgorithmName() const {
+    return "Lottery (Q=" + std::to_string(m_quantum) + ")";
+}
+
+waos::common::SchedulerMetrics LotteryScheduler::getSchedulerMetrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    waos::common::SchedulerMetrics metrics = m_metrics;
+    m_ledger.fill(metrics);
+    return metrics;
+}
+
+int64_t LotteryScheduler::getTotalReadyTickets() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_totalTickets;
+}
+
+void LotteryScheduler::fenwickAdd(size_t slot, int64_t delta) {
+    for (size_t i = slot + 1; i < m_tree.size(); i += i & (~i + 1)) {
+        m_tree[i] += delta;
+    }
+}
+
+size_t LotteryScheduler::fenwickFind(int64_t ticket) const {
+    // Descend from the highest power of two: finds the last prefix whose sum is <= ticket
+    size_t capacity = m_tree.size() - 1;
+    size_t step = 1;
+    while (step * 2 <= capacity) step *= 2;
+
+    size_t position = 0;
+    for (; step > 0; step /= 2) {
+        size_t next = position + step;
+        if (next <= capacity && m_tree[next] <= ticket) {
+            position = next;
+            ticket -= m_tree[next];
+        }
+    }
+    return position;  // 1-based prefix length == 0-based slot of the winner
+}
+
+void LotteryScheduler::releaseSlot(size_t slot) {
+    fenwickAdd(slot, -m_slotTickets[slot]);
+    m_totalTickets -= m_slotTickets[slot];
+    m_slotByPid.erase(m_slots[slot]->getPid());
+    m_slotTickets[slot] = 0;
+    m_slots[slot] = nullptr;
+    m_freeSlots.push_back(slot);
+}
+
+void LotteryScheduler::grow() {
+    size_t oldCapacity = m_slots.size();
+    size_t capacity = oldCapacity ? oldCapacity * 2 : 8;
+
+    m_slots.resize(capacity, nullptr);
+    m_slotTickets.resize(capacity, 0);
+    for (size_t slot = capacity; slot > oldCapacity; --slot) m_freeSlots.push_back(slot - 1);
+
+    // Rebuild the Fenwick tree in O(n)
+    m_tree.assign(capacity + 1, 0);
+    for (size_t i = 1; i <= capacity; ++i) {
+        m_tree[i] += m_slotTickets[i - 1];
+        size_t parent = i + (i & (~i + 1));
+        if (parent <= capacity) m_tree[parent] += m_tree[i];
+    }
+}
+
+}
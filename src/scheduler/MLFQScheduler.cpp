@@ -0,0 +1,211 @@
+#include "waos/scheduler/MLFQScheduler.h"
+#include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
+#include <stdexcept>
+
+namespace waos::scheduler {
+
+MLFQScheduler::MLFQScheduler(const uint64_t* clockRef, std::vector<int> quanta, uint64_t boostInterval)
+    : m_clockRef(clockRef), m_quanta(std::move(quanta)), m_boostInterval(boostInterval) {
+    if (m_quanta.empty()) throw std::invalid_argument("MLFQ needs at least one level");
+    for (int q : m_quanta) {
+        if (q <= 0) throw std::invalid_argument("MLFQ quanta must be positive");
+    }
+    if (m_boostInterval > 0 && !m_clockRef) throw std::invalid_argument("MLFQ priority boost requires a clock");
+
+    m_levels.resize(m_quanta.size());
+    m_lastBoost = m_clockRef ? *m_clockRef : 0;
+    m_metrics.totalSchedulingDecisions = 0;
+}
+
+void MLFQScheduler::addProcess(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    boostIfDue();
+
+    int level = levelOf(p->getPid());
+    m_levelByPid[p->getPid()] = level;
+    m_metrics.queueLevel[p->getPid()] = level;
+    m_handles[p->getPid()] = m_levels[level].insert(m_levels[level].end(), p);
+    m_readyVersion++;
+
+    WAOS_TRACE("MLFQ", ENQUEUE, p->getPid(), level);
+}
+
+waos::core::Process* MLFQScheduler::getNextProcess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    boostIfDue();
+
+    for (size_t level = 0; level < m_levels.size(); ++level) {
+        auto& queue = m_levels[level];
+        if (queue.empty()) continue;
+
+        waos::core::Process* p = queue.front();
+        queue.pop_front();
+        m_handles.erase(p->getPid());
+        m_readyVersion++;
+
+        m_metrics.totalSchedulingDecisions++;
+        m_metrics.selectionCount[p->getPid()]++;
+
+        WAOS_TRACE("MLFQ", DISPATCH, p->getPid(), level);
+        return p;
+    }
+    return nullptr;
+}
+
+bool MLFQScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto handle = m_handles.find(pid);
+    if (handle == m_handles.end()) return false;
+
+    m_levels[levelOf(pid)].erase(handle->second);
+    m_handles.erase(handle);
+    forgetLevel(pid);  // A dropped process that comes back starts on top
+    m_readyVersion++;
+    return true;
+}
+
+bool MLFQScheduler::updateKey(int pid) {
+    // Levels are earned by CPU usage, not by process attributes: nothing to re-read
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_handles.count(pid) > 0;
+}
+
+bool MLFQScheduler::hasReadyProcesses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& queue : m_levels) {
+        if (!queue.empty()) return true;
+    }
+    return false;
+}
+
+size_t MLFQScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_handles.size();
+}
+
+int MLFQScheduler::getTimeSlice() const {
+    return m_quanta.front();  // Slice of a process with no history
+}
+
+int MLFQScheduler::getTimeSliceFor(const waos::core::Process* p) const {
+    if (!p) return getTimeSlice();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_quanta[levelOf(p->getPid())];
+}
+
+void MLFQScheduler::onQuantumExpired(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int level = levelOf(p->getPid());
+    if (level + 1 < static_cast<int>(m_levels.size())) {
+        m_levelByPid[p->getPid()] = level + 1;
+        m_metrics.queueLevel[p->getPid()] = level + 1;
+        m_metrics.demotions++;
+        WAOS_TRACE("MLFQ", DEMOTE, p->getPid(), level + 1);
+    }
+}
+
+void MLFQScheduler::onProcessTerminated(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    forgetLevel(pid);
+}
+
+bool MLFQScheduler::shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const {
+    if (!running || !candidate) return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return levelOf(candidate->getPid()) < levelOf(running->getPid());
+}
+
+std::vector<const waos::core::Process*> MLFQScheduler::peekReadyQueue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<const waos::core::Process*> result;
+    for (const auto& queue : m_levels) {
+        result.insert(result.end(), queue.begin(), queue.end());
+    }
+    return result;
+}
+
+void MLFQScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& queue : m_levels) {
+        for (const waos::core::Process* p : queue) visit(p);
+    }
+}
+
+uint64_t MLFQScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
+}
+
+std::string MLFQScheduler::getAlgorithmName() const {
+    std::string name = "MLFQ (" + std::to_string(m_quanta.size()) + " levels, Q=";
+    for (size_t i = 0; i < m_quanta.size(); ++i) {
+        if (i > 0) name += "/";
+        name += std::to_string(m_quanta[i]);
+    }
+    if (m_boostInterval > 0) name += ", boost=" + std::to_string(m_boostInterval);
+    return name + ")";
+}
+
+waos::common::SchedulerMetrics MLFQScheduler::getSchedulerMetrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_metrics;
+}
+
+int MLFQScheduler::getLevel(int pid) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return levelOf(pid);
+}
+
+int MLFQScheduler::getLevelCount() const {
+    return static_cast<int>(m_levels.size());
+}
+
+int MLFQScheduler::levelOf(int pid) const {
+    auto it = m_levelByPid.find(pid);
+    return (it != m_levelByPid.end()) ? it->second : 0;
+}
+
+void MLFQScheduler::forgetLevel(int pid) {
+    m_levelByPid.erase(pid);
+    m_metrics.queueLevel.erase(pid);
+}
+
+void MLFQScheduler::boostIfDue() {
+    if (m_boostInterval == 0) return;
+    uint64_t now = *m_clockRef;
+    auto& top = m_levels.front();
+    if (now < m_lastBoost) {
+        // The clock went back (simulation reset): count the interval again from the
+        // new time and drop the levels earned in the previous run
+        m_lastBoost = now;
+        for (size_t level = 1; level < m_levels.size(); ++level) {
+            top.splice(top.end(), m_levels[level]);
+        }
+        m_levelByPid.clear();
+        m_metrics.queueLevel.clear();
+        for (const auto& pair : m_handles) m_metrics.queueLevel[pair.first] = 0;
+        m_readyVersion++;
+        return;
+    }
+    if (now < m_lastBoost + m_boostInterval) return;
+    m_lastBoost = now;
+
+    // Move every ready process to level 0, keeping their relative order
+    for (size_t level = 1; level < m_levels.size(); ++level) {
+        top.splice(top.end(), m_levels[level]);  // Handles stay valid
+    }
+    // Running and blocked processes are reset too: their next slice starts on top
+    for (auto& pair : m_levelByPid) {
+        pair.second = 0;
+        m_metrics.queueLevel[pair.first] = 0;
+    }
+    m_metrics.priorityBoosts++;
+    m_readyVersion++;
+    WAOS_TRACE("MLFQ", BOOST, -1, static_cast<int64_t>(now));
+}
+
+}
@@ -0,0 +1,138 @@
+#include "waos/scheduler/PredictiveSJFScheduler.h"
+#include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace waos::scheduler {
+
+PredictiveSJFScheduler::PredictiveSJFScheduler(double alpha, double initialTau)
+    : m_alpha(alpha), m_initialTau(initialTau) {
+    if (!(alpha >= 0.0 && alpha <= 1.0)) throw std::invalid_argument("Alpha must be in [0, 1]");
+    if (!(initialTau >= 0.0)) throw std::invalid_argument("Initial tau cannot be negative");
+    m_metrics.totalSchedulingDecisions = 0;
+}
+
+void PredictiveSJFScheduler::addProcess(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    double tau = predictionFor(p->getPid());
+    m_readyHeap.push(p, toHeapKey(tau));
+    m_readyVersion++;
+
+    WAOS_TRACE("SJF-P", ENQUEUE, p->getPid(), toHeapKey(tau));
+}
+
+waos::core::Process* PredictiveSJFScheduler::getNextProcess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_readyHeap.empty()) return nullptr;
+
+    waos::core::Process* p = m_readyHeap.pop();
+    m_readyVersion++;
+
+    m_metrics.totalSchedulingDecisions++;
+    m_metrics.selectionCount[p->getPid()]++;
+
+    WAOS_TRACE("SJF-P", DISPATCH, p->getPid(), toHeapKey(predictionFor(p->getPid())));
+    return p;
+}
+
+bool PredictiveSJFScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_readyHeap.remove(pid)) return false;
+    m_readyVersion++;
+    return true;
+}
+
+bool PredictiveSJFScheduler::updateKey(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    waos::core::Process* p = m_readyHeap.find(pid);
+    if (!p) return false;
+    // The prediction only changes on burst completion, but keep the heap consistent with it
+    m_readyHeap.updateKey(pid, toHeapKey(predictionFor(pid)));
+    m_readyVersion++;
+    return true;
+}
+
+bool PredictiveSJFScheduler::hasReadyProcesses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_readyHeap.empty();
+}
+
+size_t PredictiveSJFScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.size();
+}
+
+int PredictiveSJFScheduler::getTimeSlice() const {
+    return -1; // Non-preemptive
+}
+
+void PredictiveSJFScheduler::onBurstCompleted(waos::core::Process* p, int cpuTicks) {
+    if (!p || cpuTicks < 0) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int pid = p->getPid();
+    double tau = predictionFor(pid);
+    double error = static_cast<double>(cpuTicks) - tau;
+
+    m_absoluteErrorSum += std::abs(error);
+    m_signedErrorSum += error;
+    m_metrics.predictedBursts++;
+    m_metrics.meanAbsolutePredictionError = m_absoluteErrorSum / m_metrics.predictedBursts;
+    m_metrics.meanPredictionBias = m_signedErrorSum / m_metrics.predictedBursts;
+
+    double next = m_alpha * cpuTicks + (1.0 - m_alpha) * tau;
+    m_predictions[pid] = next;
+    m_metrics.predictedBurst[pid] = next;
+}
+
+std::vector<const waos::core::Process*> PredictiveSJFScheduler::peekReadyQueue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.sorted();
+}
+
+void PredictiveSJFScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const waos::core::Process* p : m_readyHeap.sorted()) visit(p);
+}
+
+uint64_t PredictiveSJFScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
+}
+
+std::string PredictiveSJFScheduler::getAlgorithmName() const {
+    return "SJF (Predictive - Exponential Average)";
+}
+
+waos::common::SchedulerMetrics PredictiveSJFScheduler::getSchedulerMetrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_metrics;
+}
+
+double PredictiveSJFScheduler::getPrediction(int pid) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return predictionFor(pid);
+}
+
+double PredictiveSJFScheduler::getAlpha() const {
+    return m_alpha;
+}
+
+double PredictiveSJFScheduler::getInitialTau() const {
+    return m_initialTau;
+}
+
+double PredictiveSJFScheduler::predictionFor(int pid) const {
+    auto it = m_predictions.find(pid);
+    return (it != m_predictions.end()) ? it->second : m_initialTau;
+}
+
+IndexedProcessHeap::Key PredictiveSJFScheduler::toHeapKey(double tau) {
+    // Fixed point keeps fractional predictions ordered in the integer heap
+    return std::llround(tau * 1000.0);
+}
+
+}
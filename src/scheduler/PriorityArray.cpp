@@ -0,0 +1,224 @@
+#include "waos/scheduler/PriorityArray.h"
+#include "waos/core/Process.h"
+#include <algorithm>
+
+namespace waos::scheduler {
+
+int PriorityArray::countTrailingZeros(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+PriorityArray::PriorityArray() {
+    clear();
+}
+
+void PriorityArray::push(waos::core::Process* p, int priority) {
+    if (!p) return;
+    remove(p->getPid());  // A process is queued at most once
+    m_size++;
+
+    if (priority < 0 || priority >= LEVELS) {
+        m_overflow[priority].push_back(p);
+        m_overflowPriority[p->getPid()] = priority;
+        return;
+    }
+
+    int32_t link = allocLink(p);
+    linkBefore(link, priority);  // Before the sentinel = at the tail
+    setBit(priority);
+    m_linkByPid[p->getPid()] = link;
+}
+
+waos::core::Process* PriorityArray::pop() {
+    if (m_size == 0) return nullptr;
+
+    // Negative priorities outrank the array; the rest of the overflow ranks behind it
+    int first = firstLevel();
+    auto overflow = m_overflow.begin();
+    if (overflow != m_overflow.end() && (overflow->first < 0 || first < 0)) {
+        waos::core::Process* p = overflow->second.front();
+        overflow->second.pop_front();
+        if (overflow->second.empty()) m_overflow.erase(overflow);
+        m_overflowPriority.erase(p->getPid());
+        m_size--;
+        return p;
+    }
+
+    int32_t link = m_links[first].next;
+    waos::core::Process* p = m_links[link].process;
+    unlink(link);
+    m_linkByPid.erase(p->getPid());
+    m_size--;
+    return p;
+}
+
+bool PriorityArray::remove(int pid) {
+    auto it = m_linkByPid.find(pid);
+    if (it != m_linkByPid.end()) {
+        unlink(it->second);
+        m_linkByPid.erase(it);
+        m_size--;
+        return true;
+    }
+
+    auto overflowIt = m_overflowPriority.find(pid);
+    if (overflowIt == m_overflowPriority.end()) return false;
+
+    auto queue = m_overflow.find(overflowIt->second);
+    auto& list = queue->second;
+    list.erase(std::find_if(list.begin(), list.end(),
+                            [pid](const waos::core::Process* p) { return p->getPid() == pid; }));
+    if (list.empty()) m_overflow.erase(queue);
+    m_overflowPriority.erase(overflowIt);
+    m_size--;
+    return true;
+}
+
+bool PriorityArray::setPriority(int pid, int priority) {
+    waos::core::Process* p = find(pid);
+    if (!p) return false;
+    push(p, priority);
+    return true;
+}
+
+void PriorityArray::promote(int steps) {
+    if (steps <= 0 || m_size == 0) return;
+
+    // Ascending order: a target level has always been emptied before it receives
+    for (size_t word = 0; word < WORDS; ++word) {
+        for (uint64_t bits = m_bitmap[word]; bits; bits &= bits - 1) {
+            int level = static_cast<int>(word * 64) + countTrailingZeros(bits);
+            if (level > 0) splice(level, std::max(level - steps, 0));
+        }
+    }
+
+    // Overflow entries above the array move down, possibly into it
+    std::map<int, std::deque<waos::core::Process*>> above;
+    for (auto it = m_overflow.lower_bound(LEVELS); it != m_overflow.end();) {
+        above.emplace(it->first, std::move(it->second));
+        it = m_overflow.erase(it);
+    }
+    for (auto& pair : above) {
+        for (waos::core::Process* p : pair.second) {
+            m_overflowPriority.erase(p->getPid());
+            m_size--;
+            push(p, pair.first - steps);
+        }
+    }
+}
+
+waos::core::Process* PriorityArray::find(int pid) const {
+    auto link = m_linkByPid.find(pid);
+    if (link != m_linkByPid.end()) return m_links[link->second].process;
+
+    auto overflowIt = m_overflowPriority.find(pid);
+    if (overflowIt == m_overflowPriority.end()) return nullptr;
+    for (waos::core::Process* p : m_overflow.at(overflowIt->second)) {
+        if (p->getPid() == pid) return p;
+    }
+    return nullptr;
+}
+
+bool PriorityArray::contains(int pid) const {
+    return m_linkByPid.count(pid) > 0 || m_overflowPriority.count(pid) > 0;
+}
+
+bool PriorityArray::empty() const {
+    return m_size == 0;
+}
+
+size_t PriorityArray::size() const {
+    return m_size;
+}
+
+std::vector<const waos::core::Process*> PriorityArray::ordered() const {
+    std::vector<const waos::core::Process*> result;
+    result.reserve(m_size);
+    forEach([&result](const waos::core::Process* p) { result.push_back(p); });
+    return result;
+}
+
+void PriorityArray::clear() {
+    m_bitmap.fill(0);
+    m_links.clear();
+    for (int32_t level = 0; level < LEVELS; ++level) m_links.push_back({nullptr, level, level});
+    m_freeLinks.clear();
+    m_linkByPid.clear();
+    m_overflow.clear();
+    m_overflowPriority.clear();
+    m_size = 0;
+}
+
+int PriorityArray::firstLevel() const {
+    for (size_t word = 0; word < WORDS; ++word) {
+        if (m_bitmap[word]) return static_cast<int>(word * 64) + countTrailingZeros(m_bitmap[word]);
+    }
+    return -1;
+}
+
+int32_t PriorityArray::allocLink(waos::core::Process* p) {
+    if (!m_freeLinks.empty()) {
+        int32_t link = m_freeLinks.back();
+        m_freeLinks.pop_back();
+        m_links[link].process = p;
+        return link;
+    }
+    m_links.push_back({p, -1, -1});
+    return static_cast<int32_t>(m_links.size() - 1);
+}
+
+void PriorityArray::linkBefore(int32_t link, int32_t position) {
+    int32_t prev = m_links[position].prev;
+    m_links[link].prev = prev;
+    m_links[link].next = position;
+    m_links[prev].next = link;
+    m_links[position].prev = link;
+}
+
+void PriorityArray::unlink(int32_t link) {
+    int32_t prev = m_links[link].prev;
+    int32_t next = m_links[link].next;
+    m_links[prev].next = next;
+    m_links[next].prev = prev;
+
+    // Neighbours are the same sentinel only when its list just became empty
+    if (prev == next && prev < LEVELS) clearBit(prev);
+    m_freeLinks.push_back(link);
+}
+
+void PriorityArray::splice(int from, int to) {
+    if (from == to) return;
+    int32_t first = m_links[from].next;
+    int32_t last = m_links[from].prev;
+    if (first == from) return;
+
+    int32_t tail = m_links[to].prev;
+    m_links[tail].next = first;
+    m_links[first].prev = tail;
+    m_links[last].next = to;
+    m_links[to].prev = last;
+
+    m_links[from].next = from;
+    m_links[from].prev = from;
+    clearBit(from);
+    setBit(to);
+}
+
+void PriorityArray::setBit(int level) {
+    m_bitmap[level / 64] |= uint64_t(1) << (level % 64);
+}
+
+void PriorityArray::clearBit(int level) {
+    m_bitmap[level / 64] &= ~(uint64_t(1) << (level % 64));
+}
+
+}
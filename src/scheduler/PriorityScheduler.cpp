@@ -1,87 +1,187 @@
 #include "waos/scheduler/PriorityScheduler.h"
 
-#include <iostream>
+#include <algorithm>
+#include <stdexcept>
 
 #include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
 
 namespace waos::scheduler {
 
-PriorityScheduler::PriorityScheduler() {
+PriorityScheduler::PriorityScheduler(const uint64_t* clockRef, uint64_t agingInterval, uint64_t starvationThreshold)
+    : m_clockRef(clockRef), m_agingInterval(agingInterval), m_starvationThreshold(starvationThreshold) {
+  if (m_agingInterval > 0 && !m_clockRef) throw std::invalid_argument("Priority aging requires a clock");
+  m_agingEpoch = currentEpoch();
   m_metrics.totalSchedulingDecisions = 0;
 }
 
 void PriorityScheduler::addProcess(waos::core::Process* p) {
   if (!p) return;
   std::lock_guard<std::mutex> lock(m_mutex);
+  applyAging();
+
+  // Aging counts from the moment the process became ready
+  uint64_t readySince = m_clockRef ? p->getStats().lastReadyTime : 0;
+  Entry entry{p->getPriority(), m_agingInterval ? readySince / m_agingInterval : 0};
+  entry.epoch = std::min(entry.epoch, m_agingEpoch);
+  m_entries[p->getPid()] = entry;
+
+  int priority = effectivePriority(entry);
+  m_queues.push(p, priority);
+  m_readyVersion++;
+  WAOS_TRACE("Priority", ENQUEUE, p->getPid(), priority);
+}
 
-  // Currently Process has no priority getter
-  int priority = p->getPriority();
+waos::core::Process* PriorityScheduler::getNextProcess() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  applyAging();
+
+  // Highest non-empty level via find-first-set on the bitmap
+  waos::core::Process* p = m_queues.pop();
+  if (!p) return nullptr;
+  m_readyVersion++;
+
+  auto entry = m_entries.find(p->getPid());
+  int priority = (entry != m_entries.end()) ? effectivePriority(entry->second) : p->getPriority();
+  if (entry != m_entries.end()) m_entries.erase(entry);
+
+  m_metrics.totalSchedulingDecisions++;
+  m_metrics.selectionCount[p->getPid()]++;
+  if (m_clockRef) {
+    uint64_t lastReady = p->getStats().lastReadyTime;
+    uint64_t wait = (*m_clockRef > lastReady) ? *m_clockRef - lastReady : 0;
+    m_metrics.maxReadyWait = std::max(m_metrics.maxReadyWait, wait);
+    if (m_starvationThreshold > 0 && wait >= m_starvationThreshold) m_metrics.starvedDispatches++;
+  }
 
-  m_queues[priority].push_back(p);
-  std::cout << "  [Priority] Added P" << p->getPid() << " (Prio " << priority << ") to ready queue" << std::endl;
+  WAOS_TRACE("Priority", DISPATCH, p->getPid(), priority);
+  return p;
 }
 
-waos::core::Process* PriorityScheduler::getNextProcess() {
+bool PriorityScheduler::removeProcess(int pid) {
   std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_queues.remove(pid)) return false;
+  m_entries.erase(pid);
+  m_readyVersion++;
+  return true;
+}
 
-  // Iterate from highest priority (lowest key)
-  for (auto it = m_queues.begin(); it != m_queues.end();) {
-    auto& q = it->second;
-    if (!q.empty()) {
-      waos::core::Process* p = q.front();
-      q.pop_front();
-
-      // If queue becomes empty, we can remove the key from map to keep it clean
-      if (q.empty()) {
-        m_queues.erase(it);
-      }
-
-      m_metrics.totalSchedulingDecisions++;
-      m_metrics.selectionCount[p->getPid()]++;
-
-      std::cout << "  [Priority] Selected P" << p->getPid()
-                << " (Prio " << p->getPriority() << ") for execution" << std::endl;
-      return p;
-    } else {
-      // Empty queue in map, remove it and continue
-      it = m_queues.erase(it);
-    }
+bool PriorityScheduler::updateKey(int pid) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  waos::core::Process* p = m_queues.find(pid);
+  if (!p) return false;
+  applyAging();
+
+  // The time already waited keeps counting; only the base priority changes
+  Entry& entry = m_entries[pid];
+  int previous = effectivePriority(entry);
+  entry.basePriority = p->getPriority();
+  int priority = effectivePriority(entry);
+
+  // Re-prioritised processes go to the tail of their new level, as a fresh enqueue would
+  if (priority != previous) {
+    m_queues.setPriority(pid, priority);
+    m_readyVersion++;
   }
-  return nullptr;
+  return true;
+}
+
+bool PriorityScheduler::shouldPreempt(const waos::core::Process* running,
+                                      const waos::core::Process* candidate) const {
+  if (!running || !candidate) return false;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto entry = m_entries.find(candidate->getPid());
+  int priority = (entry != m_entries.end()) ? effectivePriority(entry->second) : candidate->getPriority();
+
+  // The running process does not age: it competes with its base priority
+  return priority < running->getPriority();
 }
 
 bool PriorityScheduler::hasReadyProcesses() const {
   std::lock_guard<std::mutex> lock(m_mutex);
-  for (const auto& kv : m_queues) {
-    if (!kv.second.empty()) return true;
-  }
-  return false;
+  return !m_queues.empty();
+}
+
+size_t PriorityScheduler::getReadyCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queues.size();
 }
 
 int PriorityScheduler::getTimeSlice() const {
-  return -1;  // Non-preemptive priority by default
+  return -1;  // No timer preemption; READY transitions preempt through shouldPreempt()
 }
 
 std::vector<const waos::core::Process*> PriorityScheduler::peekReadyQueue() const {
   std::lock_guard<std::mutex> lock(m_mutex);
-  std::vector<const waos::core::Process*> result;
+  return m_queues.ordered();
+}
 
-  for (const auto& kv : m_queues) {
-    const auto& q = kv.second;
-    for (const auto* p : q) {
-      result.push_back(p);
-    }
-  }
-  return result;
+void PriorityScheduler::forEachReady(const ReadyVisitor& visit) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_queues.forEach(visit);
+}
+
+uint64_t PriorityScheduler::getReadyQueueVersion() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_readyVersion;
 }
 
 std::string PriorityScheduler::getAlgorithmName() const {
-  return "Priority Scheduling";
+  if (m_agingInterval == 0) return "Priority Scheduling";
+  return "Priority Scheduling (aging=" + std::to_string(m_agingInterval) + ")";
 }
 
 waos::common::SchedulerMetrics PriorityScheduler::getSchedulerMetrics() const {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_metrics;
+  waos::common::SchedulerMetrics metrics = m_metrics;
+
+  // Snapshot of the ready queue: O(n), only when metrics are requested
+  m_queues.forEach([&](const waos::core::Process* p) {
+    auto entry = m_entries.find(p->getPid());
+    if (entry != m_entries.end()) metrics.effectivePriority[p->getPid()] = effectivePriority(entry->second);
+    if (m_clockRef && m_starvationThreshold > 0) {
+      uint64_t lastReady = p->getStats().lastReadyTime;
+      if (*m_clockRef >= lastReady + m_starvationThreshold) metrics.starvingProcesses++;
+    }
+  });
+  return metrics;
+}
+
+int PriorityScheduler::getEffectivePriority(int pid) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto entry = m_entries.find(pid);
+  return (entry != m_entries.end()) ? effectivePriority(entry->second) : 0;
+}
+
+uint64_t PriorityScheduler::currentEpoch() const {
+  return (m_agingInterval > 0) ? *m_clockRef / m_agingInterval : 0;
+}
+
+int PriorityScheduler::effectivePriority(const Entry& e) const {
+  if (e.basePriority < 0) return e.basePriority;  // Already above every aged level
+  uint64_t waited = m_agingEpoch - e.epoch;       // Epochs already applied to the queue
+  return static_cast<int>(std::max<int64_t>(int64_t(e.basePriority) - int64_t(waited), 0));
+}
+
+void PriorityScheduler::applyAging() {
+  if (m_agingInterval == 0) return;
+  uint64_t epoch = currentEpoch();
+  if (epoch < m_agingEpoch) {
+    // The clock went back (simulation reset): count epochs again from the new time
+    m_agingEpoch = epoch;
+    for (auto& pair : m_entries) pair.second.epoch = std::min(pair.second.epoch, epoch);
+    return;
+  }
+  if (epoch == m_agingEpoch) return;
+
+  // Every level rises together, so one splice per occupied level is enough
+  uint64_t steps = epoch - m_agingEpoch;
+  m_agingEpoch = epoch;
+  m_metrics.agingEpochs += static_cast<int>(steps);
+  if (m_queues.empty()) return;
+
+  m_queues.promote(static_cast<int>(std::min<uint64_t>(steps, uint64_t(1) << 30)));
+  m_readyVersion++;
 }
 
 }  // namespace waos::scheduler
@@ -1,9 +1,8 @@
 #include "waos/scheduler/RRScheduler.h"
 
-#include <iostream>
-
 #include "waos/core/Process.h"
-#include <iostream>
+#include "waos/core/TraceBuffer.h"
+
 namespace waos::scheduler {
 
 RRScheduler::RRScheduler(int quantum) : m_quantum(quantum) {
@@ -14,8 +13,9 @@ RRScheduler::RRScheduler(int quantum) : m_quantum(quantum) {
 void RRScheduler::addProcess(waos::core::Process* p) {
   if (!p) return;
   std::lock_guard<std::mutex> lock(m_mutex);
-  m_queue.push(p);
-  std::cout << "  [RR] Added P" << p->getPid() << " to ready queue (FIFO order)" << std::endl;
+  m_handles[p->getPid()] = m_queue.insert(m_queue.end(), p);
+  m_readyVersion++;
+  WAOS_TRACE("RR", ENQUEUE, p->getPid());
 }
 
 waos::core::Process* RRScheduler::getNextProcess() {
@@ -23,37 +23,63 @@ waos::core::Process* RRScheduler::getNextProcess() {
   if (m_queue.empty()) return nullptr;
 
   waos::core::Process* p = m_queue.front();
-  m_queue.pop();
+  m_queue.pop_front();
+  m_handles.erase(p->getPid());
+  m_readyVersion++;
 
   // Update metrics
   m_metrics.totalSchedulingDecisions++;
   m_metrics.selectionCount[p->getPid()]++;
 
-  std::cout << "  [RR] Selected P" << p->getPid() << " for execution (Quantum="
-            << m_quantum << " ticks)" << std::endl;
+  WAOS_TRACE("RR", DISPATCH, p->getPid(), m_quantum);
 
   return p;
 }
 
+bool RRScheduler::removeProcess(int pid) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto handle = m_handles.find(pid);
+  if (handle == m_handles.end()) return false;
+
+  m_queue.erase(handle->second);
+  m_handles.erase(handle);
+  m_readyVersion++;
+  return true;
+}
+
+bool RRScheduler::updateKey(int pid) {
+  // Arrival order is the only key: nothing to reposition
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_handles.count(pid) > 0;
+}
+
 bool RRScheduler::hasReadyProcesses() const {
   std::lock_guard<std::mutex> lock(m_mutex);
   return !m_queue.empty();
 }
 
+size_t RRScheduler::getReadyCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queue.size();
+}
+
 int RRScheduler::getTimeSlice() const {
   return m_quantum;
 }
 
 std::vector<const waos::core::Process*> RRScheduler::peekReadyQueue() const {
   std::lock_guard<std::mutex> lock(m_mutex);
-  std::vector<const waos::core::Process*> result;
-
-  std::queue<waos::core::Process*> temp = m_queue;
-  while (!temp.empty()) {
-    result.push_back(temp.front());
-    temp.pop();
-  }
-  return result;
+  return {m_queue.begin(), m_queue.end()};
+}
+
+void RRScheduler::forEachReady(const ReadyVisitor& visit) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const waos::core::Process* p : m_queue) visit(p);
+}
+
+uint64_t RRScheduler::getReadyQueueVersion() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_readyVersion;
 }
 
 std::string RRScheduler::getAlgorithmName() const {
@@ -0,0 +1,175 @@
+#include "waos/scheduler/RealTimeScheduler.h"
+#include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace waos::scheduler {
+
+namespace {
+
+constexpr IndexedProcessHeap::Key kNoDeadline = std::numeric_limits<IndexedProcessHeap::Key>::max();
+
+}  // namespace
+
+RealTimeScheduler::RealTimeScheduler(RealTimePolicy policy) : m_policy(policy) {
+    m_metrics.totalSchedulingDecisions = 0;
+}
+
+void RealTimeScheduler::addProcess(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto key = keyFor(p);
+    m_readyHeap.push(p, key);
+    m_readyVersion++;
+
+    WAOS_TRACE(m_policy == RealTimePolicy::EDF ? "EDF" : "RM", ENQUEUE, p->getPid(), key == kNoDeadline ? -1 : key);
+}
+
+waos::core::Process* RealTimeScheduler::getNextProcess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_readyHeap.empty()) return nullptr;
+
+    waos::core::Process* p = m_readyHeap.pop();
+    m_readyVersion++;
+    m_metrics.totalSchedulingDecisions++;
+    m_metrics.selectionCount[p->getPid()]++;
+
+    WAOS_TRACE(m_policy == RealTimePolicy::EDF ? "EDF" : "RM", DISPATCH, p->getPid());
+    return p;
+}
+
+bool RealTimeScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_readyHeap.remove(pid)) return false;
+    m_readyVersion++;
+    return true;
+}
+
+bool RealTimeScheduler::updateKey(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    waos::core::Process* p = m_readyHeap.find(pid);
+    if (!p) return false;
+    m_readyHeap.updateKey(pid, keyFor(p));
+    m_readyVersion++;
+    return true;
+}
+
+bool RealTimeScheduler::hasReadyProcesses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_readyHeap.empty();
+}
+
+size_t RealTimeScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.size();
+}
+
+int RealTimeScheduler::getTimeSlice() const {
+    return -1;  // Preemption only on releases, through shouldPreempt()
+}
+
+bool RealTimeScheduler::shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const {
+    (void)candidate;  // The heap top is the most urgent ready job
+    if (!running) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_readyHeap.empty()) return false;
+    return m_readyHeap.topKey() < keyFor(running);
+}
+
+std::vector<const waos::core::Process*> RealTimeScheduler::peekReadyQueue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.sorted();
+}
+
+void RealTimeScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const waos::core::Process* p : m_readyHeap.sorted()) visit(p);
+}
+
+uint64_t RealTimeScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
+}
+
+std::string RealTimeScheduler::getAlgorithmName() const {
+    if (m_policy == RealTimePolicy::EDF) return "EDF (Earliest Deadline First)";
+    return "RM (Rate Monotonic)";
+}
+
+waos::common::SchedulerMetrics RealTimeScheduler::getSchedulerMetrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_metrics;
+}
+
+RealTimePolicy RealTimeScheduler::getPolicy() const {
+    return m_policy;
+}
+
+IndexedProcessHeap::Key RealTimeScheduler::keyFor(const waos::core::Process* p) const {
+    if (m_policy == RealTimePolicy::EDF) {
+        return p->hasDeadline() ? static_cast<IndexedProcessHeap::Key>(p->getAbsoluteDeadline()) : kNoDeadline;
+    }
+    if (p->getPeriod() > 0) return static_cast<IndexedProcessHeap::Key>(p->getPeriod());
+    if (p->hasDeadline()) return static_cast<IndexedProcessHeap::Key>(p->getRelativeDeadline());
+    return kNoDeadline;
+}
+
+SchedulabilityReport RealTimeScheduler::analyze(RealTimePolicy policy, const std::vector<RealTimeTask>& tasks) {
+    SchedulabilityReport report;
+    double density = 0.0;
+    for (const auto& task : tasks) {
+        if (task.period == 0 || task.cost == 0) throw std::invalid_argument("Tasks need a positive cost and period");
+        uint64_t deadline = task.deadline ? std::min(task.deadline, task.period) : task.period;
+        report.utilization += double(task.cost) / task.period;
+        density += double(task.cost) / deadline;
+    }
+
+    if (policy == RealTimePolicy::EDF) {
+        report.bound = 1.0;
+        report.schedulable = density <= 1.0;
+        return report;
+    }
+
+    const double n = static_cast<double>(tasks.size());
+    report.bound = tasks.empty() ? 1.0 : n * (std::pow(2.0, 1.0 / n) - 1.0);
+
+    // Rate-monotonic priority order: shortest period first (stable for ties)
+    std::vector<size_t> order(tasks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return tasks[a].period < tasks[b].period; });
+
+    report.schedulable = true;
+    report.responseTimes.assign(tasks.size(), 0);
+    for (size_t rank = 0; rank < order.size(); ++rank) {
+        const RealTimeTask& task = tasks[order[rank]];
+        uint64_t deadline = task.deadline ? std::min(task.deadline, task.period) : task.period;
+
+        // Fixed-point iteration; stops as soon as the response exceeds the deadline
+        uint64_t response = task.cost;
+        while (true) {
+            uint64_t next = task.cost;
+            for (size_t higher = 0; higher < rank; ++higher) {
+                const RealTimeTask& hp = tasks[order[higher]];
+                next += ((response + hp.period - 1) / hp.period) * hp.cost;
+            }
+            if (next == response || next > deadline) {
+                response = next;
+                break;
+            }
+            response = next;
+        }
+
+        report.responseTimes[order[rank]] = response;
+        if (response > deadline) report.schedulable = false;
+    }
+    return report;
+}
+
+}
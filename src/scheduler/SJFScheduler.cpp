@@ -1,18 +1,10 @@
 #include "waos/scheduler/SJFScheduler.h"
 #include "waos/core/Process.h"
-#include <iostream>
+#include "waos/core/TraceBuffer.h"
 
 namespace waos::scheduler {
 
-// Comparator implementation: returns true if 'a' has LOWER priority than 'b'
-// (priority_queue is a max-heap by default, so we invert to get min-heap behavior)
-bool SJFScheduler::ProcessComparator::operator()(waos::core::Process* a, waos::core::Process* b) const {
-    // Return true if 'a' should come AFTER 'b' in the queue (a has longer burst)
-    // This makes processes with SHORTER bursts have HIGHER priority
-    return a->getCurrentBurstDuration() > b->getCurrentBurstDuration();
-}
-
-SJFScheduler::SJFScheduler() {
+SJFScheduler::SJFScheduler(bool preemptive) : m_preemptive(preemptive) {
     m_metrics.totalSchedulingDecisions = 0;
 }
 
@@ -20,57 +12,88 @@ void SJFScheduler::addProcess(waos::core::Process* p) {
     if (!p) return;
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    // O(log n) insertion into priority queue (min-heap by burst duration)
-    m_priorityQueue.push(p);
-    
-    std::cout << "  [SJF] Added P" << p->getPid() 
-              << " (burst=" << p->getCurrentBurstDuration() << ") to ready queue" << std::endl;
+    // O(log n) insertion into min-heap by (remaining) burst duration
+    int burst = p->getCurrentBurstDuration();
+    m_readyHeap.push(p, burst);
+    m_readyVersion++;
+
+    WAOS_TRACE("SJF", ENQUEUE, p->getPid(), burst);
 }
 
 
 waos::core::Process* SJFScheduler::getNextProcess() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_priorityQueue.empty()) return nullptr;
+    if (m_readyHeap.empty()) return nullptr;
 
     // O(log n) extraction of process with minimum burst duration
-    waos::core::Process* p = m_priorityQueue.top();
-    m_priorityQueue.pop();
+    auto burst = m_readyHeap.topKey();
+    waos::core::Process* p = m_readyHeap.pop();
+    m_readyVersion++;
 
     m_metrics.totalSchedulingDecisions++;
     m_metrics.selectionCount[p->getPid()]++;
 
-    std::cout << "  [SJF] Selected P" << p->getPid() 
-              << " for execution (shortest burst=" << p->getCurrentBurstDuration() << ")" << std::endl;
+    WAOS_TRACE("SJF", DISPATCH, p->getPid(), burst);
     return p;
 }
 
+bool SJFScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_readyHeap.remove(pid)) return false;
+    m_readyVersion++;
+    return true;
+}
+
+bool SJFScheduler::updateKey(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    waos::core::Process* p = m_readyHeap.find(pid);
+    if (!p) return false;
+    m_readyHeap.updateKey(pid, p->getCurrentBurstDuration());
+    m_readyVersion++;
+    return true;
+}
+
 bool SJFScheduler::hasReadyProcesses() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return !m_priorityQueue.empty();
+    return !m_readyHeap.empty();
+}
+
+size_t SJFScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.size();
 }
 
 int SJFScheduler::getTimeSlice() const {
-    return -1; // Non-preemptive by time (Preemptive version is SRTF, distinct usually)
+    return -1; // No timer preemption; SRTF preempts through shouldPreempt()
+}
+
+bool SJFScheduler::shouldPreempt(const waos::core::Process* running, const waos::core::Process* candidate) const {
+    (void)candidate;  // The heap top is the shortest ready job, whoever just arrived
+    if (!m_preemptive || !running) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_readyHeap.empty()) return false;
+    return m_readyHeap.topKey() < running->getCurrentBurstDuration();
 }
 
 std::vector<const waos::core::Process*> SJFScheduler::peekReadyQueue() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    
-    // Copy priority queue to vector for observation
-    // Note: This requires extracting all elements - O(n log n) operation
-    // This is acceptable since peekReadyQueue is used infrequently (only for debugging/monitoring)
-    auto temp_pq = m_priorityQueue;
-    std::vector<const waos::core::Process*> result;
-    
-    while (!temp_pq.empty()) {
-        result.push_back(temp_pq.top());
-        temp_pq.pop();
-    }
-    
-    return result;
+    // Cached ordered view: re-sorted only after the heap changes
+    return m_readyHeap.sorted();
+}
+
+void SJFScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const waos::core::Process* p : m_readyHeap.sorted()) visit(p);
+}
+
+uint64_t SJFScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
 }
 
 std::string SJFScheduler::getAlgorithmName() const {
+    if (m_preemptive) return "SRTF (Shortest Remaining Time First)";
     return "SJF (Shortest Job First - Priority Queue)";
 }
 
@@ -79,4 +102,8 @@ waos::common::SchedulerMetrics SJFScheduler::getSchedulerMetrics() const {
     return m_metrics;
 }
 
+bool SJFScheduler::isPreemptive() const {
+    return m_preemptive;
+}
+
 }
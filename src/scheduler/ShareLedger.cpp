@@ -0,0 +1,35 @@
+#include "waos/scheduler/ShareLedger.h"
+#include "waos/core/Process.h"
+
+namespace waos::scheduler {
+
+uint64_t ShareLedger::record(const waos::core::Process* p) {
+    Account& account = m_accounts[p->getPid()];
+
+    int tickets = p->getTickets();
+    m_totalTickets += tickets;
+    m_totalTickets -= account.tickets;
+    account.tickets = tickets;
+
+    uint64_t cpu = p->getStats().totalCpuTime;
+    uint64_t delta = (cpu > account.cpuTicks) ? cpu - account.cpuTicks : 0;
+    account.cpuTicks += delta;
+    m_totalCpu += delta;
+    return delta;
+}
+
+void ShareLedger::fill(waos::common::SchedulerMetrics& metrics) const {
+    for (const auto& [pid, account] : m_accounts) {
+        metrics.tickets[pid] = account.tickets;
+        metrics.entitledShare[pid] = m_totalTickets ? double(account.tickets) / m_totalTickets : 0.0;
+        metrics.achievedShare[pid] = m_totalCpu ? double(account.cpuTicks) / m_totalCpu : 0.0;
+    }
+}
+
+void ShareLedger::clear() {
+    m_accounts.clear();
+    m_totalTickets = 0;
+    m_totalCpu = 0;
+}
+
+}
@@ -0,0 +1,123 @@
+#include "waos/scheduler/StrideScheduler.h"
+#include "waos/core/Process.h"
+#include "waos/core/TraceBuffer.h"
+#include <algorithm>
+
+namespace waos::scheduler {
+
+StrideScheduler::StrideScheduler(int quantum) : m_quantum(quantum) {
+    if (m_quantum <= 0) m_quantum = 2;  // Fallback seguro
+    m_metrics.totalSchedulingDecisions = 0;
+}
+
+void StrideScheduler::addProcess(waos::core::Process* p) {
+    if (!p) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int pid = p->getPid();
+    uint64_t ran = m_ledger.record(p);
+    int64_t stride = STRIDE1 / p->getTickets();
+
+    auto inserted = m_pass.emplace(pid, m_globalPass);
+    int64_t& pass = inserted.first->second;
+    pass = std::max(pass + stride * static_cast<int64_t>(ran), m_globalPass);
+    m_strides[pid] = stride;
+    m_readyHeap.push(p, pass);
+    m_readyVersion++;
+
+    WAOS_TRACE("Stride", ENQUEUE, pid, pass);
+}
+
+waos::core::Process* StrideScheduler::getNextProcess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_readyHeap.empty()) return nullptr;
+
+    m_globalPass = std::max(m_globalPass, m_readyHeap.topKey());
+    waos::core::Process* p = m_readyHeap.pop();
+    m_readyVersion++;
+
+    m_metrics.totalSchedulingDecisions++;
+    m_metrics.selectionCount[p->getPid()]++;
+
+    WAOS_TRACE("Stride", DISPATCH, p->getPid());
+    return p;
+}
+
+bool StrideScheduler::removeProcess(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_readyHeap.remove(pid)) return false;
+    m_readyVersion++;
+    return true;
+}
+
+bool StrideScheduler::updateKey(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    waos::core::Process* p = m_readyHeap.find(pid);
+    if (!p) return false;
+
+    // Scale the pass still ahead of the global pass to the new stride
+    int64_t oldStride = m_strides[pid];
+    int64_t newStride = STRIDE1 / p->getTickets();
+    int64_t& pass = m_pass[pid];
+    int64_t remaining = std::max<int64_t>(pass - m_globalPass, 0);
+    pass = m_globalPass + remaining * newStride / oldStride;
+    m_strides[pid] = newStride;
+
+    m_readyHeap.updateKey(pid, pass);
+    m_readyVersion++;
+    return true;
+}
+
+void StrideScheduler::onProcessTerminated(int pid) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pass.erase(pid);
+    m_strides.erase(pid);
+}
+
+bool StrideScheduler::hasReadyProcesses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_readyHeap.empty();
+}
+
+size_t StrideScheduler::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.size();
+}
+
+int StrideScheduler::getTimeSlice() const {
+    return m_quantum;
+}
+
+std::vector<const waos::core::Process*> StrideScheduler::peekReadyQueue() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyHeap.sorted();
+}
+
+void StrideScheduler::forEachReady(const ReadyVisitor& visit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const waos::core::Process* p : m_readyHeap.sorted()) visit(p);
+}
+
+uint64_t StrideScheduler::getReadyQueueVersion() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readyVersion;
+}
+
+std::string StrideScheduler::getAlgorithmName() const {
+    return "Stride (Q=" + std::to_string(m_quantum) + ")";
+}
+
+waos::common::SchedulerMetrics StrideScheduler::getSchedulerMetrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    waos::common::SchedulerMetrics metrics = m_metrics;
+    m_ledger.fill(metrics);
+    return metrics;
+}
+
+int64_t StrideScheduler::getPass(int pid) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_pass.find(pid);
+    return (it != m_pass.end()) ? it->second : 0;
+}
+
+}
@@ -0,0 +1,49 @@
+/**
+ * @brief Minimal policy plugin used by test_PolicyRegistry: a LIFO scheduler.
+ * @details Built with waos_add_policy_plugin(); shows the entry point an
+ *          in-house policy library has to export.
+ */
+
+#include <memory>
+#include <vector>
+#include "waos/core/PolicyRegistry.h"
+#include "waos/core/Process.h"
+
+namespace {
+
+class LifoScheduler : public waos::scheduler::IScheduler {
+ public:
+  explicit LifoScheduler(int quantum) : m_quantum(quantum) {}
+
+  void addProcess(waos::core::Process* p) override { m_stack.push_back(p); }
+
+  waos::core::Process* getNextProcess() override {
+    if (m_stack.empty()) return nullptr;
+    waos::core::Process* p = m_stack.back();
+    m_stack.pop_back();
+    return p;
+  }
+
+  bool hasReadyProcesses() const override { return !m_stack.empty(); }
+  int getTimeSlice() const override { return m_quantum; }
+
+  std::vector<const waos::core::Process*> peekReadyQueue() const override {
+    return {m_stack.rbegin(), m_stack.rend()};
+  }
+
+  std::string getAlgorithmName() const override { return "LIFO (plugin)"; }
+  waos::common::SchedulerMetrics getSchedulerMetrics() const override { return {}; }
+
+ private:
+  int m_quantum;
+  std::vector<waos::core::Process*> m_stack;
+};
+
+}  // namespace
+
+extern "C" void waosRegisterPlugin(waos::core::PolicyRegistry& registry) {
+  registry.registerScheduler({"LIFO", "Last-In, First-Out (sample plugin)", {{"quantum", "Time slice", 3, 1, 50}}},
+                             [](const waos::core::PolicyArguments& args) {
+                               return std::make_unique<LifoScheduler>(args.get("quantum"));
+                             });
+}
@@ -0,0 +1,99 @@
+/**
+ * @brief Unit tests for the Chrome trace-event exporter.
+ */
+
+#include "waos/core/ChromeTraceWriter.h"
+#include "waos/core/Simulator.h"
+#include "tests/core/CoreMocks.h"
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace waos::core;
+
+bool contains(const std::string& text, const std::string& fragment) {
+  return text.find(fragment) != std::string::npos;
+}
+
+void test_spans_and_counters() {
+  std::cout << "[RUNNING] test_spans_and_counters..." << std::endl;
+  std::ostringstream out;
+  {
+    ChromeTraceWriter writer(out, 1);
+
+    // P7: READY 0..3, RUNNING 3..5, then terminated
+    writer.processState(7, ProcessState::READY, 0);
+    writer.processState(7, ProcessState::READY, 1);  // No change, no event
+    writer.processState(7, ProcessState::RUNNING, 3);
+    writer.processState(7, ProcessState::TERMINATED, 5);
+
+    // CPU: idle 0..3, P7 3..5; consecutive equal ticks merge
+    for (uint64_t t = 0; t < 3; ++t) writer.cpuActivity(CpuActivity::IDLE, -1, t);
+    for (uint64_t t = 3; t < 5; ++t) writer.cpuActivity(CpuActivity::BUSY, 7, t);
+
+    // Counters are written only when they change
+    writer.counters(0, 1, 0, 0, 0);
+    writer.counters(1, 1, 0, 0, 0);
+    writer.counters(3, 0, 0, 0, 2);
+    writer.finish(5);
+    writer.finish(9);  // Ignored
+    assert(writer.finished());
+  }
+
+  std::string trace = out.str();
+  assert(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+  assert(trace.substr(trace.size() - 3) == "]}\n");
+  assert(contains(trace, "\"args\":{\"name\":\"P7\"}"));
+  assert(contains(trace, "{\"name\":\"READY\",\"ph\":\"X\",\"ts\":0,\"dur\":3,\"pid\":1,\"tid\":7}"));
+  assert(contains(trace, "{\"name\":\"RUNNING\",\"ph\":\"X\",\"ts\":3,\"dur\":2,\"pid\":1,\"tid\":7}"));
+  assert(contains(trace, "{\"name\":\"idle\",\"ph\":\"X\",\"ts\":0,\"dur\":3,\"pid\":0,\"tid\":0}"));
+  assert(contains(trace, "{\"name\":\"P7\",\"ph\":\"X\",\"ts\":3,\"dur\":2,\"pid\":0,\"tid\":0}"));
+  assert(contains(trace, "{\"name\":\"ready\",\"ph\":\"C\",\"ts\":3,\"pid\":0,\"args\":{\"value\":0}}"));
+  assert(!contains(trace, "\"ts\":1,\"pid\":0"));  // Unchanged counters at tick 1
+  assert(contains(trace, "{\"name\":\"used_frames\",\"ph\":\"C\",\"ts\":3,\"pid\":0,\"args\":{\"value\":2}}"));
+
+  std::cout << "[PASSED] test_spans_and_counters" << std::endl;
+}
+
+void test_simulator_export() {
+  std::cout << "[RUNNING] test_simulator_export..." << std::endl;
+  std::string fname = "test_chrome_trace.txt";
+  {
+    std::ofstream out(fname);
+    out << "P1 0 CPU(2) 1 1\n"
+           "P2 0 CPU(2) 1 1\n";
+  }
+
+  std::ostringstream out;
+  Simulator sim;
+  sim.loadProcesses(fname);
+  auto mem = std::make_unique<MockMemoryManager>();
+  mem->everythingLoaded = true;
+  sim.setScheduler(std::make_unique<MockScheduler>());
+  sim.setMemoryManager(std::move(mem));
+  sim.setTraceWriter(std::make_unique<ChromeTraceWriter>(out, 1));
+  sim.start();
+
+  int maxTicks = 20;
+  while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+
+  // Finished with the run: P1 runs 0..2 while P2 waits, then P2 runs 2..4
+  assert(sim.getTraceWriter()->finished());
+  std::string trace = out.str();
+  assert(contains(trace, "{\"name\":\"RUNNING\",\"ph\":\"X\",\"ts\":0,\"dur\":2,\"pid\":1,\"tid\":1}"));
+  assert(contains(trace, "{\"name\":\"READY\",\"ph\":\"X\",\"ts\":0,\"dur\":2,\"pid\":1,\"tid\":2}"));
+  assert(contains(trace, "{\"name\":\"RUNNING\",\"ph\":\"X\",\"ts\":2,\"dur\":2,\"pid\":1,\"tid\":2}"));
+  assert(contains(trace, "\"name\":\"ready\",\"ph\":\"C\",\"ts\":0,\"pid\":0,\"args\":{\"value\":1}"));
+  assert(trace.substr(trace.size() - 3) == "]}\n");
+
+  std::cout << "[PASSED] test_simulator_export" << std::endl;
+  std::remove(fname.c_str());
+}
+
+int main() {
+  test_spans_and_counters();
+  test_simulator_export();
+  std::cout << "\nAll trace export tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @brief Unit tests for the binary event log, its reader and the replay cursor.
+ */
+
+#include "waos/core/EventLog.h"
+#include "waos/core/Simulator.h"
+#include "tests/core/CoreMocks.h"
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+using namespace waos::core;
+
+// Pages fault until completePageLoad() marks them loaded
+class LoadingMemoryManager : public MockMemoryManager {
+ public:
+  PageRequestResult requestPage(int pid, waos::common::PageNumber page, bool isWrite = false) override {
+    requestCount++;
+    return isPageLoaded(pid, page) ? PageRequestResult::HIT : PageRequestResult::PAGE_FAULT;
+  }
+};
+
+EventRecord makeRecord(uint64_t tick, int pid, ProcessState from, ProcessState to, TransitionCause cause) {
+  return {tick, pid, from, to, cause, waos::common::NO_PAGE, -1};
+}
+
+size_t fileSize(const std::string& path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  return static_cast<size_t>(in.tellg());
+}
+
+void test_round_trip(bool mapped) {
+  std::cout << "[RUNNING] test_round_trip(" << (mapped ? "mapped" : "buffered") << ")..." << std::endl;
+  std::string path = "test_event_log.bin";
+  {
+    EventLogOptions options;
+    options.bufferRecords = 2;  // Forces several writes / mapping growths
+    options.memoryMapped = mapped;
+    EventLogWriter writer(path, options);
+#ifndef _WIN32
+    assert(writer.memoryMapped() == mapped);
+#endif
+
+    writer.append(makeRecord(0, 1, ProcessState::NEW, ProcessState::READY, TransitionCause::ARRIVAL));
+    writer.append(makeRecord(0, 1, ProcessState::READY, ProcessState::RUNNING, TransitionCause::DISPATCH));
+    writer.append({3, 1, ProcessState::RUNNING, ProcessState::WAITING_MEMORY, TransitionCause::PAGE_FAULT, 4, -1});
+    writer.append({8, 1, ProcessState::WAITING_MEMORY, ProcessState::READY, TransitionCause::PAGE_LOADED, 4, 2});
+    writer.append(makeRecord(9, 1, ProcessState::RUNNING, ProcessState::TERMINATED, TransitionCause::EXIT));
+    writer.close();
+    writer.append(makeRecord(10, 2, ProcessState::NEW, ProcessState::READY, TransitionCause::ARRIVAL));  // Ignored
+    assert(writer.recordCount() == 5);
+  }
+
+  assert(fileSize(path) == 32 + 5 * 32);  // Mapped logs are trimmed on close
+  EventLogReader reader(path);
+  assert(reader.complete());
+  assert(reader.size() == 5);
+  const EventRecord& loaded = reader.at(3);
+  assert(loaded.tick == 8 && loaded.pid == 1);
+  assert(loaded.oldState == ProcessState::WAITING_MEMORY && loaded.newState == ProcessState::READY);
+  assert(loaded.cause == TransitionCause::PAGE_LOADED && loaded.page == 4 && loaded.frame == 2);
+  assert(reader.at(0).page == waos::common::NO_PAGE);
+  assert(reader.lastTick() == 9);
+  assert(reader.lowerBound(0) == 0 && reader.lowerBound(1) == 2 && reader.lowerBound(9) == 4);
+  assert(reader.lowerBound(10) == 5);
+
+  std::remove(path.c_str());
+  std::cout << "[PASSED] test_round_trip" << std::endl;
+}
+
+void test_unclosed_log_is_readable() {
+  std::cout << "[RUNNING] test_unclosed_log_is_readable..." << std::endl;
+  std::string path = "test_event_log_open.bin";
+  for (bool mapped : {false, true}) {
+    EventLogOptions options;
+    options.bufferRecords = 8;
+    options.memoryMapped = mapped;
+    EventLogWriter writer(path, options);
+    for (uint64_t t = 0; t < 3; ++t) {
+      writer.append(makeRecord(t, 1, ProcessState::READY, ProcessState::RUNNING, TransitionCause::DISPATCH));
+    }
+    writer.flush();
+
+    // As after a crash: no record count in the header, zeroed tail in the mapped case
+    EventLogReader reader(path);
+    assert(!reader.complete());
+    assert(reader.size() == 3);
+    assert(reader.at(2).tick == 2);
+  }
+  std::remove(path.c_str());
+
+  bool threw = false;
+  try {
+    EventLogReader reader("missing_event_log.bin");
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  assert(threw);
+  std::cout << "[PASSED] test_unclosed_log_is_readable" << std::endl;
+}
+
+void test_replay_matches_simulator() {
+  std::cout << "[RUNNING] test_replay_matches_simulator..." << std::endl;
+  std::string fname = "test_event_log_procs.txt";
+  std::string logPath = "test_event_log_run.bin";
+  {
+    std::ofstream out(fname);
+    out << "P1 0 CPU(3),E/S(2),CPU(1) 1 2\n"
+           "P2 1 CPU(2) 1 1\n"
+           "P3 2 CPU(1),E/S(1),CPU(2) 1 1\n";
+  }
+
+  // What the GUI reads from the engine when each tick starts
+  struct Snapshot {
+    int running;
+    bool switching;
+    std::vector<int> blocked;
+    std::vector<int> waitingMemory;
+    int loadingRemaining;  // Ticks left for the page being loaded (head of the queue)
+    std::map<int, ProcessState> states;
+  };
+  std::map<uint64_t, Snapshot> live;
+
+  {
+    Simulator sim;
+    sim.loadProcesses(fname);
+    sim.setScheduler(std::make_unique<MockScheduler>());
+    sim.setMemoryManager(std::make_unique<LoadingMemoryManager>());
+    sim.setEventLog(std::make_unique<EventLogWriter>(logPath));
+
+    // Nothing changes between steps, so the state before tick() is what clockTicked observers see
+    auto snapshot = [&]() {
+      Snapshot snapshot;
+      const Process* running = sim.getRunningProcess();
+      snapshot.running = running ? running->getPid() : -1;
+      snapshot.switching = sim.isContextSwitching();
+      for (const auto* p : sim.getBlockedProcesses()) snapshot.blocked.push_back(p->getPid());
+      auto waits = sim.getMemoryWaitQueue();
+      for (const auto& wait : waits) snapshot.waitingMemory.push_back(wait.pid);
+      snapshot.loadingRemaining = waits.empty() ? 0 : waits.front().ticksRemaining;
+      for (const auto* p : sim.getAllProcesses()) snapshot.states[p->getPid()] = p->getState();
+      live[sim.getCurrentTime()] = snapshot;
+    };
+
+    sim.start();
+    int maxTicks = 200;
+    while (sim.isRunning() && maxTicks-- > 0) {
+      snapshot();
+      sim.tick();
+    }
+    assert(!sim.isRunning());
+    sim.reset();  // Closes the log
+  }
+
+  EventLogReader reader(logPath);
+  assert(reader.complete());
+
+  bool sawFault = false, sawSwitch = false;
+  for (const auto& record : reader.records()) {
+    sawFault = sawFault || record.cause == TransitionCause::PAGE_FAULT;
+    sawSwitch = sawSwitch || record.cause == TransitionCause::SWITCH_BEGIN;
+  }
+  assert(sawFault && sawSwitch);
+
+  EventLogReplay replay(reader);
+  for (const auto& [tick, snapshot] : live) {
+    replay.seek(tick);
+    assert(replay.runningPid() == snapshot.running);
+    assert(replay.isContextSwitching() == snapshot.switching);
+    assert(replay.blockedPids() == snapshot.blocked);
+
+    auto waits = replay.memoryWaits();
+    std::vector<int> waiting;
+    for (const auto& wait : waits) waiting.push_back(wait.pid);
+    assert(waiting == snapshot.waitingMemory);
+    if (!waits.empty()) assert(waits.front().ticksRemaining == snapshot.loadingRemaining);
+
+    for (const auto& [pid, state] : snapshot.states) assert(replay.stateOf(pid) == state);
+  }
+  replay.seek(reader.lastTick() + 1);
+  assert(replay.atEnd());
+  assert(replay.completedProcesses() == 3);
+
+  // Seeking backwards replays from the start
+  replay.seek(0);
+  assert(replay.arrivedProcesses() == 0 && replay.runningPid() == -1);
+
+  std::remove(fname.c_str());
+  std::remove(logPath.c_str());
+  std::cout << "[PASSED] test_replay_matches_simulator" << std::endl;
+}
+
+int main() {
+  test_round_trip(false);
+  test_round_trip(true);
+  test_unclosed_log_is_readable();
+  test_replay_matches_simulator();
+  std::cout << "All EventLog tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @brief Unit tests for latency histograms and the distribution metrics of the simulator.
+ */
+
+#include "waos/core/LatencyHistogram.h"
+#include "waos/core/Simulator.h"
+#include "tests/core/CoreMocks.h"
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+using namespace waos::core;
+
+void test_exact_small_values() {
+  std::cout << "[RUNNING] test_exact_small_values..." << std::endl;
+  LatencyHistogram histogram;
+  assert(histogram.valueAtPercentile(50) == 0);  // Empty
+
+  // 1..50: exact buckets, nearest-rank percentiles
+  for (uint64_t v = 1; v <= 50; ++v) histogram.record(v);
+  assert(histogram.count() == 50);
+  assert(histogram.min() == 1 && histogram.max() == 50);
+  assert(std::abs(histogram.mean() - 25.5) < 1e-9);
+  assert(histogram.valueAtPercentile(50) == 25);
+  assert(histogram.valueAtPercentile(95) == 48);
+  assert(histogram.valueAtPercentile(99) == 50);
+  assert(histogram.valueAtPercentile(0) == 1);
+  assert(histogram.valueAtPercentile(250) == 50);  // Clamped
+
+  histogram.clear();
+  assert(histogram.count() == 0 && histogram.max() == 0);
+  assert(histogram.valueAtPercentile(99) == 0);
+
+  std::cout << "[PASSED] test_exact_small_values" << std::endl;
+}
+
+void test_relative_error_bound() {
+  std::cout << "[RUNNING] test_relative_error_bound..." << std::endl;
+
+  // A tail sample per magnitude up to 2^62: the reported value never understates it and stays within 1/32
+  for (int shift = 6; shift < 63; ++shift) {
+    for (uint64_t offset : {uint64_t(0), uint64_t(1), (uint64_t(1) << shift) / 3}) {
+      LatencyHistogram histogram;
+      uint64_t value = (uint64_t(1) << shift) + offset;
+      histogram.record(1);
+      histogram.record(value);
+      histogram.record(value + (value >> 4));  // Larger max, so the cap does not hide the bucket bound
+      uint64_t p50 = histogram.valueAtPercentile(50);
+      assert(p50 >= value);
+      assert(static_cast<double>(p50 - value) <= static_cast<double>(value) / 32.0);
+    }
+  }
+
+  LatencyHistogram top;
+  top.record(UINT64_MAX);
+  assert(top.valueAtPercentile(99) == UINT64_MAX);
+
+  std::cout << "[PASSED] test_relative_error_bound" << std::endl;
+}
+
+void test_simulator_distribution() {
+  std::cout << "[RUNNING] test_simulator_distribution..." << std::endl;
+  std::string fname = "test_latency.txt";
+  {
+    std::ofstream out(fname);
+    out << "P1 0 CPU(2) 1 1\n"
+           "P2 0 CPU(2) 1 1\n"
+           "P3 0 CPU(2) 1 1\n";
+  }
+
+  Simulator sim;
+  sim.loadProcesses(fname);
+  auto mem = std::make_unique<MockMemoryManager>();
+  mem->everythingLoaded = true;
+  sim.setScheduler(std::make_unique<MockScheduler>());
+  sim.setMemoryManager(std::move(mem));
+  sim.start();
+
+  int maxTicks = 30;
+  while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+  auto metrics = sim.getSimulatorMetrics();
+  assert(metrics.completedProcesses == 3);
+
+  // FIFO back to back: responses 0, 2, 4 (P1 starts at tick 0), turnarounds 2, 4, 6
+  assert(metrics.responseLatency.count == 3);
+  assert(metrics.responseLatency.min == 0 && metrics.responseLatency.p50 == 2);
+  assert(metrics.responseLatency.p99 == 4);
+  assert(metrics.turnaroundLatency.p50 == 4 && metrics.turnaroundLatency.max == 6);
+  assert(std::abs(metrics.turnaroundLatency.mean - metrics.avgTurnaroundTime) < 1e-9);
+  assert(metrics.waitLatency.p95 == 4);
+
+  // Shares 2/2, 2/4, 2/6: (11/6)^2 / (3 * 49/36) = 121/147
+  assert(std::abs(metrics.fairnessIndex - 121.0 / 147.0) < 1e-9);
+  assert(std::abs(metrics.throughput - 3.0 / metrics.currentTick) < 1e-9);
+
+  sim.loadProcesses(fname);
+  metrics = sim.getSimulatorMetrics();
+  assert(metrics.responseLatency.count == 0 && metrics.fairnessIndex == 0.0);
+
+  std::cout << "[PASSED] test_simulator_distribution" << std::endl;
+  std::remove(fname.c_str());
+}
+
+int main() {
+  test_exact_small_values();
+  test_relative_error_bound();
+  test_simulator_distribution();
+  std::cout << "\nAll latency histogram tests passed!" << std::endl;
+  return 0;
+}
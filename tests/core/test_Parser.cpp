@@ -124,6 +124,86 @@ void test_robustness_invalid_lines() {
   removeTestFile(filename);
 }
 
+// Test Case 4: Shared regions and SHM/COW mappings
+void test_shared_region_mappings() {
+  std::cout << "[RUNNING] test_shared_region_mappings..." << std::endl;
+
+  std::string content =
+    "REGION libc 3\n"
+    "P1 0 CPU(4) 1 8 SHM(libc@2)\n"
+    "P2 0 CPU(4) 1 8 COW(libc@0) SHM(nope@0)\n"
+    "P3 0 CPU(4) 1 2 SHM(libc@1)\n";
+
+  std::string filename = "test_4.txt";
+  createTestFile(filename, content);
+
+  auto processes = Parser::parseFile(filename);
+  assert(processes.size() == 3);
+
+  assert(processes[0].sharedMappings.size() == 1);
+  assert(processes[0].sharedMappings[0].regionId == 0);
+  assert(processes[0].sharedMappings[0].firstPage == 2);
+  assert(processes[0].sharedMappings[0].pageCount == 3);
+  assert(!processes[0].sharedMappings[0].copyOnWrite);
+
+  // Unknown region is ignored, valid COW mapping kept
+  assert(processes[1].sharedMappings.size() == 1);
+  assert(processes[1].sharedMappings[0].copyOnWrite);
+
+  // Mapping past requiredPages is ignored
+  assert(processes[2].sharedMappings.empty());
+
+  std::cout << "[PASSED] test_shared_region_mappings" << std::endl;
+  removeTestFile(filename);
+}
+
+void test_ticket_column() {
+  std::cout << "[RUNNING] test_ticket_column..." << std::endl;
+
+  std::string content =
+    "P1 0 CPU(4) 1 2 TICKETS(300)\n"
+    "P2 0 CPU(4) 1 2\n"
+    "P3 0 CPU(4) 1 2 TICKETS(0)\n";
+
+  std::string filename = "test_5.txt";
+  createTestFile(filename, content);
+
+  auto processes = Parser::parseFile(filename);
+  assert(processes.size() == 3);
+  assert(processes[0].tickets == 300);
+  assert(processes[1].tickets == 0);  // Derived from priority later
+  assert(processes[2].tickets == 0);  // Invalid count ignored
+
+  std::cout << "[PASSED] test_ticket_column" << std::endl;
+  removeTestFile(filename);
+}
+
+void test_real_time_columns() {
+  std::cout << "[RUNNING] test_real_time_columns..." << std::endl;
+
+  std::string content =
+    "P1 0 CPU(2) 1 1 PERIOD(5) JOBS(4)\n"
+    "P2 0 CPU(2) 1 1 PERIOD(8) DEADLINE(6)\n"
+    "P3 0 CPU(2) 1 1 DEADLINE(10) JOBS(3)\n"
+    "P4 0 CPU(2) 1 1 PERIOD(x)\n";
+
+  std::string filename = "test_6.txt";
+  createTestFile(filename, content);
+
+  auto processes = Parser::parseFile(filename);
+  assert(processes.size() == 4);
+
+  // Implicit deadline equals the period
+  assert(processes[0].period == 5 && processes[0].deadline == 5 && processes[0].jobs == 4);
+  assert(processes[1].period == 8 && processes[1].deadline == 6 && processes[1].jobs == 1);
+  // Aperiodic job with a deadline: JOBS needs a PERIOD
+  assert(processes[2].period == 0 && processes[2].deadline == 10 && processes[2].jobs == 1);
+  assert(processes[3].period == 0 && processes[3].deadline == 0);
+
+  std::cout << "[PASSED] test_real_time_columns" << std::endl;
+  removeTestFile(filename);
+}
+
 int main() {
   std::cout << "> Starting Parser Tests" << std::endl;
   
@@ -132,6 +212,12 @@ int main() {
   test_multiple_processes_and_comments();
   std::cout << std::endl;
   test_robustness_invalid_lines();
+  std::cout << std::endl;
+  test_shared_region_mappings();
+  std::cout << std::endl;
+  test_ticket_column();
+  std::cout << std::endl;
+  test_real_time_columns();
 
   std::cout << "< All Parser Tests Passed" << std::endl;
   return 0;
@@ -0,0 +1,112 @@
+/**
+ * @brief Unit tests for the per-phase profiler of Simulator::step.
+ */
+
+#include "waos/core/PhaseProfiler.h"
+#include "waos/core/Simulator.h"
+#include "tests/core/CoreMocks.h"
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace waos::core;
+
+void test_aggregation() {
+  std::cout << "[RUNNING] test_aggregation..." << std::endl;
+  PhaseProfiler::reset();
+  PhaseProfiler::record(ProfilePhase::IO, 30);
+  PhaseProfiler::record(ProfilePhase::IO, 10);
+  PhaseProfiler::record(ProfilePhase::IO, 20);
+
+  PhaseStats io = PhaseProfiler::stats(ProfilePhase::IO);
+  assert(io.calls == 3 && io.totalNs == 60);
+  assert(io.minNs == 10 && io.maxNs == 30);
+  assert(io.meanNs() == 20.0);
+  assert(PhaseProfiler::stats(ProfilePhase::METRICS).calls == 0);
+  assert(PhaseProfiler::stats(ProfilePhase::METRICS).minNs == 0);
+
+  std::ostringstream out;
+  PhaseProfiler::dump(out);
+  assert(out.str().find("io") != std::string::npos);
+  assert(out.str().find("metrics") == std::string::npos);  // Phases never called are skipped
+
+  PhaseProfiler::reset();
+  assert(PhaseProfiler::stats(ProfilePhase::IO).calls == 0);
+
+  std::cout << "[PASSED] test_aggregation" << std::endl;
+}
+
+void test_scope_gate() {
+  std::cout << "[RUNNING] test_scope_gate..." << std::endl;
+  PhaseProfiler::reset();
+  PhaseProfiler::setEnabled(false);
+  { WAOS_PROFILE_SCOPE(SCHEDULING); }
+  assert(PhaseProfiler::stats(ProfilePhase::SCHEDULING).calls == 0);
+
+  PhaseProfiler::setEnabled(true);
+  { WAOS_PROFILE_SCOPE(SCHEDULING); }
+  int value = WAOS_PROFILE_CALL(SCHEDULER_CALL, 6 * 7);
+  assert(value == 42);
+#if WAOS_PROFILE_ENABLED
+  assert(PhaseProfiler::stats(ProfilePhase::SCHEDULING).calls == 1);
+  assert(PhaseProfiler::stats(ProfilePhase::SCHEDULER_CALL).calls == 1);
+#endif
+  PhaseProfiler::setEnabled(false);
+
+  std::cout << "[PASSED] test_scope_gate" << std::endl;
+}
+
+void test_simulator_phases() {
+  std::cout << "[RUNNING] test_simulator_phases..." << std::endl;
+  std::string fname = "test_profiler.txt";
+  {
+    std::ofstream out(fname);
+    out << "P1 0 CPU(3) 1 1\n"
+           "P2 1 CPU(2) 1 1\n";
+  }
+
+  Simulator sim;
+  sim.loadProcesses(fname);
+  auto mem = std::make_unique<MockMemoryManager>();
+  mem->everythingLoaded = true;
+  sim.setScheduler(std::make_unique<MockScheduler>());
+  sim.setMemoryManager(std::move(mem));
+  sim.start();
+
+  PhaseProfiler::reset();
+  PhaseProfiler::setEnabled(true);
+  uint64_t ticks = 0;
+  while (sim.isRunning() && ticks < 20) {
+    sim.tick();
+    ticks++;
+  }
+  PhaseProfiler::setEnabled(false);
+
+#if WAOS_PROFILE_ENABLED
+  // Every fixed phase runs once per step; the policy calls were timed too
+  PhaseStats step = PhaseProfiler::stats(ProfilePhase::STEP);
+  assert(step.calls == ticks);
+  for (ProfilePhase phase : {ProfilePhase::IO, ProfilePhase::PAGE_FAULTS, ProfilePhase::ARRIVALS, ProfilePhase::METRICS}) {
+    PhaseStats stats = PhaseProfiler::stats(phase);
+    assert(stats.calls == ticks);
+    assert(stats.totalNs <= step.totalNs);  // Inclusive totals
+    assert(stats.minNs <= stats.maxNs);
+  }
+  assert(PhaseProfiler::stats(ProfilePhase::CPU_EXECUTION).calls > 0);
+  assert(PhaseProfiler::stats(ProfilePhase::SCHEDULER_CALL).calls >= 4);  // 2 adds, 2 dispatches at least
+  assert(PhaseProfiler::stats(ProfilePhase::MEMORY_CALL).calls > 0);
+#endif
+  PhaseProfiler::reset();
+
+  std::cout << "[PASSED] test_simulator_phases" << std::endl;
+  std::remove(fname.c_str());
+}
+
+int main() {
+  test_aggregation();
+  test_scope_gate();
+  test_simulator_phases();
+  std::cout << "\nAll profiler tests passed!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @brief Unit tests for the policy registry: built-ins, parameter schema and plugin loading.
+ */
+
+#include "waos/core/PolicyRegistry.h"
+#include "waos/core/Process.h"
+#include "waos/memory/BuiltinMemoryManagers.h"
+#include "waos/scheduler/BuiltinSchedulers.h"
+#include "waos/scheduler/FCFSScheduler.h"
+#include <cassert>
+#include <iostream>
+#include <queue>
+#include <stdexcept>
+
+using namespace waos::core;
+
+#ifndef WAOS_SAMPLE_PLUGIN
+#define WAOS_SAMPLE_PLUGIN "plugins/waos_sample_policy.so"
+#endif
+
+void test_builtin_policies() {
+  std::cout << "[RUNNING] test_builtin_policies..." << std::endl;
+  PolicyRegistry registry;
+  waos::scheduler::registerBuiltinSchedulers(registry);
+  waos::memory::registerBuiltinMemoryManagers(registry);
+
+  uint64_t clock = 0;
+  PolicyArguments args;
+  args.clockRef = &clock;
+  args.values["quantum"] = 4;
+  args.values["frames"] = 8;
+
+  // Every registered name builds a policy; quantum reaches the ones that declare it
+  assert(registry.schedulers().size() == 13);
+  assert(registry.schedulers().front().name == "FCFS");
+  for (const auto& descriptor : registry.schedulers()) {
+    auto scheduler = registry.createScheduler(descriptor.name, args);
+    assert(scheduler);
+  }
+  assert(registry.createScheduler("Round Robin", args)->getTimeSlice() == 4);
+  assert(registry.createScheduler("Priority + Aging", args)->getAlgorithmName() == "Priority Scheduling (aging=10)");
+
+  assert(registry.memoryManagers().size() == 3);
+  auto lru = registry.createMemoryManager("LRU", args);
+  assert(lru->getFrameStatus().size() == 8);
+
+  // Compressed pool and page table shape reach the memory managers
+  PolicyArguments paging = args;
+  paging.values["compressedPoolPercent"] = 25;
+  paging.values["pageTableLevels"] = 2;
+  paging.values["bitsPerLevel"] = 4;
+  paging.values["walkCostPerLevel"] = 3;
+  auto fifo = registry.createMemoryManager("FIFO", paging);
+  assert(fifo->getMemoryStats().compressedPoolFrames == 2 && fifo->getFrameStatus().size() == 6);
+  fifo->allocateForProcess(1, 16);
+  assert(fifo->requestPage(1, 5) == waos::memory::PageRequestResult::PAGE_FAULT);
+  fifo->completePageLoad(1, 5);
+  assert(fifo->requestPage(1, 5) == waos::memory::PageRequestResult::HIT);
+  assert(fifo->getLastWalkCost() == 2 * 3);
+  assert(fifo->getMaxPages() == 256);  // 2 levels x 4 bits
+
+  paging.values["invertedPageTable"] = 1;
+  auto inverted = registry.createMemoryManager("Optimal", paging);
+  inverted->allocateForProcess(1, 16);
+  inverted->allocateForProcess(2, 16);
+  assert(inverted->getMemoryStats().pageTableNodes == 1);  // One table for every process
+  assert(inverted->getMaxPages() == UINT64_MAX);
+
+  bool threw = false;
+  paging.values["pageTableLevels"] = 6;
+  paging.values["bitsPerLevel"] = 9;  // 54 bits of page number
+  paging.values["invertedPageTable"] = 0;
+  try {
+    registry.createMemoryManager("LRU", paging);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "[PASSED] test_builtin_policies" << std::endl;
+}
+
+void test_parameter_schema() {
+  std::cout << "[RUNNING] test_parameter_schema..." << std::endl;
+  PolicyRegistry registry;
+  int seen = -1;
+  registry.registerScheduler({"Probe", "Records its quantum", {{"quantum", "Time slice", 7, 1, 10}}},
+                             [&seen](const PolicyArguments& args) {
+                               seen = args.get("quantum");
+                               return std::make_unique<waos::scheduler::FCFSScheduler>();
+                             });
+
+  // Missing parameters take the default; out-of-range values are rejected before the factory runs
+  assert(registry.createScheduler("Probe", PolicyArguments()) && seen == 7);
+
+  seen = -1;
+  bool threw = false;
+  PolicyArguments tooBig;
+  tooBig.values["quantum"] = 11;
+  try {
+    registry.createScheduler("Probe", tooBig);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw && seen == -1);
+
+  threw = false;
+  try {
+    registry.createMemoryManager("Missing", PolicyArguments());
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+  assert(!registry.hasScheduler("Missing") && registry.hasScheduler("Probe"));
+
+  std::cout << "[PASSED] test_parameter_schema" << std::endl;
+}
+
+void test_plugin_loading() {
+  std::cout << "[RUNNING] test_plugin_loading..." << std::endl;
+  PolicyRegistry registry;
+  waos::scheduler::registerBuiltinSchedulers(registry);
+
+  assert(!registry.loadPlugin("does-not-exist.so"));
+  assert(!registry.lastPluginError().empty());
+  assert(registry.loadPluginDirectory("does-not-exist") == 0);
+
+  assert(registry.loadPlugin(WAOS_SAMPLE_PLUGIN));
+  assert(registry.hasScheduler("LIFO"));
+  assert(registry.schedulers().back().name == "LIFO");
+
+  // The plugin scheduler runs against processes built by the host
+  auto lifo = registry.createScheduler("LIFO", PolicyArguments());
+  assert(lifo->getTimeSlice() == 3);
+  std::queue<Burst> bursts;
+  bursts.push({BurstType::CPU, 1});
+  Process a(1, 0, 0, bursts, 1), b(2, 0, 0, bursts, 1);
+  lifo->addProcess(&a);
+  lifo->addProcess(&b);
+  assert(lifo->getNextProcess() == &b);
+  assert(lifo->getNextProcess() == &a);
+
+  std::cout << "[PASSED] test_plugin_loading" << std::endl;
+}
+
+int main() {
+  test_builtin_policies();
+  test_parameter_schema();
+  test_plugin_loading();
+  return 0;
+}
@@ -21,16 +21,15 @@ void test_reference_string_generation() {
   Process p(1, 0, 0, bursts, 5);
 
   // Validate initial instruction pointer behavior
-  int firstPage = p.getCurrentPageRequirement();
-  assert(firstPage >= 0 && firstPage < 5);
+  auto firstPage = p.getCurrentPageRequirement();
+  assert(firstPage < 5);
 
   // Validate consistency and range over execution
-  std::set<int> accessedPages;
+  std::set<waos::common::PageNumber> accessedPages;
   for (int i = 0; i < 100; ++i) {
-    int page = p.getCurrentPageRequirement();
+    auto page = p.getCurrentPageRequirement();
     
     // Check Range
-    assert(page >= 0);
     assert(page < 5); // Must be strictly less than requiredPages
 
     accessedPages.insert(page);
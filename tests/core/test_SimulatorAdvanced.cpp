@@ -71,6 +71,52 @@ void test_metrics_calculation() {
   std::remove(fname.c_str());
 }
 
+// TEST 1b: Métricas incrementales (acumuladas al terminar, promedios al leer)
+void test_incremental_metrics() {
+  std::cout << "[RUNNING] test_incremental_metrics..." << std::endl;
+  std::string fname = "test_incremental.txt";
+  createTempFile(fname,
+    "P1 0 CPU(2) 1 1\n"
+    "P2 0 CPU(2) 1 1\n"
+    "P3 0 CPU(2) 1 1\n"
+  );
+
+  Simulator sim;
+  sim.loadProcesses(fname);
+  auto mem = std::make_unique<MockMemoryManager>();
+  mem->everythingLoaded = true;
+  sim.setScheduler(std::make_unique<MockScheduler>());
+  sim.setMemoryManager(std::move(mem));
+  sim.start();
+
+  // T0..T2: P1 termina en t=2 (espera 0, retorno 2)
+  sim.tick();
+  sim.tick();
+  sim.tick();
+  auto metrics = sim.getSimulatorMetrics();
+  assert(metrics.completedProcesses == 1);
+  assert(std::abs(metrics.avgTurnaroundTime - 2.0) < 0.01);
+  assert(std::abs(metrics.avgWaitTime - 0.0) < 0.01);
+
+  int maxTicks = 20;
+  while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+  metrics = sim.getSimulatorMetrics();
+  assert(metrics.completedProcesses == 3);
+  assert(std::abs(metrics.avgTurnaroundTime - 4.0) < 0.01);  // (2 + 4 + 6) / 3
+  assert(std::abs(metrics.avgWaitTime - 2.0) < 0.01);        // (0 + 2 + 4) / 3
+
+  // Recargar descarta los acumulados de la corrida anterior
+  sim.loadProcesses(fname);
+  sim.start();
+  sim.tick();
+  metrics = sim.getSimulatorMetrics();
+  assert(metrics.completedProcesses == 0);
+  assert(metrics.avgTurnaroundTime == 0.0 && metrics.avgWaitTime == 0.0);
+
+  std::cout << "[PASSED] test_incremental_metrics" << std::endl;
+  std::remove(fname.c_str());
+}
+
 // TEST 2: Apropiación (Preemption) por Prioridad
 void test_preemption_logic() {
   std::cout << "[RUNNING] test_preemption_logic..." << std::endl;
@@ -86,7 +132,9 @@ void test_preemption_logic() {
   Simulator sim;
   sim.loadProcesses(fname);
 
+  // La decisión de apropiación la toma el planificador (shouldPreempt)
   auto sched = std::make_unique<MockScheduler>();
+  sched->preemptByPriority = true;
   auto mem = std::make_unique<MockMemoryManager>();
   mem->everythingLoaded = true;
 
@@ -212,6 +260,41 @@ void test_no_cs_overhead_on_termination() {
 }
 
 // TEST 5: Determinismo de Referencias de Memoria
+// Memory manager with a small virtual address space
+class BoundedMemoryManager : public MockMemoryManager {
+ public:
+  explicit BoundedMemoryManager(waos::common::PageNumber maxPages) : m_maxPages(maxPages) {}
+  waos::common::PageNumber getMaxPages() const override { return m_maxPages; }
+
+ private:
+  waos::common::PageNumber m_maxPages;
+};
+
+void test_address_space_overflow_rejected() {
+  std::cout << "[RUNNING] test_address_space_overflow_rejected..." << std::endl;
+  std::string fname = "test_address_space.txt";
+
+  Simulator sim;
+  sim.setScheduler(std::make_unique<MockScheduler>());
+  sim.setMemoryManager(std::make_unique<BoundedMemoryManager>(uint64_t(1) << 36));
+
+  // Used to abort the first tick from allocateForProcess()
+  createTempFile(fname, "P1 0 CPU(3) 1 100000000000\n");
+  assert(!sim.loadProcesses(fname));
+  assert(sim.getAllProcesses().empty());
+
+  createTempFile(fname, "P1 0 CPU(3) 1 1000\n");
+  assert(sim.loadProcesses(fname));
+
+  // A manager swapped in after loading is checked when the run starts
+  sim.setMemoryManager(std::make_unique<BoundedMemoryManager>(100));
+  sim.start();
+  assert(!sim.isRunning());
+
+  std::remove(fname.c_str());
+  std::cout << "[PASSED] test_address_space_overflow_rejected" << std::endl;
+}
+
 void test_memory_reference_determinism() {
   std::cout << "[RUNNING] test_memory_reference_determinism..." << std::endl;
 
@@ -252,6 +335,8 @@ void test_memory_reference_determinism() {
 
 int main() {
   test_metrics_calculation();
+  test_incremental_metrics();
+  test_address_space_overflow_rejected();
   test_preemption_logic();
   test_no_context_switch_overhead_on_start();
   test_no_cs_overhead_on_termination();
@@ -0,0 +1,181 @@
+/**
+ * @brief Unit tests for the columnar time-series recorder: downsampling, bounded storage and export.
+ */
+
+#include "waos/core/TimeSeriesRecorder.h"
+#include "waos/core/Simulator.h"
+#include "tests/core/CoreMocks.h"
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace waos::core;
+
+TickSample sampleAt(uint64_t tick, uint32_t ready, CpuActivity cpu = CpuActivity::BUSY) {
+  TickSample sample;
+  sample.tick = tick;
+  sample.ready = ready;
+  sample.cpu = cpu;
+  return sample;
+}
+
+void test_interval_reduction() {
+  std::cout << "[RUNNING] test_interval_reduction..." << std::endl;
+  TimeSeriesConfig config;
+  config.interval = 4;
+  config.reduction = GaugeReduction::MAX;
+  config.chunkRows = 2;  // Forces several chunks
+  TimeSeriesRecorder recorder(config);
+
+  // Ready lengths 0..9, one fault every tick; ticks 2 and 6 are context switches
+  for (uint64_t t = 0; t < 10; ++t) {
+    TickSample sample = sampleAt(t, static_cast<uint32_t>(t), (t % 4 == 2) ? CpuActivity::CONTEXT_SWITCH : CpuActivity::BUSY);
+    sample.pageFaults = 1;
+    recorder.record(sample);
+  }
+  assert(recorder.rowCount() == 2);  // Ticks 8..9 are still an open window
+  recorder.flush();
+  assert(recorder.rowCount() == 3);
+
+  assert(recorder.value(0, SeriesColumn::TICK) == 0);
+  assert(recorder.value(0, SeriesColumn::READY) == 3);  // Peak of 0..3
+  assert(recorder.value(1, SeriesColumn::TICK) == 4);
+  assert(recorder.value(1, SeriesColumn::CPU_SWITCH) == 1);
+  assert(recorder.value(1, SeriesColumn::CPU_BUSY) == 3);
+  assert(recorder.value(2, SeriesColumn::SPAN) == 2);
+  assert(recorder.value(2, SeriesColumn::PAGE_FAULTS) == 2);
+
+  bool threw = false;
+  try {
+    recorder.value(3, SeriesColumn::TICK);
+  } catch (const std::out_of_range&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "[PASSED] test_interval_reduction" << std::endl;
+}
+
+void test_bounded_rows() {
+  std::cout << "[RUNNING] test_bounded_rows..." << std::endl;
+  TimeSeriesConfig config;
+  config.maxRows = 4;
+  TimeSeriesRecorder recorder(config);
+
+  // 16 ticks into 4 rows: the store halves twice and each row ends up covering 4 ticks
+  uint64_t faults = 0;
+  for (uint64_t t = 0; t < 16; ++t) {
+    TickSample sample = sampleAt(t, static_cast<uint32_t>(t % 4 == 0 ? 8 : 0));
+    sample.pageFaults = static_cast<uint32_t>(t);
+    faults += t;
+    recorder.record(sample);
+  }
+  recorder.flush();
+
+  assert(recorder.interval() == 4);
+  assert(recorder.rowCount() == 4);
+  uint64_t spans = 0, summedFaults = 0;
+  for (size_t r = 0; r < recorder.rowCount(); ++r) {
+    assert(recorder.value(r, SeriesColumn::TICK) == r * 4);
+    assert(recorder.value(r, SeriesColumn::READY) == 2);  // Mean of 8, 0, 0, 0
+    spans += recorder.value(r, SeriesColumn::SPAN);
+    summedFaults += recorder.value(r, SeriesColumn::PAGE_FAULTS);
+  }
+  assert(spans == 16);
+  assert(summedFaults == faults);  // Counters survive merging exactly
+
+  bool threw = false;
+  try {
+    TimeSeriesConfig bad;
+    bad.maxRows = 1;
+    TimeSeriesRecorder invalid(bad);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "[PASSED] test_bounded_rows" << std::endl;
+}
+
+void test_export_round_trip() {
+  std::cout << "[RUNNING] test_export_round_trip..." << std::endl;
+  TimeSeriesRecorder recorder;
+  for (uint64_t t = 0; t < 3; ++t) recorder.record(sampleAt(t + (uint64_t(1) << 40), static_cast<uint32_t>(t), CpuActivity::IDLE));
+
+  std::ostringstream csv;
+  recorder.writeCsv(csv);
+  std::istringstream lines(csv.str());
+  std::string header, first;
+  std::getline(lines, header);
+  std::getline(lines, first);
+  assert(header == "tick,span,ready,blocked,memory_wait,used_frames,cpu_busy,cpu_idle,cpu_switch,page_faults,switches");
+  assert(first == "1099511627776,1,0,0,0,0,0,1,0,0,0");
+
+  std::stringstream binary;
+  recorder.writeBinary(binary);
+  auto rows = TimeSeriesRecorder::readBinary(binary);
+  assert(rows.size() == 3);
+  for (size_t r = 0; r < rows.size(); ++r) assert(rows[r] == recorder.row(r));
+
+  std::istringstream garbage("not a series");
+  bool threw = false;
+  try {
+    TimeSeriesRecorder::readBinary(garbage);
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "[PASSED] test_export_round_trip" << std::endl;
+}
+
+void test_simulator_sampling() {
+  std::cout << "[RUNNING] test_simulator_sampling..." << std::endl;
+  std::string fname = "test_timeseries.txt";
+  {
+    std::ofstream out(fname);
+    out << "P1 0 CPU(2) 1 1\n"
+           "P2 0 CPU(2) 1 1\n";
+  }
+
+  Simulator sim;
+  sim.loadProcesses(fname);
+  auto mem = std::make_unique<MockMemoryManager>();
+  mem->everythingLoaded = true;
+  sim.setScheduler(std::make_unique<MockScheduler>());
+  sim.setMemoryManager(std::move(mem));
+  sim.setTimeSeriesRecorder(std::make_unique<TimeSeriesRecorder>());
+  sim.start();
+
+  int ticks = 0;
+  while (sim.isRunning() && ticks < 20) {
+    sim.tick();
+    ticks++;
+  }
+  sim.stop();
+
+  // One row per tick; P2 waits while P1 runs, and the CPU is busy for the four bursts
+  const TimeSeriesRecorder* series = sim.getTimeSeriesRecorder();
+  assert(series->rowCount() == static_cast<size_t>(ticks));
+  assert(series->value(0, SeriesColumn::READY) == 1);
+  uint64_t busy = 0;
+  for (size_t r = 0; r < series->rowCount(); ++r) busy += series->value(r, SeriesColumn::CPU_BUSY);
+  assert(busy == 4);
+
+  sim.reset();
+  assert(series->rowCount() == 0);
+
+  std::cout << "[PASSED] test_simulator_sampling" << std::endl;
+  std::remove(fname.c_str());
+}
+
+int main() {
+  test_interval_reduction();
+  test_bounded_rows();
+  test_export_round_trip();
+  test_simulator_sampling();
+  std::cout << "\nAll time-series tests passed!" << std::endl;
+  return 0;
+}
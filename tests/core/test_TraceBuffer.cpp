@@ -0,0 +1,151 @@
+/**
+ * @brief Unit tests for the trace ring buffer (gating, ordering, overwrite).
+ */
+
+#include "waos/core/TraceBuffer.h"
+#include "waos/scheduler/FCFSScheduler.h"
+#include "waos/core/Process.h"
+#include <cassert>
+#include <iostream>
+#include <queue>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace waos::core;
+
+void test_runtime_gate() {
+  std::cout << "[RUNNING] test_runtime_gate..." << std::endl;
+  TraceBuffer::clear();
+
+  TraceBuffer::setEnabled(false);
+  WAOS_TRACE("Test", ENQUEUE, 1);
+  assert(TraceBuffer::drain().empty());
+
+  TraceBuffer::setEnabled(true);
+  WAOS_TRACE("Test", ENQUEUE, 1, 7);
+  auto records = TraceBuffer::drain();
+  assert(records.size() == 1);
+  assert(records[0].event == TraceEvent::ENQUEUE);
+  assert(records[0].pid == 1 && records[0].arg0 == 7 && records[0].arg1 == -1);
+
+  // Drained records are consumed
+  assert(TraceBuffer::drain().empty());
+  TraceBuffer::setEnabled(false);
+  std::cout << "[PASSED] test_runtime_gate" << std::endl;
+}
+
+void test_scheduler_records() {
+  std::cout << "[RUNNING] test_scheduler_records..." << std::endl;
+  TraceBuffer::clear();
+  TraceBuffer::setEnabled(true);
+
+  std::queue<Burst> bursts;
+  bursts.push({BurstType::CPU, 3});
+  Process p1(1, 0, 0, bursts, 1);
+  Process p2(2, 0, 0, bursts, 1);
+
+  waos::scheduler::FCFSScheduler scheduler;
+  scheduler.addProcess(&p1);
+  scheduler.addProcess(&p2);
+  scheduler.getNextProcess();
+
+  std::ostringstream out;
+  size_t written = TraceBuffer::drainTo(out);
+  assert(written == 3);
+  assert(out.str() ==
+         "  [FCFS] enqueue P1\n"
+         "  [FCFS] enqueue P2\n"
+         "  [FCFS] dispatch P1\n");
+
+  TraceBuffer::setEnabled(false);
+  std::cout << "[PASSED] test_scheduler_records" << std::endl;
+}
+
+void test_overwrite_oldest() {
+  std::cout << "[RUNNING] test_overwrite_oldest..." << std::endl;
+  TraceBuffer::clear();
+  TraceBuffer::setEnabled(true);
+
+  const int extra = 10;
+  for (int i = 0; i < static_cast<int>(TraceBuffer::RING_CAPACITY) + extra; ++i) {
+    WAOS_TRACE("Test", DISPATCH, i);
+  }
+
+  auto records = TraceBuffer::drain();
+  assert(records.size() == TraceBuffer::RING_CAPACITY);
+  assert(records.front().pid == extra);
+  assert(records.back().pid == static_cast<int>(TraceBuffer::RING_CAPACITY) + extra - 1);
+  assert(TraceBuffer::droppedRecords() == static_cast<uint64_t>(extra));
+
+  TraceBuffer::clear();
+  assert(TraceBuffer::droppedRecords() == 0);
+  TraceBuffer::setEnabled(false);
+  std::cout << "[PASSED] test_overwrite_oldest" << std::endl;
+}
+
+void test_per_thread_rings_merge_in_order() {
+  std::cout << "[RUNNING] test_per_thread_rings_merge_in_order..." << std::endl;
+  TraceBuffer::clear();
+  TraceBuffer::setEnabled(true);
+
+  const int threads = 4;
+  const int perThread = 500;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([t] {
+      for (int i = 0; i < perThread; ++i) WAOS_TRACE("Worker", ENQUEUE, t, i);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+
+  auto records = TraceBuffer::drain();
+  assert(records.size() == static_cast<size_t>(threads * perThread));
+  std::vector<int64_t> lastSeen(threads, -1);
+  for (size_t i = 0; i < records.size(); ++i) {
+    if (i > 0) assert(records[i - 1].sequence < records[i].sequence);
+    // Each producer's records keep their program order
+    assert(records[i].arg0 == lastSeen[records[i].pid] + 1);
+    lastSeen[records[i].pid] = records[i].arg0;
+  }
+  assert(TraceBuffer::droppedRecords() == 0);
+
+  TraceBuffer::setEnabled(false);
+  std::cout << "[PASSED] test_per_thread_rings_merge_in_order" << std::endl;
+}
+
+void test_drain_while_producing() {
+  std::cout << "[RUNNING] test_drain_while_producing..." << std::endl;
+  TraceBuffer::clear();
+  TraceBuffer::setEnabled(true);
+
+  // The producer laps the ring while the main thread drains: every record seen must be intact
+  const int total = 20 * static_cast<int>(TraceBuffer::RING_CAPACITY);
+  std::thread producer([] {
+    for (int i = 0; i < total; ++i) WAOS_TRACE("Worker", ENQUEUE, i, 2 * int64_t(i), 3 * int64_t(i));
+  });
+
+  size_t seen = 0;
+  auto check = [&seen](const std::vector<TraceRecord>& records) {
+    for (const auto& record : records) {
+      assert(record.arg0 == 2 * int64_t(record.pid) && record.arg1 == 3 * int64_t(record.pid));
+    }
+    seen += records.size();
+  };
+  while (seen + TraceBuffer::droppedRecords() < static_cast<uint64_t>(total)) check(TraceBuffer::drain());
+  producer.join();
+  check(TraceBuffer::drain());
+  assert(seen + TraceBuffer::droppedRecords() == static_cast<uint64_t>(total));
+
+  TraceBuffer::setEnabled(false);
+  std::cout << "[PASSED] test_drain_while_producing" << std::endl;
+}
+
+int main() {
+  test_runtime_gate();
+  test_scheduler_records();
+  test_overwrite_oldest();
+  test_per_thread_rings_merge_in_order();
+  test_drain_while_producing();
+  return 0;
+}
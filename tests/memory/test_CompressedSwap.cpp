@@ -0,0 +1,109 @@
+#include "waos/memory/CompressedSwapPool.h"
+#include "waos/memory/LRUMemoryManager.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+using waos::memory::CompressedSwapConfig;
+using waos::memory::CompressedSwapPool;
+using waos::memory::PageRequestResult;
+
+void test_pool_store_and_take() {
+  std::cout << "[RUNNING] test_pool_store_and_take..." << std::endl;
+
+  CompressedSwapPool pool(1, 4.0);
+  assert(pool.enabled());
+  assert(pool.capacityBytes() == CompressedSwapPool::PAGE_BYTES);
+
+  // Sizes are deterministic and spread around PAGE_BYTES / ratio
+  int size = pool.compressedSize(1, 0);
+  assert(size == pool.compressedSize(1, 0));
+  assert(size >= CompressedSwapPool::PAGE_BYTES / 8 && size < CompressedSwapPool::PAGE_BYTES * 3 / 8);
+
+  assert(pool.store(1, 0));
+  assert(pool.contains(1, 0));
+  assert(pool.usedBytes() == static_cast<size_t>(size));
+
+  assert(pool.take(1, 0));
+  assert(!pool.take(1, 0));
+  assert(pool.usedBytes() == 0);
+
+  std::cout << "[PASSED] test_pool_store_and_take" << std::endl;
+}
+
+void test_pool_lru_writeback() {
+  std::cout << "[RUNNING] test_pool_lru_writeback..." << std::endl;
+
+  CompressedSwapPool pool(1, 4.0);
+  for (int page = 0; page < 16; ++page) pool.store(1, page);
+
+  // One frame holds at most ~8 pages at 4:1, the oldest went to disk
+  assert(pool.writebacks() > 0);
+  assert(pool.usedBytes() <= pool.capacityBytes());
+  assert(!pool.contains(1, 0));
+  assert(pool.contains(1, 15));
+  assert(pool.storedPages() + static_cast<int>(pool.writebacks()) == 16);
+
+  pool.dropProcess(1);
+  assert(pool.storedPages() == 0 && pool.usedBytes() == 0);
+
+  // Poorly compressible pages are rejected straight to disk
+  CompressedSwapPool raw(1, 1.0);
+  int rejected = 0;
+  for (int page = 0; page < 8; ++page) {
+    if (!raw.store(1, page)) rejected++;
+  }
+  assert(rejected > 0 && raw.rejected() == static_cast<uint64_t>(rejected));
+
+  std::cout << "[PASSED] test_pool_lru_writeback" << std::endl;
+}
+
+void test_manager_compressed_reload() {
+  std::cout << "[RUNNING] test_manager_compressed_reload..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  CompressedSwapConfig swap;
+  swap.poolFraction = 0.2;
+  swap.reloadPenalty = 2;
+  waos::memory::LRUMemoryManager lru(10, &simulatedClock, waos::memory::PageTableGeometry(), swap);
+
+  auto stats = lru.getMemoryStats();
+  assert(stats.totalFrames == 8);
+  assert(stats.compressedPoolFrames == 2);
+  assert(lru.getCompressedReloadPenalty() == 2);
+
+  lru.allocateForProcess(1, 16);
+  for (int page = 0; page < 9; ++page) {
+    simulatedClock++;
+    lru.requestPage(1, page);  // Page 0 is evicted into the pool
+  }
+  assert(!lru.isPageLoaded(1, 0));
+
+  simulatedClock++;
+  assert(lru.requestPage(1, 0) == PageRequestResult::COMPRESSED_RELOAD);
+  stats = lru.getMemoryStats();
+  assert(stats.compressedReloads == 1);
+  assert(stats.compressedPages == 1);  // Page 1 took its place in the pool
+
+  lru.freeForProcess(1);
+  assert(lru.getMemoryStats().compressedPages == 0);
+
+  // Pool cannot take every frame
+  bool threw = false;
+  try {
+    swap.poolFraction = 1.0;
+    waos::memory::LRUMemoryManager invalid(4, &simulatedClock, waos::memory::PageTableGeometry(), swap);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "[PASSED] test_manager_compressed_reload" << std::endl;
+}
+
+int main() {
+  test_pool_store_and_take();
+  test_pool_lru_writeback();
+  test_manager_compressed_reload();
+  return 0;
+}
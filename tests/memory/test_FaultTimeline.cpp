@@ -0,0 +1,127 @@
+#include "waos/memory/FaultTimeline.h"
+#include "waos/memory/LRUMemoryManager.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using waos::memory::FaultTimeline;
+
+void test_window_aggregation() {
+  std::cout << "[RUNNING] test_window_aggregation..." << std::endl;
+
+  FaultTimeline timeline(10, 4, 2);
+  timeline.registerProcess(1);
+
+  timeline.recordFault(1, 0, false);
+  timeline.recordHit(1, 3);
+  timeline.recordFault(1, 9, true);
+  timeline.recordFault(1, 12, false);
+
+  auto windows = timeline.query(0, 19);
+  assert(windows.size() == 2);
+  assert(windows[0].startTick == 0 && windows[0].endTick == 10);
+  assert(windows[0].faults == 2);
+  assert(windows[0].hits == 1);
+  assert(windows[0].replacements == 1);
+  assert(windows[1].faults == 1);
+
+  // Sub-range only returns overlapping windows
+  auto second = timeline.query(15, 15);
+  assert(second.size() == 1);
+  assert(second[0].startTick == 10);
+
+  std::cout << "[PASSED] test_window_aggregation" << std::endl;
+}
+
+void test_ring_buffer_retention() {
+  std::cout << "[RUNNING] test_ring_buffer_retention..." << std::endl;
+
+  FaultTimeline timeline(10, 4, 2);
+  for (uint64_t tick = 0; tick < 100; tick += 10) {
+    timeline.recordFault(1, tick, false);
+  }
+
+  // Only the last 4 windows (60..99) are retained
+  auto windows = timeline.query(0, 99);
+  assert(windows.size() == 4);
+  assert(windows.front().startTick == 60);
+  assert(windows.back().startTick == 90);
+  for (const auto& w : windows) assert(w.faults == 1);
+
+  std::cout << "[PASSED] test_ring_buffer_retention" << std::endl;
+}
+
+void test_process_fault_rate_and_slots() {
+  std::cout << "[RUNNING] test_process_fault_rate_and_slots..." << std::endl;
+
+  FaultTimeline timeline(10, 8, 1);
+  timeline.registerProcess(1);
+  timeline.registerProcess(2);  // No slot left: overflow
+
+  for (uint64_t tick = 0; tick < 5; ++tick) timeline.recordFault(1, tick, false);
+  timeline.recordFault(2, 6, false);
+
+  auto rate = timeline.processFaultRate(1, 0, 9);
+  assert(rate.faults == 5);
+  assert(rate.ticks == 10);
+  assert(std::abs(rate.faultRate - 0.5) < 1e-9);
+
+  // Overflow process still shows up in cumulative totals
+  auto totals = timeline.faultsPerProcess();
+  assert(totals[1] == 5);
+  assert(totals[2] == 1);
+
+  // Releasing keeps the total and frees the slot for the next process
+  timeline.releaseProcess(1);
+  timeline.registerProcess(3);
+  timeline.recordFault(3, 7, false);
+  totals = timeline.faultsPerProcess();
+  assert(totals[1] == 5);
+  assert(totals[3] == 1);
+  assert(timeline.processFaultRate(3, 0, 9).faults == 1);
+
+  std::cout << "[PASSED] test_process_fault_rate_and_slots" << std::endl;
+}
+
+void test_manager_integration() {
+  std::cout << "[RUNNING] test_manager_integration..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  waos::memory::LRUMemoryManager lru(2, &simulatedClock);
+  lru.allocateForProcess(1, 4);
+
+  simulatedClock = 1;
+  lru.requestPage(1, 0);  // Fault
+  simulatedClock = 2;
+  lru.requestPage(1, 0);  // Hit
+  simulatedClock = 3;
+  lru.requestPage(1, 1);  // Fault
+  simulatedClock = 4;
+  lru.requestPage(1, 2);  // Replacement
+
+  auto windows = lru.getFaultTimeline(0, 9);
+  assert(windows.size() == 1);
+  assert(windows[0].faults == 3);
+  assert(windows[0].hits == 1);
+  assert(windows[0].replacements == 1);
+
+  auto stats = lru.getMemoryStats();
+  assert(stats.faultsPerProcess[1] == 3);
+  assert(stats.currentFaultRate > 0.0);
+
+  lru.freeForProcess(1);
+  assert(lru.getMemoryStats().faultsPerProcess[1] == 3);
+
+  lru.reset();
+  assert(lru.getFaultTimeline(0, 9).empty());
+
+  std::cout << "[PASSED] test_manager_integration" << std::endl;
+}
+
+int main() {
+  test_window_aggregation();
+  test_ring_buffer_retention();
+  test_process_fault_rate_and_slots();
+  test_manager_integration();
+  return 0;
+}
@@ -0,0 +1,131 @@
+#include "waos/memory/InvertedPageTable.h"
+#include "waos/memory/FIFOMemoryManager.h"
+#include "waos/memory/LRUMemoryManager.h"
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <random>
+
+using waos::memory::InvertedPageTable;
+using waos::memory::PageTableGeometry;
+using waos::memory::PageTableMode;
+
+void test_insert_find_erase() {
+  std::cout << "[RUNNING] test_insert_find_erase..." << std::endl;
+
+  InvertedPageTable table(4);
+  assert(table.slotCount() == 8);
+
+  table.insert(1, 0).frameNumber = 10;
+  table.insert(2, 0).frameNumber = 20;
+  assert(table.find(1, 0)->frameNumber == 10);
+  assert(table.find(2, 0)->frameNumber == 20);
+  assert(table.find(1, 1) == nullptr);
+
+  int probes = 0;
+  table.find(1, 0, &probes);
+  assert(probes >= 1);
+
+  assert(table.erase(1, 0));
+  assert(!table.erase(1, 0));
+  assert(table.find(1, 0) == nullptr);
+  assert(table.find(2, 0)->frameNumber == 20);
+  assert(table.size() == 1);
+
+  std::cout << "[PASSED] test_insert_find_erase" << std::endl;
+}
+
+void test_random_operations_match_map() {
+  std::cout << "[RUNNING] test_random_operations_match_map..." << std::endl;
+
+  // Backward-shift deletion must keep every remaining chain reachable
+  InvertedPageTable table(16);
+  std::map<std::pair<int, int>, int> reference;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<> pidDist(1, 6), pageDist(0, 40);
+
+  for (int i = 0; i < 5000; ++i) {
+    int pid = pidDist(gen), page = pageDist(gen);
+    if (gen() % 3 == 0) {
+      assert(table.erase(pid, page) == (reference.erase({pid, page}) > 0));
+    } else {
+      table.insert(pid, page).frameNumber = i;
+      reference[{pid, page}] = i;
+    }
+  }
+
+  assert(table.size() == reference.size());
+  for (const auto& pair : reference) {
+    const auto* entry = table.find(pair.first.first, pair.first.second);
+    assert(entry && entry->frameNumber == pair.second);
+  }
+  assert(table.size() * 2 <= table.slotCount());  // Grew to keep load factor <= 1/2
+
+  std::cout << "[PASSED] test_random_operations_match_map" << std::endl;
+}
+
+void test_inverted_mode_matches_radix() {
+  std::cout << "[RUNNING] test_inverted_mode_matches_radix..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  PageTableGeometry inverted;
+  inverted.mode = PageTableMode::INVERTED;
+  waos::memory::LRUMemoryManager radixLru(4, &simulatedClock);
+  waos::memory::LRUMemoryManager invertedLru(4, &simulatedClock, inverted);
+
+  for (int pid = 1; pid <= 3; ++pid) {
+    radixLru.allocateForProcess(pid, 16);
+    invertedLru.allocateForProcess(pid, 16);
+  }
+
+  std::mt19937 gen(7);
+  for (int i = 0; i < 500; ++i) {
+    simulatedClock++;
+    int pid = 1 + static_cast<int>(gen() % 3);
+    int page = static_cast<int>(gen() % 8);
+    assert(radixLru.requestPage(pid, page) == invertedLru.requestPage(pid, page));
+  }
+
+  auto radixStats = radixLru.getMemoryStats();
+  auto invertedStats = invertedLru.getMemoryStats();
+  assert(radixStats.totalPageFaults == invertedStats.totalPageFaults);
+  assert(radixStats.totalReplacements == invertedStats.totalReplacements);
+
+  // Inverted table only lists resident pages
+  for (const auto& info : invertedLru.getPageTableForProcess(1)) assert(info.present);
+
+  invertedLru.freeForProcess(1);
+  assert(invertedLru.getPageTableForProcess(1).empty());
+  assert(!invertedLru.isPageLoaded(1, 0));
+
+  std::cout << "[PASSED] test_inverted_mode_matches_radix" << std::endl;
+}
+
+void test_metadata_bounded_by_frames() {
+  std::cout << "[RUNNING] test_metadata_bounded_by_frames..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  PageTableGeometry inverted;
+  inverted.mode = PageTableMode::INVERTED;
+  waos::memory::FIFOMemoryManager fifo(8, &simulatedClock, inverted);
+
+  size_t initialBytes = fifo.getMemoryStats().pageTableBytes;
+  for (int pid = 1; pid <= 2000; ++pid) {
+    fifo.allocateForProcess(pid, 1 << 20);
+    fifo.requestPage(pid, pid * 37);
+  }
+
+  auto stats = fifo.getMemoryStats();
+  assert(stats.pageTableBytes == initialBytes);
+  assert(stats.usedFrames == 8);
+
+  std::cout << "[PASSED] test_metadata_bounded_by_frames" << std::endl;
+}
+
+int main() {
+  test_insert_find_erase();
+  test_random_operations_match_map();
+  test_inverted_mode_matches_radix();
+  test_metadata_bounded_by_frames();
+  return 0;
+}
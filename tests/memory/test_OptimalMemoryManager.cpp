@@ -59,7 +59,7 @@ void test_optimal_advantage() {
   
   for (size_t i = 0; i < std::min(size_t(7), refs.size()); ++i) {
     clock = i + 1;
-    int page = process->getCurrentPageRequirement();
+    auto page = process->getCurrentPageRequirement();
     optimal.requestPage(2, page);
     
     process->advanceInstructionPointer();
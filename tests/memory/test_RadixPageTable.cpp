@@ -0,0 +1,105 @@
+#include "waos/memory/FIFOMemoryManager.h"
+#include "waos/memory/RadixPageTable.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using waos::memory::PageTableGeometry;
+using waos::memory::RadixPageTable;
+
+void test_lazy_node_allocation() {
+  std::cout << "[RUNNING] test_lazy_node_allocation..." << std::endl;
+
+  RadixPageTable table;  // 4 levels x 9 bits = 2^36 pages
+  assert(table.capacity() == (uint64_t(1) << 36));
+  assert(table.nodeCount() == 0);
+  assert(table.find(0) == nullptr);
+
+  table[0].load(3, 10);
+  assert(table.size() == 1);
+  assert(table.nodeCount() == 4);  // One node per level
+
+  // Neighbour in the same leaf does not allocate
+  table[1];
+  assert(table.nodeCount() == 4);
+
+  // A page at the top of the address space only allocates its own path
+  uint64_t farPage = (uint64_t(1) << 36) - 1;
+  table[farPage].load(7, 20);
+  assert(table.nodeCount() == 7);
+  assert(table.find(farPage)->frameNumber == 7);
+  assert(table.find(0)->isLoaded());
+
+  std::cout << "[PASSED] test_lazy_node_allocation" << std::endl;
+}
+
+void test_walk_depth_and_iteration() {
+  std::cout << "[RUNNING] test_walk_depth_and_iteration..." << std::endl;
+
+  PageTableGeometry geometry;
+  geometry.levels = 3;
+  geometry.bitsPerLevel = 4;
+  RadixPageTable table(geometry);
+
+  table[300];
+  table[5];
+  table[17];
+
+  int levels = 0;
+  assert(table.find(5, &levels) != nullptr);
+  assert(levels == 3);
+
+  // Missing interior node stops the walk early
+  assert(table.find(4000, &levels) == nullptr);
+  assert(levels == 1);
+
+  std::vector<uint64_t> pages;
+  table.forEach([&pages](uint64_t page, const waos::memory::PageTableEntry&) { pages.push_back(page); });
+  assert((pages == std::vector<uint64_t>{5, 17, 300}));
+
+  bool threw = false;
+  try {
+    table[table.capacity()];
+  } catch (const std::out_of_range&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "[PASSED] test_walk_depth_and_iteration" << std::endl;
+}
+
+void test_manager_walk_cost() {
+  std::cout << "[RUNNING] test_manager_walk_cost..." << std::endl;
+
+  PageTableGeometry geometry;
+  geometry.walkCostPerLevel = 1;
+
+  uint64_t simulatedClock = 0;
+  waos::memory::FIFOMemoryManager fifo(2, &simulatedClock, geometry);
+
+  // Huge declared address space: nothing is pre-created
+  fifo.allocateForProcess(1, 1 << 30);
+  assert(fifo.getMemoryStats().pageTableNodes == 0);
+  assert(fifo.getPageTableForProcess(1).empty());
+
+  fifo.requestPage(1, 123456789);  // Fault: empty table, no levels walked
+  assert(fifo.getLastWalkCost() == 0);
+
+  fifo.requestPage(1, 123456789);  // Hit: full walk
+  assert(fifo.getLastWalkCost() == 4);
+
+  auto stats = fifo.getMemoryStats();
+  assert(stats.pageTableNodes == 4);
+  assert(stats.totalPageWalkSteps == 4);
+  assert(fifo.getPageTableForProcess(1).size() == 1);
+
+  std::cout << "[PASSED] test_manager_walk_cost" << std::endl;
+}
+
+int main() {
+  test_lazy_node_allocation();
+  test_walk_depth_and_iteration();
+  test_manager_walk_cost();
+  return 0;
+}
@@ -0,0 +1,117 @@
+#include "waos/memory/FIFOMemoryManager.h"
+#include "waos/memory/LRUMemoryManager.h"
+#include <cassert>
+#include <iostream>
+
+using waos::memory::PageRequestResult;
+
+void test_shared_frame_mapping() {
+  std::cout << "[RUNNING] test_shared_frame_mapping..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  waos::memory::LRUMemoryManager lru(4, &simulatedClock);
+  lru.allocateForProcess(1, 4);
+  lru.allocateForProcess(2, 4);
+  lru.mapSharedRegion(1, 7, 0, 2, false);
+  lru.mapSharedRegion(2, 7, 2, 2, false);  // Same region at a different virtual page
+
+  simulatedClock = 1;
+  assert(lru.requestPage(1, 0) == PageRequestResult::PAGE_FAULT);
+  simulatedClock = 2;
+  assert(lru.requestPage(2, 2) == PageRequestResult::HIT);  // Region page 0 already resident
+
+  auto stats = lru.getMemoryStats();
+  assert(stats.usedFrames == 1);
+  assert(stats.sharedFrames == 1);
+  assert(stats.sharedMappingHits == 1);
+  assert(lru.getFrameStatus()[0].refCount == 2);
+
+  // Private pages are unaffected
+  assert(lru.requestPage(2, 0) == PageRequestResult::PAGE_FAULT);
+  assert(lru.getMemoryStats().usedFrames == 2);
+
+  // The shared frame survives while one mapper remains
+  lru.freeForProcess(1);
+  assert(lru.isPageLoaded(2, 2));
+  assert(lru.getFrameStatus()[0].ownerPid == 2);
+  assert(lru.getFrameStatus()[0].refCount == 1);
+  assert(lru.getMemoryStats().usedFrames == 2);
+
+  lru.freeForProcess(2);
+  assert(lru.getMemoryStats().usedFrames == 0);
+
+  std::cout << "[PASSED] test_shared_frame_mapping" << std::endl;
+}
+
+void test_copy_on_write_split() {
+  std::cout << "[RUNNING] test_copy_on_write_split..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  waos::memory::LRUMemoryManager lru(4, &simulatedClock);
+  lru.allocateForProcess(1, 2);
+  lru.allocateForProcess(2, 2);
+  lru.mapSharedRegion(1, 3, 0, 2, true);
+  lru.mapSharedRegion(2, 3, 0, 2, true);
+
+  simulatedClock = 1;
+  lru.requestPage(1, 0);
+  simulatedClock = 2;
+  assert(lru.requestPage(2, 0) == PageRequestResult::HIT);  // Reads share the frame
+  assert(lru.getMemoryStats().usedFrames == 1);
+
+  // Write by P2 gets a private copy; P1 keeps the original frame
+  simulatedClock = 3;
+  assert(lru.requestPage(2, 0, true) == PageRequestResult::COPY_ON_WRITE);
+  auto stats = lru.getMemoryStats();
+  assert(stats.usedFrames == 2);
+  assert(stats.sharedFrames == 0);
+  assert(stats.copyOnWriteFaults == 1);
+
+  auto table = lru.getPageTableForProcess(2);
+  assert(table[0].modified);
+  assert(table[0].frameNumber != lru.getPageTableForProcess(1)[0].frameNumber);
+
+  // Sole remaining mapper writes in place
+  simulatedClock = 4;
+  assert(lru.requestPage(1, 0, true) == PageRequestResult::HIT);
+  assert(lru.getMemoryStats().usedFrames == 2);
+
+  // Once private, further writes are plain hits
+  assert(lru.requestPage(2, 0, true) == PageRequestResult::HIT);
+
+  std::cout << "[PASSED] test_copy_on_write_split" << std::endl;
+}
+
+void test_shared_frame_eviction() {
+  std::cout << "[RUNNING] test_shared_frame_eviction..." << std::endl;
+
+  uint64_t simulatedClock = 0;
+  waos::memory::FIFOMemoryManager fifo(2, &simulatedClock);
+  fifo.allocateForProcess(1, 4);
+  fifo.allocateForProcess(2, 4);
+  fifo.mapSharedRegion(1, 1, 0, 1, false);
+  fifo.mapSharedRegion(2, 1, 0, 1, false);
+
+  fifo.requestPage(1, 0);  // Shared, frame 0
+  fifo.requestPage(2, 0);  // Mapped, no new frame
+  fifo.requestPage(1, 1);  // Private, frame 1
+  assert(fifo.requestPage(2, 1) == PageRequestResult::REPLACEMENT);
+
+  // Evicting the shared frame unmaps it from both processes
+  assert(!fifo.isPageLoaded(1, 0));
+  assert(!fifo.isPageLoaded(2, 0));
+  assert(fifo.getMemoryStats().sharedFrames == 0);
+
+  // Reloading by either mapper shares it again
+  assert(fifo.requestPage(1, 0) == PageRequestResult::REPLACEMENT);
+  assert(fifo.requestPage(2, 0) == PageRequestResult::HIT);
+
+  std::cout << "[PASSED] test_shared_frame_eviction" << std::endl;
+}
+
+int main() {
+  test_shared_frame_mapping();
+  test_copy_on_write_split();
+  test_shared_frame_eviction();
+  return 0;
+}
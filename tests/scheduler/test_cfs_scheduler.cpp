@@ -0,0 +1,201 @@
+/**
+ * @brief Tests for the Completely Fair Scheduler (CFS).
+ * @details Checks the nice/weight mapping, vruntime ordering, dynamic time
+ *          slices, wakeup preemption and weighted CPU shares in the Simulator.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/CFSScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int priority, int cpuBurst) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, cpuBurst});
+    return std::make_unique<Process>(pid, 0, priority, bursts, 1);
+}
+
+void test_weights_and_configuration() {
+    std::cout << "[RUNNING] test_weights_and_configuration..." << std::endl;
+
+    assert(CFSScheduler::weightFromNice(0) == 1024);
+    assert(CFSScheduler::weightFromNice(-20) == 88761);
+    assert(CFSScheduler::weightFromNice(19) == 15);
+    assert(CFSScheduler::niceFromPriority(40) == 19);
+    assert(CFSScheduler::niceFromPriority(-50) == -20);
+
+    bool thrown = false;
+    try { CFSScheduler s(4, 8); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    std::cout << "[PASSED] test_weights_and_configuration" << std::endl;
+}
+
+void test_picks_least_vruntime_and_charges_cpu() {
+    std::cout << "[RUNNING] test_picks_least_vruntime_and_charges_cpu..." << std::endl;
+
+    auto p1 = makeProcess(1, 0, 50);
+    auto p2 = makeProcess(2, 0, 50);
+    CFSScheduler cfs(20, 2);
+
+    cfs.addProcess(p1.get());
+    cfs.addProcess(p2.get());
+    assert(cfs.getNextProcess() == p1.get());
+
+    p1->addCpuTime(4);
+    cfs.addProcess(p1.get());
+    assert(std::fabs(cfs.getVirtualRuntime(1) - 4.0) < 1e-9);
+    assert(cfs.getNextProcess() == p2.get());  // vruntime 0 < 4
+
+    // A heavier process accrues vruntime more slowly
+    auto heavy = makeProcess(3, -5, 50);
+    CFSScheduler weighted(20, 2);
+    weighted.addProcess(heavy.get());
+    assert(weighted.getNextProcess() == heavy.get());
+    heavy->addCpuTime(4);
+    weighted.addProcess(heavy.get());
+    assert(weighted.getVirtualRuntime(3) < 4.0);
+
+    auto metrics = cfs.getSchedulerMetrics();
+    assert(metrics.virtualRuntime.count(1) && metrics.virtualRuntime.count(2));
+
+    std::cout << "[PASSED] test_picks_least_vruntime_and_charges_cpu" << std::endl;
+}
+
+void test_terminated_pid_is_forgotten() {
+    std::cout << "[RUNNING] test_terminated_pid_is_forgotten..." << std::endl;
+
+    CFSScheduler cfs(20, 2);
+    auto old = makeProcess(1, 0, 50);
+    cfs.addProcess(old.get());
+    assert(cfs.getNextProcess() == old.get());
+    old->addCpuTime(10);
+
+    cfs.onProcessTerminated(1);
+    assert(cfs.getVirtualRuntime(1) == 0.0);
+    assert(!cfs.getSchedulerMetrics().virtualRuntime.count(1));
+
+    // A new process with the same PID must not inherit the old charged CPU
+    auto reused = makeProcess(1, 0, 50);
+    auto other = makeProcess(2, 0, 50);
+    cfs.addProcess(reused.get());
+    cfs.addProcess(other.get());
+    assert(cfs.getVirtualRuntime(1) < 1.0);
+    assert(cfs.getNextProcess() == reused.get());
+
+    // Even without the notification, a smaller CPU total never wraps vruntime
+    CFSScheduler stale(20, 2);
+    stale.addProcess(old.get());
+    assert(stale.getNextProcess() == old.get());
+    auto fresh = makeProcess(1, 0, 50);
+    auto waking = makeProcess(2, 0, 50);
+    stale.addProcess(waking.get());
+    assert(!stale.shouldPreempt(fresh.get(), waking.get()));
+    stale.addProcess(fresh.get());
+    assert(std::fabs(stale.getVirtualRuntime(1) - 10.0) < 1e-9);
+
+    std::cout << "[PASSED] test_terminated_pid_is_forgotten" << std::endl;
+}
+
+void test_dynamic_time_slice() {
+    std::cout << "[RUNNING] test_dynamic_time_slice..." << std::endl;
+
+    CFSScheduler cfs(20, 2);
+    auto running = makeProcess(1, 0, 50);
+    assert(cfs.getTimeSliceFor(running.get()) == 20);  // Alone: the whole latency period
+
+    std::vector<std::unique_ptr<Process>> others;
+    for (int pid = 2; pid <= 4; ++pid) {
+        others.push_back(makeProcess(pid, 0, 50));
+        cfs.addProcess(others.back().get());
+    }
+    assert(cfs.getTimeSliceFor(running.get()) == 5);  // 20 / 4 equal weights
+
+    for (int pid = 5; pid <= 20; ++pid) {
+        others.push_back(makeProcess(pid, 0, 50));
+        cfs.addProcess(others.back().get());
+    }
+    assert(cfs.getTimeSliceFor(running.get()) == 2);  // Clamped to the minimum granularity
+
+    std::cout << "[PASSED] test_dynamic_time_slice" << std::endl;
+}
+
+void test_wakeup_preemption() {
+    std::cout << "[RUNNING] test_wakeup_preemption..." << std::endl;
+
+    CFSScheduler cfs(20, 2);
+    auto hog = makeProcess(1, 0, 50);
+    auto sleeper = makeProcess(2, 0, 50);
+
+    cfs.addProcess(hog.get());
+    cfs.addProcess(sleeper.get());
+    assert(cfs.getNextProcess() == hog.get());
+    assert(cfs.getNextProcess() == sleeper.get());
+    sleeper->addCpuTime(1);  // Ran briefly and blocked
+
+    hog->addCpuTime(1);
+    cfs.addProcess(sleeper.get());
+    assert(!cfs.shouldPreempt(hog.get(), sleeper.get()));  // Within granularity
+
+    hog->addCpuTime(9);
+    assert(cfs.shouldPreempt(hog.get(), sleeper.get()));
+
+    std::cout << "[PASSED] test_wakeup_preemption" << std::endl;
+}
+
+void test_weighted_cpu_share_in_simulator() {
+    std::cout << "[RUNNING] test_weighted_cpu_share_in_simulator..." << std::endl;
+
+    std::string fname = "test_cfs.txt";
+    std::ofstream out(fname);
+    out << "P1 0 CPU(200) 0 1\n"
+        << "P2 0 CPU(200) 5 1\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    auto scheduler = std::make_unique<CFSScheduler>(20, 2);
+    CFSScheduler* cfs = scheduler.get();
+    sim.setScheduler(std::move(scheduler));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    for (int i = 0; i < 120; ++i) sim.tick();
+
+    uint64_t cpu1 = 0, cpu2 = 0;
+    for (const Process* p : sim.getAllProcesses()) {
+        if (p->getPid() == 1) cpu1 = p->getStats().totalCpuTime;
+        if (p->getPid() == 2) cpu2 = p->getStats().totalCpuTime;
+    }
+    // Weights 1024 vs 335: roughly a 3:1 split
+    std::cout << "  -> CPU ticks nice 0: " << cpu1 << ", nice 5: " << cpu2
+              << " (vruntime " << cfs->getVirtualRuntime(1) << " / " << cfs->getVirtualRuntime(2) << ")" << std::endl;
+    assert(cpu2 > 0);
+    assert(cpu1 > 2 * cpu2 && cpu1 < 4 * cpu2);
+    assert(std::fabs(cfs->getVirtualRuntime(1) - cfs->getVirtualRuntime(2)) <= 20.0);
+
+    std::remove(fname.c_str());
+    std::cout << "[PASSED] test_weighted_cpu_share_in_simulator" << std::endl;
+}
+
+int main() {
+    test_weights_and_configuration();
+    test_picks_least_vruntime_and_charges_cpu();
+    test_terminated_pid_is_forgotten();
+    test_dynamic_time_slice();
+    test_wakeup_preemption();
+    test_weighted_cpu_share_in_simulator();
+    return 0;
+}
@@ -0,0 +1,234 @@
+/**
+ * @brief Tests for the multilevel feedback queue (MLFQ) scheduler.
+ * @details Covers per-level quanta, demotion on full quantum, preemption by a
+ *          higher level, the periodic priority boost (also after a clock reset)
+ *          and interactive latency against plain Round Robin.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/MLFQScheduler.h"
+#include "waos/scheduler/RRScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int cpuBurst) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, cpuBurst});
+    return std::make_unique<Process>(pid, 0, 1, bursts, 1);
+}
+
+void test_invalid_configuration() {
+    std::cout << "[RUNNING] test_invalid_configuration..." << std::endl;
+
+    uint64_t clock = 0;
+    bool thrown = false;
+    try { MLFQScheduler s(&clock, {}); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    thrown = false;
+    try { MLFQScheduler s(&clock, {2, 0}); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    thrown = false;
+    try { MLFQScheduler s(nullptr, {2, 4}, 10); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    MLFQScheduler noBoost(nullptr, {2, 4}, 0);
+    assert(noBoost.getLevelCount() == 2);
+
+    std::cout << "[PASSED] test_invalid_configuration" << std::endl;
+}
+
+void test_demotion_and_per_level_quantum() {
+    std::cout << "[RUNNING] test_demotion_and_per_level_quantum..." << std::endl;
+
+    uint64_t clock = 0;
+    auto p = makeProcess(1, 20);
+    MLFQScheduler mlfq(&clock, {2, 4, 8}, 0);
+
+    mlfq.addProcess(p.get());
+    assert(mlfq.getNextProcess() == p.get());
+    assert(mlfq.getTimeSliceFor(p.get()) == 2);
+
+    mlfq.onQuantumExpired(p.get());
+    assert(mlfq.getLevel(1) == 1 && mlfq.getTimeSliceFor(p.get()) == 4);
+    mlfq.onQuantumExpired(p.get());
+    mlfq.onQuantumExpired(p.get());  // Already at the bottom level
+    assert(mlfq.getLevel(1) == 2 && mlfq.getTimeSliceFor(p.get()) == 8);
+
+    auto metrics = mlfq.getSchedulerMetrics();
+    assert(metrics.demotions == 2);
+
+    std::cout << "[PASSED] test_demotion_and_per_level_quantum" << std::endl;
+}
+
+void test_levels_forgotten_on_exit() {
+    std::cout << "[RUNNING] test_levels_forgotten_on_exit..." << std::endl;
+
+    uint64_t clock = 0;
+    auto done = makeProcess(1, 20);
+    auto dropped = makeProcess(2, 20);
+    MLFQScheduler mlfq(&clock, {2, 4, 8}, 0);
+
+    mlfq.addProcess(done.get());
+    mlfq.addProcess(dropped.get());
+    for (int i = 0; i < 2; ++i) {
+        Process* p = mlfq.getNextProcess();
+        mlfq.onQuantumExpired(p);
+        mlfq.addProcess(p);  // Requeued on level 1
+    }
+    assert(mlfq.getSchedulerMetrics().queueLevel.size() == 2);
+
+    assert(mlfq.getNextProcess() == done.get());
+    mlfq.onProcessTerminated(1);
+    assert(mlfq.removeProcess(2));
+    assert(mlfq.getLevel(1) == 0 && mlfq.getLevel(2) == 0);
+    assert(mlfq.getSchedulerMetrics().queueLevel.empty());
+
+    std::cout << "[PASSED] test_levels_forgotten_on_exit" << std::endl;
+}
+
+void test_higher_level_runs_first_and_preempts() {
+    std::cout << "[RUNNING] test_higher_level_runs_first_and_preempts..." << std::endl;
+
+    uint64_t clock = 0;
+    auto batch = makeProcess(1, 20);
+    auto interactive = makeProcess(2, 1);
+    MLFQScheduler mlfq(&clock, {2, 4}, 0);
+
+    mlfq.onQuantumExpired(batch.get());  // Batch job sits on level 1
+    mlfq.addProcess(batch.get());
+    mlfq.addProcess(interactive.get());
+
+    assert(mlfq.shouldPreempt(batch.get(), interactive.get()));
+    assert(!mlfq.shouldPreempt(interactive.get(), batch.get()));
+
+    auto order = mlfq.peekReadyQueue();
+    assert(order.size() == 2 && order[0] == interactive.get());
+    assert(mlfq.getNextProcess() == interactive.get());
+    assert(mlfq.getNextProcess() == batch.get());
+
+    std::cout << "[PASSED] test_higher_level_runs_first_and_preempts" << std::endl;
+}
+
+void test_periodic_boost() {
+    std::cout << "[RUNNING] test_periodic_boost..." << std::endl;
+
+    uint64_t clock = 0;
+    auto batch = makeProcess(1, 20);
+    auto other = makeProcess(2, 20);
+    MLFQScheduler mlfq(&clock, {2, 4, 8}, 10);
+
+    mlfq.onQuantumExpired(batch.get());
+    mlfq.onQuantumExpired(batch.get());
+    mlfq.addProcess(batch.get());
+    assert(mlfq.getLevel(1) == 2);
+
+    clock = 9;
+    mlfq.addProcess(other.get());
+    assert(mlfq.getLevel(1) == 2);
+
+    clock = 10;
+    assert(mlfq.getNextProcess() == other.get());  // Boosted processes queue behind level 0
+    assert(mlfq.getLevel(1) == 0);
+    assert(mlfq.getNextProcess() == batch.get());
+    assert(mlfq.getSchedulerMetrics().priorityBoosts == 1);
+
+    std::cout << "[PASSED] test_periodic_boost" << std::endl;
+}
+
+void test_boost_after_clock_reset() {
+    std::cout << "[RUNNING] test_boost_after_clock_reset..." << std::endl;
+
+    uint64_t clock = 0;
+    auto batch = makeProcess(1, 20);
+    auto other = makeProcess(2, 20);
+    MLFQScheduler mlfq(&clock, {2, 4, 8}, 10);
+
+    clock = 40;
+    mlfq.addProcess(batch.get());  // Boost at 40
+    assert(mlfq.getNextProcess() == batch.get());
+    mlfq.onQuantumExpired(batch.get());
+    mlfq.addProcess(batch.get());
+    assert(mlfq.getLevel(1) == 1);
+
+    // Reset: the stale level is dropped instead of waiting for the clock to pass 50
+    clock = 0;
+    mlfq.addProcess(other.get());
+    assert(mlfq.getLevel(1) == 0);
+    assert(mlfq.getSchedulerMetrics().queueLevel.at(1) == 0);
+    assert(mlfq.getNextProcess() == batch.get());  // Queue order is kept
+
+    assert(mlfq.getNextProcess() == other.get());
+    mlfq.onQuantumExpired(other.get());
+    clock = 5;
+    mlfq.addProcess(other.get());
+    assert(mlfq.getLevel(2) == 1);
+    clock = 10;  // Due again 10 ticks after the reset
+    assert(mlfq.getNextProcess() == other.get());
+    assert(mlfq.getLevel(2) == 0);
+    assert(mlfq.getSchedulerMetrics().priorityBoosts == 2);
+
+    std::cout << "[PASSED] test_boost_after_clock_reset" << std::endl;
+}
+
+uint64_t interactiveWait(std::unique_ptr<IScheduler> scheduler) {
+    std::string fname = "test_mlfq.txt";
+    std::ofstream out(fname);
+    out << "P1 0 CPU(30) 1 1\n"
+        << "P2 0 CPU(30) 1 1\n"
+        << "P3 1 CPU(1),E/S(2),CPU(1),E/S(2),CPU(1),E/S(2),CPU(1) 1 1\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    sim.setScheduler(std::move(scheduler));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    int maxTicks = 500;
+    while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+    assert(sim.getSimulatorMetrics().completedProcesses == 3);
+
+    uint64_t wait = 0;
+    for (const Process* p : sim.getAllProcesses()) {
+        if (p->getPid() == 3) wait = p->getStats().totalWaitTime;
+    }
+    std::remove(fname.c_str());
+    return wait;
+}
+
+void test_interactive_latency_under_batch_load() {
+    std::cout << "[RUNNING] test_interactive_latency_under_batch_load..." << std::endl;
+
+    uint64_t rrWait = interactiveWait(std::make_unique<RRScheduler>(8));
+    uint64_t clock = 0;  // Boost disabled: the workload is shorter than any sensible interval
+    uint64_t mlfqWait = interactiveWait(std::make_unique<MLFQScheduler>(&clock, std::vector<int>{2, 4, 8}, 0));
+
+    std::cout << "  -> Interactive wait RR(8): " << rrWait << ", MLFQ(2/4/8): " << mlfqWait << std::endl;
+    assert(mlfqWait < rrWait);
+
+    std::cout << "[PASSED] test_interactive_latency_under_batch_load" << std::endl;
+}
+
+int main() {
+    test_invalid_configuration();
+    test_demotion_and_per_level_quantum();
+    test_levels_forgotten_on_exit();
+    test_higher_level_runs_first_and_preempts();
+    test_periodic_boost();
+    test_boost_after_clock_reset();
+    test_interactive_latency_under_batch_load();
+    return 0;
+}
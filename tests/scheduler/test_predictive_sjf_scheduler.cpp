@@ -0,0 +1,131 @@
+/**
+ * @brief Tests for the exponential-average (predictive) SJF scheduler.
+ * @details Predictions follow τ(n+1) = α·t(n) + (1−α)·τ(n) and are fed by the
+ *          Simulator when CPU bursts complete.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/PredictiveSJFScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int cpuBurst) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, cpuBurst});
+    return std::make_unique<Process>(pid, 0, 1, bursts, 1);
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-9;
+}
+
+void test_invalid_parameters() {
+    std::cout << "[RUNNING] test_invalid_parameters..." << std::endl;
+
+    bool thrown = false;
+    try { PredictiveSJFScheduler s(1.5, 5.0); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    thrown = false;
+    try { PredictiveSJFScheduler s(0.5, -1.0); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    std::cout << "[PASSED] test_invalid_parameters" << std::endl;
+}
+
+void test_exponential_average_and_error() {
+    std::cout << "[RUNNING] test_exponential_average_and_error..." << std::endl;
+
+    auto p = makeProcess(1, 6);
+    PredictiveSJFScheduler sched(0.5, 10.0);
+    assert(near(sched.getPrediction(1), 10.0));
+
+    sched.onBurstCompleted(p.get(), 6);  // τ1 = 0.5·6 + 0.5·10 = 8, error -4
+    assert(near(sched.getPrediction(1), 8.0));
+
+    sched.onBurstCompleted(p.get(), 4);  // τ2 = 0.5·4 + 0.5·8 = 6, error -4
+    assert(near(sched.getPrediction(1), 6.0));
+
+    auto metrics = sched.getSchedulerMetrics();
+    assert(metrics.predictedBursts == 2);
+    assert(near(metrics.meanAbsolutePredictionError, 4.0));
+    assert(near(metrics.meanPredictionBias, -4.0));
+    assert(near(metrics.predictedBurst.at(1), 6.0));
+
+    std::cout << "[PASSED] test_exponential_average_and_error" << std::endl;
+}
+
+void test_orders_by_prediction_not_oracle() {
+    std::cout << "[RUNNING] test_orders_by_prediction_not_oracle..." << std::endl;
+
+    // P1's next burst is actually short, but its history predicts a long one
+    auto p1 = makeProcess(1, 1);
+    auto p2 = makeProcess(2, 9);
+    PredictiveSJFScheduler sched(1.0, 5.0);
+    sched.onBurstCompleted(p1.get(), 12);
+    sched.onBurstCompleted(p2.get(), 2);
+
+    sched.addProcess(p1.get());
+    sched.addProcess(p2.get());
+    assert(sched.getNextProcess() == p2.get());
+    assert(sched.getNextProcess() == p1.get());
+    assert(!sched.hasReadyProcesses());
+
+    std::cout << "[PASSED] test_orders_by_prediction_not_oracle" << std::endl;
+}
+
+void test_simulator_reports_completed_bursts() {
+    std::cout << "[RUNNING] test_simulator_reports_completed_bursts..." << std::endl;
+
+    std::string fname = "test_predictive_sjf.txt";
+    std::ofstream out(fname);
+    out << "P1 0 CPU(4),E/S(2),CPU(2) 1 1\n"
+        << "P2 0 CPU(3) 1 1\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    auto scheduler = std::make_unique<PredictiveSJFScheduler>(0.5, 2.0);
+    PredictiveSJFScheduler* sched = scheduler.get();
+    sim.setScheduler(std::move(scheduler));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    int maxTicks = 100;
+    while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+
+    assert(sim.getSimulatorMetrics().completedProcesses == 2);
+
+    // P1: τ = 2 -> 0.5·4 + 0.5·2 = 3 -> 0.5·2 + 0.5·3 = 2.5; P2: 0.5·3 + 0.5·2 = 2.5
+    auto metrics = sched->getSchedulerMetrics();
+    std::cout << "  -> Bursts: " << metrics.predictedBursts
+              << ", MAE: " << metrics.meanAbsolutePredictionError << std::endl;
+    assert(metrics.predictedBursts == 3);
+    assert(near(metrics.predictedBurst.at(1), 2.5));
+    assert(near(metrics.predictedBurst.at(2), 2.5));
+    // Errors: |4-2| + |2-3| + |3-2| = 4 over 3 bursts
+    assert(near(metrics.meanAbsolutePredictionError, 4.0 / 3.0));
+
+    std::remove(fname.c_str());
+    std::cout << "[PASSED] test_simulator_reports_completed_bursts" << std::endl;
+}
+
+int main() {
+    test_invalid_parameters();
+    test_exponential_average_and_error();
+    test_orders_by_prediction_not_oracle();
+    test_simulator_reports_completed_bursts();
+    return 0;
+}
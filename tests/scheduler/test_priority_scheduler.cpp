@@ -0,0 +1,254 @@
+/**
+ * @brief Tests for the bitmap-indexed priority array behind PriorityScheduler.
+ * @details Ordering across levels, FIFO within a level, out-of-range
+ *          priorities, O(1) removal and re-prioritisation, link reuse
+ *          after many enqueue/dequeue cycles, level promotion, aging and
+ *          preemption when an I/O-bound process becomes ready again.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/PriorityArray.h"
+#include "waos/scheduler/PriorityScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int priority) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, 1});
+    return std::make_unique<Process>(pid, 0, priority, bursts, 1);
+}
+
+void test_levels_and_fifo_order() {
+    std::cout << "[RUNNING] test_levels_and_fifo_order..." << std::endl;
+
+    // Levels spread over both bitmap words, two processes share level 3
+    auto a = makeProcess(1, 3), b = makeProcess(2, 100), c = makeProcess(3, 3), d = makeProcess(4, 0);
+    PriorityArray array;
+    array.push(a.get(), 3);
+    array.push(b.get(), 100);
+    array.push(c.get(), 3);
+    array.push(d.get(), 0);
+    assert(array.size() == 4);
+
+    auto order = array.ordered();
+    assert(order.size() == 4);
+    assert(order[0] == d.get() && order[1] == a.get() && order[2] == c.get() && order[3] == b.get());
+
+    assert(array.pop() == d.get());
+    assert(array.pop() == a.get());
+    assert(array.pop() == c.get());
+    assert(array.pop() == b.get());
+    assert(array.pop() == nullptr);
+    assert(array.empty());
+
+    std::cout << "[PASSED] test_levels_and_fifo_order" << std::endl;
+}
+
+void test_out_of_range_priorities() {
+    std::cout << "[RUNNING] test_out_of_range_priorities..." << std::endl;
+
+    auto urgent = makeProcess(1, -5), normal = makeProcess(2, 10), idle = makeProcess(3, 1000);
+    PriorityArray array;
+    array.push(idle.get(), 1000);
+    array.push(normal.get(), 10);
+    array.push(urgent.get(), -5);
+
+    auto order = array.ordered();
+    assert(order[0] == urgent.get() && order[1] == normal.get() && order[2] == idle.get());
+    assert(array.pop() == urgent.get());
+    assert(array.pop() == normal.get());
+    assert(array.pop() == idle.get());
+    assert(array.empty());
+
+    std::cout << "[PASSED] test_out_of_range_priorities" << std::endl;
+}
+
+void test_scheduler_cycles_reuse_links() {
+    std::cout << "[RUNNING] test_scheduler_cycles_reuse_links..." << std::endl;
+
+    std::vector<std::unique_ptr<Process>> processes;
+    for (int pid = 0; pid < 16; ++pid) processes.push_back(makeProcess(pid, pid % 4));
+
+    PriorityScheduler scheduler;
+    for (auto& p : processes) scheduler.addProcess(p.get());
+
+    // Requeue the winner many times: order must stay strict-priority round robin
+    for (int round = 0; round < 1000; ++round) {
+        assert(scheduler.hasReadyProcesses());
+        Process* p = scheduler.getNextProcess();
+        assert(p->getPriority() == 0);
+        scheduler.addProcess(p);
+    }
+    assert(scheduler.peekReadyQueue().size() == 16);
+
+    int lastPriority = -1;
+    while (scheduler.hasReadyProcesses()) {
+        Process* p = scheduler.getNextProcess();
+        assert(p->getPriority() >= lastPriority);
+        lastPriority = p->getPriority();
+    }
+    assert(scheduler.getSchedulerMetrics().totalSchedulingDecisions == 1016);
+
+    std::cout << "[PASSED] test_scheduler_cycles_reuse_links" << std::endl;
+}
+
+void test_remove_and_set_priority() {
+    std::cout << "[RUNNING] test_remove_and_set_priority..." << std::endl;
+
+    auto a = makeProcess(1, 2), b = makeProcess(2, 2), c = makeProcess(3, 2), d = makeProcess(4, 200);
+    PriorityArray array;
+    array.push(a.get(), 2);
+    array.push(b.get(), 2);
+    array.push(c.get(), 2);
+    array.push(d.get(), 200);
+
+    // Unlinking the middle, head and overflow entries keeps the rest intact
+    assert(array.remove(2));
+    assert(!array.remove(2));
+    assert(array.remove(4));
+    assert(!array.contains(4) && array.find(4) == nullptr);
+    assert(array.size() == 2);
+    assert(array.ordered()[0] == a.get() && array.ordered()[1] == c.get());
+
+    // Moving C up a level puts it first; same level just requeues at the tail
+    assert(array.setPriority(3, 0));
+    assert(array.setPriority(1, 2));
+    assert(!array.setPriority(2, 0));
+    assert(array.pop() == c.get());
+    assert(array.remove(1));
+    assert(array.empty() && array.pop() == nullptr);
+
+    // The level bitmap was cleared: new pushes land in order
+    array.push(b.get(), 5);
+    assert(array.pop() == b.get());
+
+    std::cout << "[PASSED] test_remove_and_set_priority" << std::endl;
+}
+
+void test_promote_levels() {
+    std::cout << "[RUNNING] test_promote_levels..." << std::endl;
+
+    auto a = makeProcess(1, 0), b = makeProcess(2, 1), c = makeProcess(3, 3), d = makeProcess(4, 70), e = makeProcess(5, 130);
+    PriorityArray array;
+    array.push(d.get(), 70);
+    array.push(c.get(), 3);
+    array.push(b.get(), 1);
+    array.push(a.get(), 0);
+    array.push(e.get(), 130);
+
+    // Levels 0 and 1 merge at 0 in priority order; overflow 130 drops into the array
+    array.promote(2);
+    assert(array.size() == 5);
+    auto order = array.ordered();
+    assert(order[0] == a.get() && order[1] == b.get() && order[2] == c.get());
+    assert(order[3] == d.get() && order[4] == e.get());
+
+    array.promote(128);
+    order = array.ordered();
+    assert(order[0] == a.get() && order[1] == b.get() && order[2] == c.get() && order[3] == d.get());
+    assert(order[4] == e.get());
+
+    // Everything sits at level 0 now: a new level-0 push goes to the tail
+    auto f = makeProcess(6, 0);
+    array.push(f.get(), 0);
+    assert(array.ordered().back() == f.get());
+    for (Process* p : {a.get(), b.get(), c.get(), d.get(), e.get(), f.get()}) assert(array.pop() == p);
+    assert(array.empty());
+
+    std::cout << "[PASSED] test_promote_levels" << std::endl;
+}
+
+void test_aging_bounds_starvation() {
+    std::cout << "[RUNNING] test_aging_bounds_starvation..." << std::endl;
+
+    bool threw = false;
+    try {
+        PriorityScheduler invalid(nullptr, 10);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    uint64_t clock = 0;
+    PriorityScheduler scheduler(&clock, 10, 30);
+    auto low = makeProcess(100, 5);
+    scheduler.addProcess(low.get());
+
+    // A fresh priority-1 arrival every tick would starve the low process forever
+    std::vector<std::unique_ptr<Process>> stream;
+    uint64_t dispatchedAt = 0;
+    for (clock = 1; clock <= 200 && dispatchedAt == 0; ++clock) {
+        stream.push_back(makeProcess(static_cast<int>(clock), 1));
+        stream.back()->setState(ProcessState::READY, clock);
+        scheduler.addProcess(stream.back().get());
+        if (clock == 25) assert(scheduler.getEffectivePriority(100) == 3);
+
+        Process* p = scheduler.getNextProcess();
+        if (p == low.get()) dispatchedAt = clock;
+    }
+
+    // Four epochs lift it to the newcomers' level, ahead of the next arrival
+    assert(dispatchedAt == 40);
+    auto metrics = scheduler.getSchedulerMetrics();
+    assert(metrics.maxReadyWait == dispatchedAt);
+    assert(metrics.starvedDispatches == 1);
+    assert(metrics.agingEpochs == static_cast<int>(dispatchedAt / 10));
+    assert(scheduler.getAlgorithmName() == "Priority Scheduling (aging=10)");
+
+    std::cout << "[PASSED] test_aging_bounds_starvation" << std::endl;
+}
+
+void test_preempts_on_io_completion() {
+    std::cout << "[RUNNING] test_preempts_on_io_completion..." << std::endl;
+
+    // P2 outranks P1 and returns from I/O while P1 holds the CPU
+    std::string fname = "test_priority_io.txt";
+    std::ofstream out(fname);
+    out << "P1 0 CPU(20) 2 1\n"
+        << "P2 0 CPU(1),E/S(3),CPU(2) 0 1\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    sim.setScheduler(std::make_unique<PriorityScheduler>(sim.getClockRef()));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    int maxTicks = 100;
+    while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+    assert(sim.getSimulatorMetrics().completedProcesses == 2);
+
+    const Process* p1 = nullptr;
+    const Process* p2 = nullptr;
+    for (const Process* p : sim.getAllProcesses()) (p->getPid() == 1 ? p1 : p2) = p;
+    std::cout << "  -> P2 finish: " << p2->getStats().finishTime << std::endl;
+    assert(p1->getStats().preemptions == 1);
+    assert(p2->getStats().finishTime < 10);
+    assert(p2->getStats().finishTime < p1->getStats().finishTime);
+
+    std::remove(fname.c_str());
+    std::cout << "[PASSED] test_preempts_on_io_completion" << std::endl;
+}
+
+int main() {
+    test_levels_and_fifo_order();
+    test_out_of_range_priorities();
+    test_remove_and_set_priority();
+    test_scheduler_cycles_reuse_links();
+    test_promote_levels();
+    test_aging_bounds_starvation();
+    test_preempts_on_io_completion();
+    return 0;
+}
@@ -15,6 +15,11 @@
 #include "waos/scheduler/PriorityScheduler.h"
 #include "waos/memory/IMemoryManager.h"
 
+// Process files in tests/mock; CMake passes the absolute path
+#ifndef WAOS_MOCK_DIR
+#define WAOS_MOCK_DIR "../../../tests/mock"
+#endif
+
 using namespace waos::core;
 using namespace waos::scheduler;
 using namespace waos::memory;
@@ -51,15 +56,15 @@ std::string burstTypeToString(BurstType type) {
  */
 class MockMemoryManager : public IMemoryManager {
 public:
-    bool isPageLoaded(int pid, int page) const override {
+    bool isPageLoaded(int pid, waos::common::PageNumber page) const override {
         return true; // All pages are always loaded
     }
 
-    PageRequestResult requestPage(int pid, int page) override {
+    PageRequestResult requestPage(int pid, waos::common::PageNumber page, bool isWrite = false) override {
         return PageRequestResult::HIT; // No page faults, silent
     }
 
-    void allocateForProcess(int pid, int pages) override {
+    void allocateForProcess(int pid, waos::common::PageNumber pages) override {
         // Silent - focus on scheduling
     }
 
@@ -67,9 +72,15 @@ public:
         // Silent - focus on scheduling  
     }
 
-    void completePageLoad(int processId, int pageNumber) override {
+    void completePageLoad(int processId, waos::common::PageNumber pageNumber) override {
         // No-op for this simple test
     }
+
+    std::vector<waos::common::FrameInfo> getFrameStatus() const override { return {}; }
+    std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int) const override { return {}; }
+    waos::common::MemoryStats getMemoryStats() const override { return {}; }
+    std::string getAlgorithmName() const override { return "MockMemory"; }
+    void reset() override {}
 };
 
 /**
@@ -83,7 +94,7 @@ void test_priority_levels() {
     Simulator sim;
     
     // Load test processes
-    std::string mockFile = "../../../tests/mock/test_priority_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_priority_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes from " << mockFile << std::endl;
         assert(false);
@@ -165,7 +176,7 @@ void test_priority_with_io() {
 
     Simulator sim;
     
-    std::string mockFile = "../../../tests/mock/test_priority_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_priority_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes" << std::endl;
         assert(false);
@@ -208,7 +219,7 @@ void test_priority_full_simulation() {
 
     Simulator sim;
     
-    std::string mockFile = "../../../tests/mock/test_priority_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_priority_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes" << std::endl;
         assert(false);
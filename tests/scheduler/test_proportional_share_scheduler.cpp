@@ -0,0 +1,180 @@
+/**
+ * @brief Tests for the lottery and stride proportional-share schedulers.
+ * @details Both schedulers should give each process a CPU share proportional
+ *          to its tickets; stride deterministically, lottery on average.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <queue>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/LotteryScheduler.h"
+#include "waos/scheduler/StrideScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int tickets) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, 1000});
+    auto p = std::make_unique<Process>(pid, 0, 1, bursts, 1);
+    p->setTickets(tickets);
+    return p;
+}
+
+void test_tickets_from_priority() {
+    std::cout << "[RUNNING] test_tickets_from_priority..." << std::endl;
+
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, 1});
+    Process high(1, 0, 0, bursts, 1), low(2, 0, 9, bursts, 1);
+    assert(high.getTickets() == 100);
+    assert(low.getTickets() == 10);
+
+    high.setTickets(7);
+    assert(high.getTickets() == 7);
+
+    std::cout << "[PASSED] test_tickets_from_priority" << std::endl;
+}
+
+void test_lottery_draws_proportionally() {
+    std::cout << "[RUNNING] test_lottery_draws_proportionally..." << std::endl;
+
+    // More processes than the initial Fenwick capacity to exercise growth
+    std::vector<std::unique_ptr<Process>> processes;
+    LotteryScheduler lottery(2, 7);
+    for (int pid = 1; pid <= 12; ++pid) {
+        processes.push_back(makeProcess(pid, pid == 1 ? 300 : (pid == 2 ? 100 : 1)));
+        lottery.addProcess(processes.back().get());
+    }
+    assert(lottery.getTotalReadyTickets() == 410);
+
+    std::map<int, int> wins;
+    const int draws = 20000;
+    for (int i = 0; i < draws; ++i) {
+        Process* winner = lottery.getNextProcess();
+        assert(winner);
+        wins[winner->getPid()]++;
+        lottery.addProcess(winner);  // Back into the draw
+    }
+    assert(lottery.getTotalReadyTickets() == 410);
+    assert(lottery.peekReadyQueue().size() == 12);
+
+    double share1 = double(wins[1]) / draws;
+    double share2 = double(wins[2]) / draws;
+    std::cout << "  -> P1 won " << share1 << " (expected 0.73), P2 won " << share2 << " (expected 0.24)" << std::endl;
+    assert(std::fabs(share1 - 300.0 / 410) < 0.02);
+    assert(std::fabs(share2 - 100.0 / 410) < 0.02);
+
+    std::cout << "[PASSED] test_lottery_draws_proportionally" << std::endl;
+}
+
+void test_stride_is_deterministic() {
+    std::cout << "[RUNNING] test_stride_is_deterministic..." << std::endl;
+
+    auto a = makeProcess(1, 3);
+    auto b = makeProcess(2, 1);
+    StrideScheduler stride(1);
+    stride.addProcess(a.get());
+    stride.addProcess(b.get());
+
+    // Each selection runs one tick; A (3 tickets) should run 3 of every 4 ticks
+    std::string order;
+    for (int i = 0; i < 8; ++i) {
+        Process* p = stride.getNextProcess();
+        p->addCpuTime(1);
+        order += (p == a.get()) ? 'A' : 'B';
+        stride.addProcess(p);
+    }
+    std::cout << "  -> Order: " << order << std::endl;
+    assert(std::count(order.begin(), order.end(), 'A') == 6);
+    assert(std::count(order.begin(), order.end(), 'B') == 2);
+
+    auto metrics = stride.getSchedulerMetrics();
+    assert(std::fabs(metrics.entitledShare[1] - 0.75) < 1e-9);
+    assert(std::fabs(metrics.achievedShare[1] - 0.75) < 1e-9);
+    assert(metrics.tickets[2] == 1);
+
+    std::cout << "[PASSED] test_stride_is_deterministic" << std::endl;
+}
+
+void test_stride_forgets_terminated() {
+    std::cout << "[RUNNING] test_stride_forgets_terminated..." << std::endl;
+
+    auto a = makeProcess(1, 2);
+    StrideScheduler stride(1);
+    stride.addProcess(a.get());
+    Process* p = stride.getNextProcess();
+    p->addCpuTime(1);
+    stride.addProcess(p);
+    assert(stride.getPass(1) > 0);
+
+    assert(stride.getNextProcess() == a.get());
+    stride.onProcessTerminated(1);
+    assert(stride.getPass(1) == 0);
+
+    std::cout << "[PASSED] test_stride_forgets_terminated" << std::endl;
+}
+
+waos::common::SchedulerMetrics runShares(std::unique_ptr<IScheduler> scheduler) {
+    std::string fname = "test_proportional_share.txt";
+    std::ofstream out(fname);
+    out << "P1 0 CPU(500) 1 1 TICKETS(200)\n"
+        << "P2 0 CPU(500) 1 1 TICKETS(100)\n"
+        << "P3 0 CPU(500) 1 1 TICKETS(100)\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    IScheduler* raw = scheduler.get();
+    sim.setScheduler(std::move(scheduler));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    for (int i = 0; i < 400; ++i) sim.tick();
+
+    std::remove(fname.c_str());
+    return raw->getSchedulerMetrics();
+}
+
+void test_achieved_share_in_simulator() {
+    std::cout << "[RUNNING] test_achieved_share_in_simulator..." << std::endl;
+
+    for (bool useLottery : {false, true}) {
+        std::unique_ptr<IScheduler> scheduler;
+        if (useLottery) {
+            scheduler = std::make_unique<LotteryScheduler>(2, 1);
+        } else {
+            scheduler = std::make_unique<StrideScheduler>(2);
+        }
+        auto metrics = runShares(std::move(scheduler));
+
+        std::cout << "  -> " << (useLottery ? "Lottery" : "Stride") << " P1 achieved "
+                  << metrics.achievedShare[1] << " / entitled " << metrics.entitledShare[1] << std::endl;
+        assert(std::fabs(metrics.entitledShare[1] - 0.5) < 1e-9);
+        double tolerance = useLottery ? 0.08 : 0.02;
+        for (int pid = 1; pid <= 3; ++pid) {
+            assert(std::fabs(metrics.achievedShare[pid] - metrics.entitledShare[pid]) < tolerance);
+        }
+    }
+
+    std::cout << "[PASSED] test_achieved_share_in_simulator" << std::endl;
+}
+
+int main() {
+    test_tickets_from_priority();
+    test_lottery_draws_proportionally();
+    test_stride_is_deterministic();
+    test_stride_forgets_terminated();
+    test_achieved_share_in_simulator();
+    return 0;
+}
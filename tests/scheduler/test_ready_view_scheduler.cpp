@@ -0,0 +1,198 @@
+/**
+ * @brief Tests for the ready-queue observation and maintenance API.
+ * @details forEachReady() must match peekReadyQueue() for every scheduler,
+ *          the version must change only on mutation, the heap's cached
+ *          ordered view must be reused until the heap changes, and
+ *          removeProcess()/updateKey() must work on every policy.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <queue>
+#include <vector>
+#include "waos/core/Process.h"
+#include "waos/scheduler/CFSScheduler.h"
+#include "waos/scheduler/FCFSScheduler.h"
+#include "waos/scheduler/IndexedProcessHeap.h"
+#include "waos/scheduler/LotteryScheduler.h"
+#include "waos/scheduler/MLFQScheduler.h"
+#include "waos/scheduler/PredictiveSJFScheduler.h"
+#include "waos/scheduler/PriorityScheduler.h"
+#include "waos/scheduler/RRScheduler.h"
+#include "waos/scheduler/RealTimeScheduler.h"
+#include "waos/scheduler/SJFScheduler.h"
+#include "waos/scheduler/StrideScheduler.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int burst, int priority) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, burst});
+    return std::make_unique<Process>(pid, 0, priority, bursts, 1);
+}
+
+std::vector<const Process*> visitAll(const IScheduler& scheduler) {
+    std::vector<const Process*> visited;
+    scheduler.forEachReady([&visited](const Process* p) { visited.push_back(p); });
+    return visited;
+}
+
+void check_scheduler(IScheduler& scheduler) {
+    std::vector<std::unique_ptr<Process>> processes;
+    for (int pid = 1; pid <= 5; ++pid) processes.push_back(makeProcess(pid, 10 - pid, pid % 3));
+
+    uint64_t version = scheduler.getReadyQueueVersion();
+    assert(version != 0);
+    for (auto& p : processes) {
+        scheduler.addProcess(p.get());
+        assert(scheduler.getReadyQueueVersion() > version);
+        version = scheduler.getReadyQueueVersion();
+    }
+
+    // Observation alone never changes the version
+    assert(visitAll(scheduler) == scheduler.peekReadyQueue());
+    assert(visitAll(scheduler).size() == processes.size());
+    assert(scheduler.getReadyQueueVersion() == version);
+
+    scheduler.getNextProcess();
+    assert(scheduler.getReadyQueueVersion() > version);
+    assert(visitAll(scheduler) == scheduler.peekReadyQueue());
+    assert(visitAll(scheduler).size() == processes.size() - 1);
+
+    while (scheduler.getNextProcess()) {
+    }
+    assert(visitAll(scheduler).empty());
+}
+
+void check_remove(IScheduler& scheduler) {
+    std::vector<std::unique_ptr<Process>> processes;
+    for (int pid = 1; pid <= 6; ++pid) processes.push_back(makeProcess(pid, 10 - pid, pid % 3));
+    for (auto& p : processes) scheduler.addProcess(p.get());
+
+    uint64_t version = scheduler.getReadyQueueVersion();
+    assert(scheduler.removeProcess(3));
+    assert(!scheduler.removeProcess(3));
+    assert(!scheduler.removeProcess(42));
+    assert(scheduler.getReadyQueueVersion() > version);
+
+    // Every queued process can be re-keyed, unknown ones cannot
+    assert(scheduler.updateKey(1));
+    assert(!scheduler.updateKey(3));
+
+    for (const Process* p : visitAll(scheduler)) assert(p->getPid() != 3);
+    size_t dispatched = 0;
+    while (Process* p = scheduler.getNextProcess()) {
+        assert(p->getPid() != 3);
+        dispatched++;
+    }
+    assert(dispatched == processes.size() - 1);
+    assert(!scheduler.hasReadyProcesses());
+}
+
+void test_all_schedulers_visit_in_peek_order() {
+    std::cout << "[RUNNING] test_all_schedulers_visit_in_peek_order..." << std::endl;
+    uint64_t clock = 0;
+
+    std::vector<std::unique_ptr<IScheduler>> schedulers;
+    schedulers.push_back(std::make_unique<FCFSScheduler>());
+    schedulers.push_back(std::make_unique<RRScheduler>(4));
+    schedulers.push_back(std::make_unique<SJFScheduler>());
+    schedulers.push_back(std::make_unique<PredictiveSJFScheduler>());
+    schedulers.push_back(std::make_unique<PriorityScheduler>());
+    schedulers.push_back(std::make_unique<MLFQScheduler>(&clock));
+    schedulers.push_back(std::make_unique<CFSScheduler>());
+    schedulers.push_back(std::make_unique<LotteryScheduler>());
+    schedulers.push_back(std::make_unique<StrideScheduler>());
+    schedulers.push_back(std::make_unique<RealTimeScheduler>(RealTimePolicy::EDF));
+
+    for (auto& scheduler : schedulers) {
+        std::cout << "  -> " << scheduler->getAlgorithmName() << std::endl;
+        check_scheduler(*scheduler);
+        check_remove(*scheduler);
+    }
+
+    std::cout << "[PASSED] test_all_schedulers_visit_in_peek_order" << std::endl;
+}
+
+void test_heap_sorted_view_is_cached() {
+    std::cout << "[RUNNING] test_heap_sorted_view_is_cached..." << std::endl;
+
+    auto a = makeProcess(1, 5, 0), b = makeProcess(2, 3, 0), c = makeProcess(3, 4, 0);
+    IndexedProcessHeap heap;
+    heap.push(a.get(), 5);
+    heap.push(b.get(), 3);
+
+    const auto& first = heap.sorted();
+    assert(first.size() == 2 && first[0] == b.get() && first[1] == a.get());
+
+    // Unchanged heap: the cached view is returned as is
+    assert(&heap.sorted() == &first);
+    assert(heap.sorted()[0] == b.get());
+
+    heap.push(c.get(), 4);
+    const auto& second = heap.sorted();
+    assert(second.size() == 3);
+    assert(second[0] == b.get() && second[1] == c.get() && second[2] == a.get());
+
+    heap.pop();
+    assert(heap.sorted().size() == 2 && heap.sorted()[0] == c.get());
+
+    std::cout << "[PASSED] test_heap_sorted_view_is_cached" << std::endl;
+}
+
+void test_update_key_repositions() {
+    std::cout << "[RUNNING] test_update_key_repositions..." << std::endl;
+
+    // EDF: a tighter deadline moves the job to the front
+    auto a = makeProcess(1, 4, 0), b = makeProcess(2, 4, 0);
+    a->setDeadline(10);
+    b->setDeadline(20);
+    RealTimeScheduler edf(RealTimePolicy::EDF);
+    edf.addProcess(a.get());
+    edf.addProcess(b.get());
+    assert(edf.peekReadyQueue().front() == a.get());
+    b->setDeadline(5);
+    assert(edf.updateKey(2));
+    assert(edf.peekReadyQueue().front() == b.get());
+
+    // Stride: more tickets shrink the remaining pass, so the process runs first
+    auto c = makeProcess(3, 4, 0), d = makeProcess(4, 4, 0);
+    c->setTickets(10);
+    d->setTickets(10);
+    StrideScheduler stride;
+    stride.addProcess(c.get());
+    assert(stride.getNextProcess() == c.get());
+    c->addCpuTime(2);
+    stride.addProcess(c.get());  // Pass 2 strides ahead
+    stride.addProcess(d.get());
+    assert(stride.getNextProcess() == d.get());
+    d->addCpuTime(1);
+    stride.addProcess(d.get());  // Pass 1 stride ahead
+    assert(stride.peekReadyQueue().front() == d.get());
+
+    c->setTickets(40);
+    assert(stride.updateKey(3));
+    assert(stride.getPass(3) == StrideScheduler::STRIDE1 / 40 * 2);
+    assert(stride.peekReadyQueue().front() == c.get());
+
+    // Lottery: tickets are re-read without re-inserting the process
+    auto e = makeProcess(5, 4, 0);
+    e->setTickets(1);
+    LotteryScheduler lottery;
+    lottery.addProcess(e.get());
+    e->setTickets(50);
+    assert(lottery.updateKey(5));
+    assert(lottery.getNextProcess() == e.get());
+    assert(!lottery.hasReadyProcesses());
+
+    std::cout << "[PASSED] test_update_key_repositions" << std::endl;
+}
+
+int main() {
+    test_all_schedulers_visit_in_peek_order();
+    test_heap_sorted_view_is_cached();
+    test_update_key_repositions();
+    return 0;
+}
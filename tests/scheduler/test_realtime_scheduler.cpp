@@ -0,0 +1,145 @@
+/**
+ * @brief Tests for the EDF and Rate Monotonic real-time schedulers.
+ * @details Covers heap ordering, release-time preemption, the offline
+ *          schedulability analysis and deadline-miss accounting for periodic
+ *          tasks released by the Simulator.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/RealTimeScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeJob(int pid, uint64_t arrival, uint64_t deadline, uint64_t period) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, 3});
+    auto p = std::make_unique<Process>(pid, arrival, 1, bursts, 1);
+    p->setDeadline(deadline);
+    p->setPeriod(period);
+    return p;
+}
+
+void test_edf_and_rm_ordering() {
+    std::cout << "[RUNNING] test_edf_and_rm_ordering..." << std::endl;
+
+    // Long period but imminent deadline vs. short period with a far deadline
+    auto urgent = makeJob(1, 0, 4, 20);
+    auto frequent = makeJob(2, 0, 10, 10);
+    auto background = makeJob(3, 0, 0, 0);
+
+    RealTimeScheduler edf(RealTimePolicy::EDF);
+    edf.addProcess(background.get());
+    edf.addProcess(frequent.get());
+    edf.addProcess(urgent.get());
+    assert(edf.getNextProcess() == urgent.get());
+    assert(edf.getNextProcess() == frequent.get());
+    assert(edf.getNextProcess() == background.get());
+
+    RealTimeScheduler rm(RealTimePolicy::RATE_MONOTONIC);
+    rm.addProcess(background.get());
+    rm.addProcess(urgent.get());
+    rm.addProcess(frequent.get());
+    assert(rm.getNextProcess() == frequent.get());
+    assert(rm.getNextProcess() == urgent.get());
+    assert(rm.getNextProcess() == background.get());
+
+    // A released job with an earlier deadline preempts the running one
+    edf.addProcess(urgent.get());
+    assert(edf.shouldPreempt(frequent.get(), urgent.get()));
+    assert(!edf.shouldPreempt(urgent.get(), frequent.get()));
+
+    std::cout << "[PASSED] test_edf_and_rm_ordering" << std::endl;
+}
+
+void test_schedulability_analysis() {
+    std::cout << "[RUNNING] test_schedulability_analysis..." << std::endl;
+
+    // U = 0.833, above the Liu-Layland bound (0.780) but feasible under RM
+    std::vector<RealTimeTask> harmonic = {{1, 1, 4, 0}, {2, 2, 6, 0}, {3, 3, 12, 0}};
+    auto rm = RealTimeScheduler::analyze(RealTimePolicy::RATE_MONOTONIC, harmonic);
+    assert(std::fabs(rm.bound - 3 * (std::pow(2.0, 1.0 / 3) - 1)) < 1e-9);
+    assert(rm.utilization > rm.bound);
+    assert(rm.schedulable);
+    assert(rm.responseTimes[0] == 1 && rm.responseTimes[1] == 3 && rm.responseTimes[2] == 10);
+
+    // U = 0.971: EDF meets every deadline, RM misses task 2 (R = 8 > 7)
+    std::vector<RealTimeTask> tight = {{1, 2, 5, 0}, {2, 4, 7, 0}};
+    assert(RealTimeScheduler::analyze(RealTimePolicy::EDF, tight).schedulable);
+    auto rmTight = RealTimeScheduler::analyze(RealTimePolicy::RATE_MONOTONIC, tight);
+    assert(!rmTight.schedulable);
+    assert(rmTight.responseTimes[1] == 8);
+
+    // Overload is never schedulable
+    std::vector<RealTimeTask> overload = {{1, 3, 5, 0}, {2, 3, 6, 0}};
+    assert(!RealTimeScheduler::analyze(RealTimePolicy::EDF, overload).schedulable);
+
+    bool thrown = false;
+    try { RealTimeScheduler::analyze(RealTimePolicy::EDF, {{1, 1, 0, 0}}); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+
+    std::cout << "[PASSED] test_schedulability_analysis" << std::endl;
+}
+
+waos::common::SimulatorMetrics runPeriodic(RealTimePolicy policy, int& totalJobs) {
+    std::string fname = "test_realtime.txt";
+    std::ofstream out(fname);
+    // Same task set as the analysis test, over one hyperperiod (35 ticks)
+    out << "P1 0 CPU(2) 1 1 PERIOD(5) JOBS(7)\n"
+        << "P2 0 CPU(4) 1 1 PERIOD(7) JOBS(5)\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    sim.setScheduler(std::make_unique<RealTimeScheduler>(policy));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    int maxTicks = 200;
+    while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+
+    totalJobs = static_cast<int>(sim.getAllProcesses().size());
+    std::remove(fname.c_str());
+    return sim.getSimulatorMetrics();
+}
+
+void test_periodic_release_and_deadline_metrics() {
+    std::cout << "[RUNNING] test_periodic_release_and_deadline_metrics..." << std::endl;
+
+    int edfJobs = 0, rmJobs = 0;
+    auto edf = runPeriodic(RealTimePolicy::EDF, edfJobs);
+    auto rm = runPeriodic(RealTimePolicy::RATE_MONOTONIC, rmJobs);
+
+    std::cout << "  -> EDF: " << edf.deadlineMisses << " misses, max lateness " << edf.maxLateness
+              << " | RM: " << rm.deadlineMisses << " misses, max lateness " << rm.maxLateness << std::endl;
+
+    // Every job was released as its own process and ran to completion
+    assert(edfJobs == 12 && rmJobs == 12);
+    assert(edf.completedProcesses == 12 && rm.completedProcesses == 12);
+    assert(edf.deadlineJobs == 12);
+
+    assert(edf.deadlineMisses == 0);
+    assert(edf.maxLateness <= 0);
+    assert(rm.deadlineMisses > 0);
+    assert(rm.maxLateness > 0);
+
+    std::cout << "[PASSED] test_periodic_release_and_deadline_metrics" << std::endl;
+}
+
+int main() {
+    test_edf_and_rm_ordering();
+    test_schedulability_analysis();
+    test_periodic_release_and_deadline_metrics();
+    return 0;
+}
@@ -21,6 +21,11 @@
 #include "waos/scheduler/SJFScheduler.h"
 #include "waos/memory/IMemoryManager.h"
 
+// Process files in tests/mock; CMake passes the absolute path
+#ifndef WAOS_MOCK_DIR
+#define WAOS_MOCK_DIR "../../../tests/mock"
+#endif
+
 using namespace waos::core;
 using namespace waos::scheduler;
 using namespace waos::memory;
@@ -57,15 +62,15 @@ std::string burstTypeToString(BurstType type) {
  */
 class MockMemoryManager : public IMemoryManager {
 public:
-    bool isPageLoaded(int pid, int page) const override {
+    bool isPageLoaded(int pid, waos::common::PageNumber page) const override {
         return true; // All pages are always loaded
     }
 
-    PageRequestResult requestPage(int pid, int page) override {
+    PageRequestResult requestPage(int pid, waos::common::PageNumber page, bool isWrite = false) override {
         return PageRequestResult::HIT; // No page faults, silent
     }
 
-    void allocateForProcess(int pid, int pages) override {
+    void allocateForProcess(int pid, waos::common::PageNumber pages) override {
         // Silent - focus on scheduling
     }
 
@@ -73,9 +78,15 @@ public:
         // Silent - focus on scheduling  
     }
 
-    void completePageLoad(int processId, int pageNumber) override {
+    void completePageLoad(int processId, waos::common::PageNumber pageNumber) override {
         // No-op for this simple test
     }
+
+    std::vector<waos::common::FrameInfo> getFrameStatus() const override { return {}; }
+    std::vector<waos::common::PageTableEntryInfo> getPageTableForProcess(int) const override { return {}; }
+    waos::common::MemoryStats getMemoryStats() const override { return {}; }
+    std::string getAlgorithmName() const override { return "MockMemory"; }
+    void reset() override {}
 };
 
 /**
@@ -92,7 +103,7 @@ void test_sjf_simultaneous_arrivals() {
     Simulator sim;
     
     // Load test processes
-    std::string mockFile = "../../../tests/mock/test_sjf_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_sjf_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes from " << mockFile << std::endl;
         assert(false);
@@ -136,7 +147,7 @@ void test_sjf_staggered_arrivals() {
 
     Simulator sim;
     
-    std::string mockFile = "../../../tests/mock/test_sjf_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_sjf_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes" << std::endl;
         assert(false);
@@ -182,7 +193,7 @@ void test_sjf_with_io() {
 
     Simulator sim;
     
-    std::string mockFile = "../../../tests/mock/test_sjf_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_sjf_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes" << std::endl;
         assert(false);
@@ -226,7 +237,7 @@ void test_sjf_starvation() {
 
     Simulator sim;
     
-    std::string mockFile = "../../../tests/mock/test_sjf_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_sjf_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes" << std::endl;
         assert(false);
@@ -268,7 +279,7 @@ void test_sjf_full_simulation() {
 
     Simulator sim;
     
-    std::string mockFile = "../../../tests/mock/test_sjf_processes.txt";
+    std::string mockFile = WAOS_MOCK_DIR "/test_sjf_processes.txt";
     if (!sim.loadProcesses(mockFile)) {
         std::cerr << "ERROR: Could not load processes" << std::endl;
         assert(false);
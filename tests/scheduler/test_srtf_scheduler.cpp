@@ -0,0 +1,198 @@
+/**
+ * @brief Tests for the preemptive SJF (SRTF) mode and its indexed heap.
+ * @details SRTF preempts the running process whenever a process becomes
+ *          ready with a shorter remaining CPU burst.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+#include "waos/core/Process.h"
+#include "waos/core/Simulator.h"
+#include "waos/scheduler/IndexedProcessHeap.h"
+#include "waos/scheduler/SJFScheduler.h"
+#include "tests/core/CoreMocks.h"
+
+using namespace waos::core;
+using namespace waos::scheduler;
+
+std::unique_ptr<Process> makeProcess(int pid, int cpuBurst) {
+    std::queue<Burst> bursts;
+    bursts.push({BurstType::CPU, cpuBurst});
+    return std::make_unique<Process>(pid, 0, 1, bursts, 1);
+}
+
+void test_indexed_heap_order_and_remove() {
+    std::cout << "[RUNNING] test_indexed_heap_order_and_remove..." << std::endl;
+
+    auto p1 = makeProcess(1, 0), p2 = makeProcess(2, 0), p3 = makeProcess(3, 0), p4 = makeProcess(4, 0);
+    IndexedProcessHeap heap;
+    heap.push(p1.get(), 5);
+    heap.push(p2.get(), 2);
+    heap.push(p3.get(), 5);  // Ties are FIFO: P1 before P3
+    heap.push(p4.get(), 1);
+
+    assert(heap.topKey() == 1 && heap.top() == p4.get());
+    assert(heap.remove(2));
+    assert(!heap.contains(2));
+    assert(!heap.remove(2));
+
+    auto order = heap.sorted();
+    assert(order.size() == 3);
+    assert(order[0] == p4.get() && order[1] == p1.get() && order[2] == p3.get());
+
+    assert(heap.pop() == p4.get());
+    assert(heap.pop() == p1.get());
+    assert(heap.pop() == p3.get());
+    assert(heap.pop() == nullptr);
+
+    std::cout << "[PASSED] test_indexed_heap_order_and_remove" << std::endl;
+}
+
+void test_indexed_heap_update_key() {
+    std::cout << "[RUNNING] test_indexed_heap_update_key..." << std::endl;
+
+    auto p1 = makeProcess(1, 0), p2 = makeProcess(2, 0), p3 = makeProcess(3, 0);
+    IndexedProcessHeap heap;
+    heap.push(p1.get(), 10);
+    heap.push(p2.get(), 20);
+    heap.push(p3.get(), 30);
+
+    // Decrease-key moves P3 to the top, increase-key sinks P1
+    assert(heap.updateKey(3, 5));
+    assert(heap.top() == p3.get() && heap.keyOf(3) == 5);
+    assert(heap.updateKey(1, 25));
+    assert(heap.keyOf(1) == 25);
+    assert(!heap.updateKey(99, 1));
+
+    // Equal keys keep insertion order after an update
+    assert(heap.updateKey(1, 20));
+    assert(heap.pop() == p3.get());
+    assert(heap.pop() == p1.get());
+    assert(heap.pop() == p2.get());
+
+    std::cout << "[PASSED] test_indexed_heap_update_key" << std::endl;
+}
+
+void test_indexed_heap_matches_sorted_order() {
+    std::cout << "[RUNNING] test_indexed_heap_matches_sorted_order..." << std::endl;
+
+    // Random pushes, removals and key updates against a reference model
+    const int count = 500;
+    std::vector<std::unique_ptr<Process>> processes;
+    std::vector<IndexedProcessHeap::Key> keys(count);
+    std::vector<bool> queued(count, true);
+    IndexedProcessHeap heap;
+    std::mt19937 rng(7);
+
+    for (int pid = 0; pid < count; ++pid) {
+        processes.push_back(makeProcess(pid, 0));
+        keys[pid] = rng() % 100;
+        heap.push(processes.back().get(), keys[pid]);
+    }
+    for (int step = 0; step < 300; ++step) {
+        int pid = rng() % count;
+        if (!queued[pid]) continue;
+        if (step % 3 == 0) {
+            assert(heap.remove(pid));
+            queued[pid] = false;
+        } else {
+            keys[pid] = rng() % 100;
+            assert(heap.updateKey(pid, keys[pid]));
+        }
+    }
+
+    IndexedProcessHeap::Key previous = -1;
+    size_t popped = 0;
+    while (!heap.empty()) {
+        IndexedProcessHeap::Key key = heap.topKey();
+        Process* p = heap.pop();
+        assert(queued[p->getPid()] && keys[p->getPid()] == key);
+        assert(key >= previous);
+        previous = key;
+        popped++;
+    }
+    size_t expected = 0;
+    for (bool q : queued) expected += q;
+    assert(popped == expected);
+
+    std::cout << "[PASSED] test_indexed_heap_matches_sorted_order" << std::endl;
+}
+
+void test_should_preempt_only_in_srtf() {
+    std::cout << "[RUNNING] test_should_preempt_only_in_srtf..." << std::endl;
+
+    auto running = makeProcess(1, 8);
+    auto shortJob = makeProcess(2, 3);
+
+    SJFScheduler sjf;
+    sjf.addProcess(shortJob.get());
+    assert(!sjf.shouldPreempt(running.get(), shortJob.get()));
+
+    SJFScheduler srtf(true);
+    assert(srtf.isPreemptive());
+    srtf.addProcess(shortJob.get());
+    assert(srtf.shouldPreempt(running.get(), shortJob.get()));
+
+    auto longJob = makeProcess(3, 20);
+    SJFScheduler srtfLong(true);
+    srtfLong.addProcess(longJob.get());
+    assert(!srtfLong.shouldPreempt(running.get(), longJob.get()));
+
+    std::cout << "[PASSED] test_should_preempt_only_in_srtf" << std::endl;
+}
+
+double runWorkload(std::unique_ptr<IScheduler> scheduler, int& preemptionsOut) {
+    std::string fname = "test_srtf.txt";
+    std::ofstream out(fname);
+    out << "P1 0 CPU(10) 1 1\n"
+        << "P2 2 CPU(2) 1 1\n";
+    out.close();
+
+    Simulator sim;
+    sim.loadProcesses(fname);
+    auto mem = std::make_unique<MockMemoryManager>();
+    mem->everythingLoaded = true;
+    sim.setScheduler(std::move(scheduler));
+    sim.setMemoryManager(std::move(mem));
+
+    sim.start();
+    int maxTicks = 100;
+    while (sim.isRunning() && maxTicks-- > 0) sim.tick();
+
+    preemptionsOut = 0;
+    for (const Process* p : sim.getAllProcesses()) preemptionsOut += p->getStats().preemptions;
+
+    auto metrics = sim.getSimulatorMetrics();
+    assert(metrics.completedProcesses == 2);
+    std::remove(fname.c_str());
+    return metrics.avgWaitTime;
+}
+
+void test_srtf_preempts_on_arrival() {
+    std::cout << "[RUNNING] test_srtf_preempts_on_arrival..." << std::endl;
+
+    int sjfPreemptions = 0, srtfPreemptions = 0;
+    double sjfWait = runWorkload(std::make_unique<SJFScheduler>(), sjfPreemptions);
+    double srtfWait = runWorkload(std::make_unique<SJFScheduler>(true), srtfPreemptions);
+
+    std::cout << "  -> SJF avg wait: " << sjfWait << ", SRTF avg wait: " << srtfWait << std::endl;
+    assert(sjfPreemptions == 0);
+    assert(srtfPreemptions == 1);
+    assert(srtfWait < sjfWait);
+
+    std::cout << "[PASSED] test_srtf_preempts_on_arrival" << std::endl;
+}
+
+int main() {
+    test_indexed_heap_order_and_remove();
+    test_indexed_heap_update_key();
+    test_indexed_heap_matches_sorted_order();
+    test_should_preempt_only_in_srtf();
+    test_srtf_preempts_on_arrival();
+    return 0;
+}